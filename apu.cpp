@@ -4,23 +4,43 @@
 //
 //
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <iostream>
 
 #include "apu.h"
 #include "apuunit.h"
-#include "ringbuffer.h"
+#include "audiosink.h"
+#include "blipbuffer.h"
+#include "nes.h"
 #include "save.pb.h"
-#include "sdl.h"
 
 namespace Rnes {
 
-void apuSdlCallback(void *data, uint8_t *stream, int len) {
-  RingBuffer<int16_t> *rb = (RingBuffer<int16_t> *)data;
-  uint32_t items = len / sizeof(int16_t);
-  int16_t *outData = (int16_t *)stream;
+// The nonlinear dac mix as lookup tables in output units (1 << 14 is full scale). Pulse is indexed
+// by the sum of both pulse levels, tnd by 3 * triangle + 2 * noise + dmc.
+struct MixerLut {
+  static const uint32_t pulseEntries = 31;
+  static const uint32_t tndEntries = 203;
+  static constexpr double fullScale = 1 << 14;
 
-  rb->getData(outData, items);
-}
+  int32_t pulse[pulseEntries];
+  int32_t tnd[tndEntries];
+
+  MixerLut() {
+    pulse[0] = 0;
+    for (uint32_t i = 1; i < pulseEntries; i++) {
+      pulse[i] = (int32_t)std::lround(95.52 / (8128.0 / i + 100.0) * fullScale);
+    }
+    tnd[0] = 0;
+    for (uint32_t i = 1; i < tndEntries; i++) {
+      tnd[i] = (int32_t)std::lround(163.67 / (24329.0 / i + 100.0) * fullScale);
+    }
+  }
+};
+
+static const MixerLut mixerLut;
 
 void Apu::clockLengthAndSweep() {
   pulseA->clockLengthAndSweep();
@@ -68,7 +88,10 @@ void Apu::stepAdvance() {
   }
 }
 
-void Apu::stepFastTimers() { triangle->clockTimer(); }
+void Apu::stepFastTimers() {
+  triangle->clockTimer();
+  dmc->clockTimer();
+}
 
 void Apu::stepSlowTimers() {
   pulseA->clockTimer();
@@ -76,29 +99,162 @@ void Apu::stepSlowTimers() {
   noise->clockTimer();
 }
 
-void Apu::generateSample() {
-  // float sample = (samples[sampleOffset % sampleBufferSize] + samples[(sampleOffset - 32) %
-  // sampleBufferSize]) / 2;
-  float sample = 0.0f;
-  sample += 0.02051777 * (samples[sampleOffset % sampleBufferSize]);
-  sample += 0.06532911 * (samples[(sampleOffset - 1) % sampleBufferSize]);
-  sample += 0.16640572 * (samples[(sampleOffset - 2) % sampleBufferSize]);
-  sample += 0.2477474 * (samples[(sampleOffset - 3) % sampleBufferSize]);
-  sample += 0.2477474 * (samples[(sampleOffset - 4) % sampleBufferSize]);
-  sample += 0.16640572 * (samples[(sampleOffset - 5) % sampleBufferSize]);
-  sample += 0.06532911 * (samples[(sampleOffset - 6) % sampleBufferSize]);
-  sample += 0.02051777 * (samples[(sampleOffset - 7) % sampleBufferSize]);
-
-  int16_t truncSample = (int16_t)((sample) * (1 << 14));
-
-  const unsigned int bufferedSamples = 32;
-  sampleBuffer.push_back(truncSample);
-  if (sampleBuffer.size() == bufferedSamples) {
-    rb->putData(sampleBuffer.data(), bufferedSamples);
-    sampleBuffer.clear();
+void Apu::fetchDmcSample() {
+  // The cpu is held while the byte is read, the apu and everything else keep running.
+  if (dmc->fillSampleBuffer(nes->cpuMemRead(dmc->getFetchAddr()))) {
+    setRequestDmcIrq();
+  }
+  stolenCycles += dmcFetchCycles;
+  targetCycle += dmcFetchCycles;
+}
+
+static int32_t mixChannels(const uint8_t *levels) {
+  return mixerLut.pulse[levels[ChannelLevels::PULSE_A] + levels[ChannelLevels::PULSE_B]] +
+         mixerLut.tnd[3 * levels[ChannelLevels::TRIANGLE] + 2 * levels[ChannelLevels::NOISE] +
+                      levels[ChannelLevels::DMC]];
+}
+
+void Apu::logLevels() {
+  const uint8_t current[ChannelLevels::CHANNEL_COUNT] = {
+      pulseA->getCurrentSample(), pulseB->getCurrentSample(), triangle->getCurrentSample(),
+      noise->getCurrentSample(), dmc->getCurrentSample()};
+  for (uint32_t channel = 0; channel < ChannelLevels::CHANNEL_COUNT; channel++) {
+    if (current[channel] != levels[channel]) {
+      levels[channel] = current[channel];
+      levelChanges.push_back({audioFrameCycle, (uint8_t)channel, current[channel]});
+    }
+  }
+}
+
+void Apu::mixLevels() {
+  uint8_t mix[ChannelLevels::CHANNEL_COUNT];
+  std::copy(frameStartLevels, frameStartLevels + ChannelLevels::CHANNEL_COUNT, mix);
+  for (const LevelChange &change : levelChanges) {
+    mix[change.channel] = change.level;
+    int32_t level = mixChannels(mix);
+    blip->addDelta(change.cycle, level - outputLevel);
+    outputLevel = level;
+  }
+}
+
+void Apu::expandLevels() {
+  // A change shows from the first sample instant at or after it. Changes in the last partial
+  // sample of the frame show at the start of the next one.
+  uint32_t count = blip->getCompleteSamples(audioFrameCycle);
+  uint32_t filled[ChannelLevels::CHANNEL_COUNT] = {0};
+  uint8_t current[ChannelLevels::CHANNEL_COUNT];
+  std::copy(frameStartLevels, frameStartLevels + ChannelLevels::CHANNEL_COUNT, current);
+
+  channelLevels.sampleCount = count;
+  for (std::vector<uint8_t> &channel : channelLevels.levels) {
+    channel.resize(count);
+  }
+  for (const LevelChange &change : levelChanges) {
+    uint32_t sample = std::min(blip->getSampleAt(change.cycle), count);
+    uint8_t *out = channelLevels.levels[change.channel].data();
+    std::fill(out + filled[change.channel], out + sample, current[change.channel]);
+    filled[change.channel] = sample;
+    current[change.channel] = change.level;
+  }
+  for (uint32_t channel = 0; channel < ChannelLevels::CHANNEL_COUNT; channel++) {
+    uint8_t *out = channelLevels.levels[channel].data();
+    std::fill(out + filled[channel], out + count, current[channel]);
+  }
+}
+
+void Apu::endAudioFrame() {
+  if (!generate) {
+    blip->skipFrame(audioFrameCycle);
+    audioFrameCycle = 0;
+    return;
+  }
+
+  mixLevels();
+  expandLevels();
+  levelChanges.clear();
+  std::copy(levels, levels + ChannelLevels::CHANNEL_COUNT, frameStartLevels);
+
+  blip->endFrame(audioFrameCycle);
+  audioFrameCycle = 0;
+
+  sampleBuffer.resize(blip->samplesAvailable());
+  uint32_t count = blip->readSamples(sampleBuffer.data(), sampleBuffer.size());
+  auto putStart = std::chrono::steady_clock::now();
+  // Without rate control, waiting for the device to make room is what paces emulation to real
+  // time.
+  uint32_t stored = sink->write(sampleBuffer.data(), count, !rateControl);
+  if (rateControl and sink->isRealTime()) {
+    adjustRate(count);
+  }
+  auto putWait = std::chrono::steady_clock::now() - putStart;
+  recordFrameStats(count, stored,
+                   std::chrono::duration_cast<std::chrono::microseconds>(putWait).count());
+}
+
+void Apu::recordFrameStats(uint32_t samples, uint32_t stored, uint64_t waitUs) {
+  uint32_t fill = sink->getQueued();
+  stats.ringFill.add(fill);
+  stats.putWaitUs.add(waitUs);
+  stats.latencyUs.add((uint64_t)(fill + sink->getDeviceBufferSize()) * 1000000 / sampleRate);
+  stats.frames++;
+  stats.samples += samples;
+  stats.dropped += samples - stored;
+
+  int32_t ppm = (int32_t)std::lround(rateAdjust * 1e6);
+  stats.rateAdjustPpm = ppm;
+  stats.minRateAdjustPpm = stats.frames == 1 ? ppm : std::min(stats.minRateAdjustPpm, ppm);
+  stats.maxRateAdjustPpm = stats.frames == 1 ? ppm : std::max(stats.maxRateAdjustPpm, ppm);
+
+  statsDumpSamples += samples;
+  if (statsDump and statsDumpSamples >= sampleRate) {
+    getAudioStats().print(std::cerr);
+    clearAudioStats();
   }
 }
 
+AudioStats Apu::getAudioStats() const {
+  AudioStats snapshot = stats;
+  snapshot.ringSize = sink->getQueueSize();
+  snapshot.deviceSize = sink->getDeviceBufferSize();
+  sink->getDeviceStats(snapshot);
+  return snapshot;
+}
+
+void Apu::clearAudioStats() {
+  stats = AudioStats();
+  sink->clearDeviceStats();
+  statsDumpSamples = 0;
+}
+
+void Apu::adjustRate(uint32_t frameSamples) {
+  // Right after a put the queue should hold this frame plus two device buffers of slack. The
+  // device drains in bursts, so the fill is smoothed over several frames before steering on it.
+  double targetFill = frameSamples + 2.0 * sink->getDeviceBufferSize();
+  averageFill += (sink->getQueued() - averageFill) / 8.0;
+  double error = (targetFill - averageFill) / targetFill;
+  rateAdjust = maxRateAdjust * std::min(std::max(error, -1.0), 1.0);
+  blip->setSampleRate(sampleRate * (1.0 + rateAdjust));
+}
+
+void Apu::setAudioSink(AudioSink *audioSink) {
+  // The frame in progress still goes to the old sink.
+  endAudioFrame();
+  sink = audioSink;
+  generate = !sink->isDiscarding();
+  sampleRate = sink->getSampleRate();
+  rateAdjust = 0.0;
+  averageFill = 0.0;
+  blip->setSampleRate(sampleRate);
+  clearAudioStats();
+}
+
+void Apu::setRateControl(bool enabled) {
+  rateControl = enabled;
+  rateAdjust = 0.0;
+  averageFill = 0.0;
+  blip->setSampleRate(sampleRate);
+}
+
 void Apu::tick() {
   // Divider logic for frame
   if (frameDivider == 0) {
@@ -112,43 +268,106 @@ void Apu::tick() {
     stepSlowTimers();
   }
   halfTimerDivider = !halfTimerDivider;
+  if (dmc->isFetchPending()) {
+    fetchDmcSample();
+  }
 
-  // Compute output each cycle
-  sampleOffset += 1;
-  float sample =
-      95.88f /
-      ((8128.0f / (float(pulseA->getCurrentSample() + pulseB->getCurrentSample()))) + 100.0f);
-  sample += 159.79f / (100.0f + (1.0f / ((float(triangle->getCurrentSample()) / 8227.0f) +
-                                         float(noise->getCurrentSample()) / 12241.0f)));
-  samples[sampleOffset % sampleBufferSize] = sample;
-
-  // Determine when to sample, and sample if needed.
-  nextSampleCountdown--;
-  if (!nextSampleCountdown) {
-    float prevSampleClk = currentSampleClk;
-    currentSampleClk += clksPerSample;
-    nextSampleCountdown = (uint32_t)currentSampleClk - (uint32_t)prevSampleClk;
-    if (currentSampleClk >= float(cpuClk)) {
-      currentSampleClk = 0.0f;
-    }
-    generateSample();
+  // Output only changes when a channel level does.
+  if (generate) {
+    logLevels();
+  }
+  audioFrameCycle += 1;
+  if (audioFrameCycle == audioFrameCycles) {
+    endAudioFrame();
   }
+}
 
-  /*
-  if (samplerDivider == 0) {
+uint64_t Apu::getQuietTicks() const {
+  // Ticks until the next frame sequencer step, channel timer reload or end of the audio frame.
+  // None of the ticks before that change a level, they only count down.
+  uint64_t quiet = frameDivider == 0 ? 0 : frameCycles - frameDivider;
+  quiet = std::min<uint64_t>(quiet, dmc->getQuietClocks());
+
+  // Without output nobody looks at the levels, the other channels are skipped right through.
+  if (generate) {
+    quiet = std::min<uint64_t>(quiet, triangle->getQuietClocks());
+
+    // Pulse and noise timers are clocked on every other tick, the first one now or next tick.
+    uint64_t slowOffset = halfTimerDivider == 0 ? 0 : 1;
+    uint64_t slowClocks = std::min(pulseA->getQuietClocks(), pulseB->getQuietClocks());
+    slowClocks = std::min<uint64_t>(slowClocks, noise->getQuietClocks());
+    quiet = std::min(quiet, slowOffset + 2 * slowClocks);
   }
-  samplerDivider = (samplerDivider + 1) % uint32_t(cpuClk/ sampleRate);
-  */
+
+  return std::min<uint64_t>(quiet, audioFrameCycles - 1 - audioFrameCycle);
+}
+
+void Apu::skipTicks(uint64_t ticks) {
+  frameDivider = (frameDivider + ticks) % frameCycles;
+  triangle->skipClocks(ticks);
+  dmc->skipClocks(ticks);
+
+  uint64_t slowOffset = halfTimerDivider == 0 ? 0 : 1;
+  uint32_t slowTicks = ticks > slowOffset ? (ticks - slowOffset + 1) / 2 : 0;
+  pulseA->skipClocks(slowTicks);
+  pulseB->skipClocks(slowTicks);
+  noise->skipClocks(slowTicks);
+  halfTimerDivider ^= ticks & 1;
+
+  audioFrameCycle += ticks;
+  cycle += ticks;
 }
 
-void Apu::run(int cycles) {
-  for (int i = 0; i < cycles; i++) {
-    tick();
+void Apu::catchUp() {
+  if (generate and cycle < targetCycle) {
+    // Register writes since the last tick may have changed a level.
+    logLevels();
+  }
+  while (cycle < targetCycle) {
+    // Jump over the stretch in which nothing happens and tick only where something does.
+    skipTicks(std::min(getQuietTicks(), targetCycle - cycle));
+    if (cycle < targetCycle) {
+      tick();
+      cycle += 1;
+    }
+  }
+  scheduleNextEvent();
+}
+
+void Apu::scheduleNextEvent() {
+  // The audio frame ends on the tick that brings audioFrameCycle up to audioFrameCycles.
+  nextEventCycle = cycle + (audioFrameCycles - audioFrameCycle - 1);
+
+  // The frame irq is raised by the tick that advances the 4-step sequence through its last step.
+  // Once raised it stays up until $4015 is read, which catches up anyway.
+  if (isFourStepFrame() and isFrameIntEnabled() and !isRequestingFrameIrq()) {
+    uint64_t nextStepCycle = cycle + (frameDivider == 0 ? 0 : frameCycles - frameDivider);
+    uint64_t irqCycle = nextStepCycle + ((3 - step) & 3) * frameCycles;
+    nextEventCycle = std::min(nextEventCycle, irqCycle);
+  }
+
+  // Sample fetches steal cpu cycles and may raise the dmc irq. An idle dmc never fetches.
+  uint32_t fetchClocks = dmc->getClocksToFetch();
+  if (fetchClocks != Dmc::noFetch) {
+    nextEventCycle = std::min(nextEventCycle, cycle + fetchClocks);
   }
 }
 
 void Apu::writeReg(uint32_t reg, uint8_t val) {
+  catchUp();
   regs[reg] = val;
+  if (reg <= CHANNEL1_LENGTH) {
+    pulseA->updateTimerPeriod();
+  } else if (reg <= CHANNEL2_LENGTH) {
+    pulseB->updateTimerPeriod();
+  } else if (reg <= CHANNEL3_LENGTH) {
+    triangle->updateTimerPeriod();
+  } else if (reg <= CHANNEL4_LENGTH) {
+    noise->updateTimerPeriod();
+  } else if (reg <= CHANNEL5_LENGTH_REGISTER) {
+    dmc->updateTimerPeriod();
+  }
+
   if (reg == SOFTCLOCK) {
     resetFrameCounter();
   } else if (reg == CONTROL_STATUS) {
@@ -166,6 +385,14 @@ void Apu::writeReg(uint32_t reg, uint8_t val) {
     if (~val & STATUS_CHANNEL4_LENGTH) {
       noise->zeroLength();
     }
+    if (val & STATUS_CHANNEL5_LENGTH) {
+      dmc->start();
+      if (dmc->isFetchPending()) {
+        fetchDmcSample();
+      }
+    } else {
+      dmc->stop();
+    }
   } else if (reg == CHANNEL1_LENGTH) {
     pulseA->resetLength();
     pulseA->resetSequencer();
@@ -180,10 +407,18 @@ void Apu::writeReg(uint32_t reg, uint8_t val) {
   } else if (reg == CHANNEL4_LENGTH) {
     noise->resetLength();
     noise->resetEnvelope();
+  } else if (reg == CHANNEL5_PLAY_MODE) {
+    if (!dmc->isIrqEnabled()) {
+      clearRequestDmcIrq();
+    }
+  } else if (reg == CHANNEL5_DELTA_COUNTER_LOAD_REGISTER) {
+    dmc->loadOutputLevel();
   }
+  scheduleNextEvent();
 }
 
 uint8_t Apu::readReg(uint32_t reg) {
+  catchUp();
   uint8_t result = regs[reg];
   if (reg == CONTROL_STATUS) {
     clearRequestFrameIrq();
@@ -192,16 +427,21 @@ uint8_t Apu::readReg(uint32_t reg) {
     result |= pulseB->isNonZeroLength() ? STATUS_CHANNEL2_LENGTH : 0;
     result |= triangle->isNonZeroLength() ? STATUS_CHANNEL3_LENGTH : 0;
     result |= noise->isNonZeroLength() ? STATUS_CHANNEL4_LENGTH : 0;
+    result |= dmc->isActive() ? STATUS_CHANNEL5_LENGTH : 0;
+    scheduleNextEvent();
   }
   return result;
 }
 
 void Apu::save(ApuState &pb) {
+  catchUp();
+
   // Save sub-units.
   pulseA->save(*pb.mutable_pulsea());
   pulseB->save(*pb.mutable_pulseb());
   triangle->save(*pb.mutable_triangle());
   noise->save(*pb.mutable_noise());
+  dmc->save(*pb.mutable_dmc());
 
   /*
   // Apu register file.
@@ -213,9 +453,8 @@ void Apu::save(ApuState &pb) {
   optional uint32 step = 6;
   optional uint32 halfTimerDivider = 7;
   optional uint32 samplerDivider = 8;
-  optional float clksPerSample = 9;
-  optional float currentSampleClk = 10;
-  optional uint32 nextSampleCountdown = 11;
+  optional uint32 audioFrameCycle = 12;
+  optional uint64 sampleClock = 13;
   */
 
   for (unsigned i = 0; i < REG_COUNT; i++) {
@@ -228,18 +467,11 @@ void Apu::save(ApuState &pb) {
   pb.set_step(step);
   pb.set_halftimerdivider(halfTimerDivider);
   pb.set_samplerdivider(samplerDivider);
-  pb.set_clkspersample(clksPerSample);
-  pb.set_currentsampleclk(currentSampleClk);
-  pb.set_nextsamplecountdown(nextSampleCountdown);
+  pb.set_audioframecycle(audioFrameCycle);
+  pb.set_sampleclock(blip->getFramePhase());
 }
 
 void Apu::restore(const ApuState &pb) {
-  // Restore sub-units.
-  pulseA->restore(pb.pulsea());
-  pulseB->restore(pb.pulseb());
-  triangle->restore(pb.triangle());
-  noise->restore(pb.noise());
-
   /*
   // Apu register file.
   repeated uint32 reg = 1;
@@ -250,34 +482,46 @@ void Apu::restore(const ApuState &pb) {
   optional uint32 step = 6;
   optional uint32 halfTimerDivider = 7;
   optional uint32 samplerDivider = 8;
-  optional float clksPerSample = 9;
-  optional float currentSampleClk = 10;
-  optional uint32 nextSampleCountdown = 11;
+  optional uint32 audioFrameCycle = 12;
+  optional uint64 sampleClock = 13;
   */
 
   for (int i = 0; i < pb.reg_size(); i++) {
     regs[i] = pb.reg(i);
   }
 
-  sampleRate = pb.samplerate();
+  // Restore sub-units, after the registers their timer periods come from.
+  pulseA->restore(pb.pulsea());
+  pulseB->restore(pb.pulseb());
+  triangle->restore(pb.triangle());
+  noise->restore(pb.noise());
+  dmc->restore(pb.dmc());
+
+  // sampleRate is left alone, it belongs to the audio device and not to the saved machine.
   fourFrameCount = pb.fourframecount();
   fiveFrameCount = pb.fiveframecount();
   frameDivider = pb.framedivider();
   step = pb.step();
   halfTimerDivider = pb.halftimerdivider();
   samplerDivider = pb.samplerdivider();
-  clksPerSample = pb.clkspersample();
-  currentSampleClk = pb.currentsampleclk();
-  nextSampleCountdown = pb.nextsamplecountdown();
-}
 
-Apu::Apu(Nes *parent, Sdl *audio)
-    : nes{parent}, audio{audio}, frameDivider{0}, step{0}, halfTimerDivider{0},
-      samplerDivider{0}, regs{0}, fourFrameCount{0}, fiveFrameCount{0}, sampleBuffer{} {
-  // Create audio ringbuffer.
-  std::unique_ptr<RingBuffer<uint16_t>> rbLocal(new RingBuffer<uint16_t>(1 << 12));
-  rb = std::move(rbLocal);
+  // Close the audio frame in progress and continue on the saved sample grid, so the output after
+  // a restore is the same as after the save. States from before the grid was saved keep the
+  // current one.
+  if (pb.has_sampleclock()) {
+    endAudioFrame();
+    audioFrameCycle = pb.audioframecycle() % audioFrameCycles;
+    blip->setFramePhase(pb.sampleclock());
+  }
+
+  // The state was saved caught up, carry on from wherever the cpu is now.
+  cycle = targetCycle;
+  scheduleNextEvent();
+}
 
+Apu::Apu(Nes *parent, AudioSink *sink)
+    : nes{parent}, sink{sink}, frameDivider{0}, step{0}, halfTimerDivider{0}, samplerDivider{0},
+      regs{0}, fourFrameCount{0}, fiveFrameCount{0}, sampleBuffer{} {
   // Create apu units.
   std::unique_ptr<Pulse> pulseALocal(new Pulse{&regs[CHANNEL1_VOLUME_DECAY], true});
   pulseA = std::move(pulseALocal);
@@ -291,19 +535,18 @@ Apu::Apu(Nes *parent, Sdl *audio)
   std::unique_ptr<Noise> noiseLocal(new Noise{&regs[CHANNEL4_VOLUME_DECAY]});
   noise = std::move(noiseLocal);
 
-  // Get Current sample rate
-  sampleRate = audio->getSampleRate();
+  std::unique_ptr<Dmc> dmcLocal(new Dmc{&regs[CHANNEL5_PLAY_MODE]});
+  dmc = std::move(dmcLocal);
 
-  // Start audio callbacks.
-  audio->registerAudioCallback(apuSdlCallback, rb.get());
-
-  // compute clocks per sample
-  clksPerSample = float(cpuClk) / float(sampleRate);
+  // Get Current sample rate
+  sampleRate = sink->getSampleRate();
+  generate = !sink->isDiscarding();
 
-  nextSampleCountdown = 1;
-  currentSampleClk = 0.0f;
+  // Resample from the cpu clock straight to the output rate.
+  std::unique_ptr<BlipBuffer> blipLocal(new BlipBuffer{cpuClk, sampleRate, audioFrameCycles});
+  blip = std::move(blipLocal);
 }
 
-Apu::~Apu() { audio->unregisterAudioCallback(); }
+Apu::~Apu() {}
 
 }; // namespace Rnes
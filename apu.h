@@ -11,15 +11,37 @@
 #include <memory>
 #include <vector>
 
+#include "audiostats.h"
+
 namespace Rnes {
 
-class Sdl;
+class AudioSink;
 class Nes;
+class BlipBuffer;
 class Pulse;
 class Triangle;
 class Noise;
+class Dmc;
 class ApuState;
-template <class T> class RingBuffer;
+
+// The dac input levels of the individual channels over the last audio frame, one entry per output
+// sample: the level the channel had at that sample's instant. The output mix is band-limited, these
+// are not; they are for analysis that wants the channels apart.
+struct ChannelLevels {
+  enum Channel {
+    PULSE_A,
+    PULSE_B,
+    TRIANGLE,
+    NOISE,
+    DMC,
+    CHANNEL_COUNT,
+  };
+
+  uint32_t sampleCount = 0;
+  std::vector<uint8_t> levels[CHANNEL_COUNT];
+
+  const uint8_t *getLevels(Channel channel) const { return levels[channel].data(); }
+};
 
 class Apu {
 public:
@@ -85,10 +107,16 @@ private:
   static constexpr uint32_t timerCycles = 32;
   static constexpr uint32_t frameRate = 240;
 
-  static constexpr float cpuClk = 1.789773 * 1.0E6;
+  static constexpr uint32_t cpuClk = 1789773;
+
+  // Output samples are produced once per this many cycles, about one video frame.
+  static constexpr uint32_t audioFrameCycles = 4 * frameCycles;
+
+  // The cpu is held for this many cycles while the dmc reads a sample byte.
+  static constexpr uint32_t dmcFetchCycles = 4;
 
   Nes *nes;
-  Sdl *audio;
+  AudioSink *sink;
 
   // Frame divider
   uint32_t frameDivider;
@@ -102,17 +130,38 @@ private:
   // sampler divider
   uint32_t samplerDivider;
 
-  // clocks per sample
-  float clksPerSample;
-
-  // next sample
-  float currentSampleClk;
-  uint32_t nextSampleCountdown;
-
-  // prior samples buffer
-  static const uint32_t sampleBufferSize = 32;
-  float samples[sampleBufferSize] = {0.0f};
-  uint64_t sampleOffset = 0;
+  // The apu is emulated lazily, like the ppu. cycle is the cpu cycle the apu has reached,
+  // targetCycle the one the cpu has reached and nextEventCycle the next cycle at which the apu does
+  // something the rest of the system can see: raising the frame irq, fetching a dmc sample or
+  // ending an audio frame.
+  uint64_t cycle = 0;
+  uint64_t targetCycle = 0;
+  uint64_t nextEventCycle = 0;
+
+  // Cycles taken from the cpu by dmc fetches and not yet handed back to it. They are already
+  // part of targetCycle.
+  uint32_t stolenCycles = 0;
+
+  // Band-limited output. Ticks only log the cycles at which channel levels change; once per
+  // audio frame the log is mixed into steps of the blip buffer and expanded into the per channel
+  // levels. levels are the channel levels at the end of the log, frameStartLevels at its start.
+  struct LevelChange {
+    uint32_t cycle;
+    uint8_t channel;
+    uint8_t level;
+  };
+  std::unique_ptr<BlipBuffer> blip;
+  uint32_t audioFrameCycle = 0;
+  std::vector<LevelChange> levelChanges;
+  uint8_t levels[ChannelLevels::CHANNEL_COUNT] = {0};
+  uint8_t frameStartLevels[ChannelLevels::CHANNEL_COUNT] = {0};
+  int32_t outputLevel = 0;
+  ChannelLevels channelLevels;
+
+  // Off while the sink discards everything. Then only what the cpu can see is emulated: length
+  // counters, irqs and dmc fetches. Channel timers are skipped over between those, levels aren't
+  // logged and audio frames only move the sample grid on, which keeps saved states the same.
+  bool generate = true;
 
   uint8_t regs[REG_COUNT] = {0};
   uint32_t sampleRate;
@@ -123,9 +172,27 @@ private:
   std::unique_ptr<Pulse> pulseB;
   std::unique_ptr<Triangle> triangle;
   std::unique_ptr<Noise> noise;
-
-  std::shared_ptr<RingBuffer<uint16_t>> rb;
-  std::vector<uint16_t> sampleBuffer;
+  std::unique_ptr<Dmc> dmc;
+
+  // Dynamic rate control. Without it the apu waits for room in the sink's queue and the audio
+  // device paces emulation. With it something else paces emulation and the output rate is nudged
+  // by up to maxRateAdjust to keep the queue filled around a small target, so latency stays low
+  // and the apu never waits. Only real time sinks are steered.
+  static constexpr double maxRateAdjust = 0.005;
+  bool rateControl = false;
+  double averageFill = 0.0;
+  double rateAdjust = 0.0;
+  void adjustRate(uint32_t frameSamples);
+
+  std::vector<int16_t> sampleBuffer;
+
+  // Instrumentation of the audio path. stats is only touched by the emulation thread, the sink
+  // counts what happens on the device side. With statsDump set the stats are printed and cleared
+  // after every second of output.
+  AudioStats stats;
+  bool statsDump = false;
+  uint32_t statsDumpSamples = 0;
+  void recordFrameStats(uint32_t samples, uint32_t stored, uint64_t waitUs);
 
 public:
   bool isRequestingFrameIrq() const {
@@ -145,16 +212,54 @@ public:
   void stepAdvance();
   void stepFastTimers();
   void stepSlowTimers();
-  void generateSample();
+  void fetchDmcSample();
+  void logLevels();
+  void mixLevels();
+  void expandLevels();
+  void endAudioFrame();
   void tick();
-  void run(int cycles);
+  uint64_t getQuietTicks() const;
+  void skipTicks(uint64_t ticks);
+  void catchUp();
+  void scheduleNextEvent();
+  // Advances the apu by the cycles the cpu ran and returns the cycles the dmc stole from it in
+  // the meantime, which the rest of the system has to run as well.
+  uint32_t run(int cycles) {
+    targetCycle += cycles;
+    if (nextEventCycle < targetCycle) {
+      catchUp();
+    }
+    uint32_t stolen = stolenCycles;
+    stolenCycles = 0;
+    return stolen;
+  }
+
+  // Cpu cycles from the current target until run() has work to do: catching up to an event or
+  // handing back stolen cycles.
+  uint32_t getCyclesToEvent() const {
+    if (stolenCycles or nextEventCycle < targetCycle) {
+      return 0;
+    }
+    return uint32_t(nextEventCycle - targetCycle + 1);
+  }
+  void setRateControl(bool enabled);
+
+  // Sends output to sink from the next audio frame on, at the sink's sample rate.
+  void setAudioSink(AudioSink *audioSink);
+
+  AudioStats getAudioStats() const;
+  void clearAudioStats();
+  void setAudioStatsDump(bool enabled) { statsDump = enabled; }
+
+  // Per channel levels of the last audio frame, replaced when the next one ends.
+  const ChannelLevels &getChannelLevels() const { return channelLevels; }
   void writeReg(uint32_t reg, uint8_t val);
   uint8_t readReg(uint32_t reg);
 
   void save(ApuState &pb);
   void restore(const ApuState &pb);
 
-  Apu(Nes *parent, Sdl *audio);
+  Apu(Nes *parent, AudioSink *sink);
   Apu() = delete;
   Apu(const Apu &) = delete;
   ~Apu();
@@ -11,6 +11,18 @@
 
 namespace Rnes {
 
+// Runs a timer down for clocks clocks and returns how often it reloaded, each reload being a
+// clock of whatever the timer drives. The clock that finds the counter at zero reloads it.
+static uint32_t runTimer(uint16_t &counter, uint16_t period, uint32_t clocks) {
+  if (clocks <= counter) {
+    counter -= clocks;
+    return 0;
+  }
+  uint32_t rest = clocks - counter - 1;
+  counter = period - 1 - rest % period;
+  return 1 + rest / period;
+}
+
 uint16_t Pulse::computeSweepTarget() const {
   uint16_t period = getTimerPeriod();
   uint16_t shiftedPeriod = period >> getSweepShift();
@@ -62,8 +74,10 @@ void Pulse::save(PulseState &pb) {
   // current sample
   pb.set_currentsample(currentSample);
 
-  // timer
-  pb.set_timerdivider(timerDivider);
+  // timer. timerDivider counts up from the last reload like it always did, for older builds. A
+  // period write can leave the counter above the period, which only timerCounter keeps.
+  pb.set_timerdivider((timerPeriod - timerCounter % timerPeriod) % timerPeriod);
+  pb.set_timercounter(timerCounter);
 
   // sequencer offset
   pb.set_sequenceroffset(sequencerOffset);
@@ -78,13 +92,17 @@ void Pulse::restore(const PulseState &pb) {
   resetSweepDivider = pb.resetsweepdivider();
   sweepDivider = pb.sweepdivider();
   currentSample = pb.currentsample();
-  timerDivider = pb.timerdivider();
+  updateTimerPeriod();
+  if (pb.has_timercounter()) {
+    timerCounter = pb.timercounter();
+  } else {
+    timerCounter = (timerPeriod - pb.timerdivider() % timerPeriod) % timerPeriod;
+  }
   sequencerOffset = pb.sequenceroffset();
 }
 
 uint8_t Pulse::getCurrentSample() const {
   // channel is silenced when period is < 8
-  const uint16_t timerPeriod = getTimerPeriod();
   if (timerPeriod < 8) {
     return 0;
   }
@@ -146,10 +164,20 @@ void Pulse::updateSample() {
 }
 
 void Pulse::clockTimer() {
-  if (timerDivider == 0) {
+  if (timerCounter == 0) {
+    timerCounter = timerPeriod;
+    updateSample();
+  }
+  timerCounter--;
+}
+
+void Pulse::skipClocks(uint32_t clocks) {
+  uint32_t steps = runTimer(timerCounter, timerPeriod, clocks);
+  if (steps) {
+    // Only the last step leaves its bit behind.
+    sequencerOffset = (sequencerOffset + steps - 1) % 8;
     updateSample();
   }
-  timerDivider = (timerDivider + 1) % getTimerPeriod();
 }
 
 void Triangle::save(TriangleState &pb) {
@@ -163,8 +191,9 @@ void Triangle::save(TriangleState &pb) {
   // current sample
   pb.set_currentsample(currentSample);
 
-  // timer
-  pb.set_timerdivider(timerDivider);
+  // timer, both ways like Pulse::save.
+  pb.set_timerdivider((timerPeriod - timerCounter % timerPeriod) % timerPeriod);
+  pb.set_timercounter(timerCounter);
 
   // sequencer offset
   pb.set_sequenceroffset(sequencerOffset);
@@ -176,7 +205,12 @@ void Triangle::restore(const TriangleState &pb) {
   linearCounter = pb.linearcounter();
 
   currentSample = pb.currentsample();
-  timerDivider = pb.timerdivider();
+  updateTimerPeriod();
+  if (pb.has_timercounter()) {
+    timerCounter = pb.timercounter();
+  } else {
+    timerCounter = (timerPeriod - pb.timerdivider() % timerPeriod) % timerPeriod;
+  }
 
   sequencerOffset = pb.sequenceroffset();
 }
@@ -206,10 +240,22 @@ void Triangle::updateSample() {
 }
 
 void Triangle::clockTimer() {
-  if (timerDivider == 0 and isNonZeroLength() && isNonZeroLinearCounter()) {
+  if (timerCounter == 0) {
+    timerCounter = timerPeriod;
+    if (isNonZeroLength() and isNonZeroLinearCounter()) {
+      updateSample();
+    }
+  }
+  timerCounter--;
+}
+
+void Triangle::skipClocks(uint32_t clocks) {
+  // Length and linear counter only change on frame steps, never in the middle of a skip.
+  uint32_t steps = runTimer(timerCounter, timerPeriod, clocks);
+  if (steps and isNonZeroLength() and isNonZeroLinearCounter()) {
+    sequencerOffset = (sequencerOffset + steps - 1) % 32;
     updateSample();
   }
-  timerDivider = (timerDivider + 1) % (getTimerPeriod());
 }
 
 uint16_t Noise::getNextShiftReg(uint16_t reg) const {
@@ -263,8 +309,9 @@ void Noise::save(NoiseState &pb) {
   // current sample
   pb.set_currentsample(currentSample);
 
-  // timer
-  pb.set_timerdivider(timerDivider);
+  // timer, both ways like Pulse::save.
+  pb.set_timerdivider((timerPeriod - timerCounter % timerPeriod) % timerPeriod);
+  pb.set_timercounter(timerCounter);
 }
 
 void Noise::restore(const NoiseState &pb) {
@@ -274,7 +321,12 @@ void Noise::restore(const NoiseState &pb) {
   envelopeDivider = pb.envelopedivider();
   resetEnvelopeAndDivider = pb.resetenvelopeanddivider();
   currentSample = pb.currentsample();
-  timerDivider = pb.timerdivider();
+  updateTimerPeriod();
+  if (pb.has_timercounter()) {
+    timerCounter = pb.timercounter();
+  } else {
+    timerCounter = (timerPeriod - pb.timerdivider() % timerPeriod) % timerPeriod;
+  }
 }
 
 void Noise::clockEnvelope() {
@@ -305,10 +357,134 @@ void Noise::updateSample() {
 }
 
 void Noise::clockTimer() {
-  if (timerDivider == 0) {
+  if (timerCounter == 0) {
+    timerCounter = timerPeriod;
+    updateSample();
+  }
+  timerCounter--;
+}
+
+void Noise::skipClocks(uint32_t clocks) {
+  // The shift register has no shortcut, but a step is cheap and comes every eight cycles at most.
+  uint32_t steps = runTimer(timerCounter, timerPeriod, clocks);
+  for (uint32_t i = 0; i < steps; i++) {
     updateSample();
   }
-  timerDivider = (timerDivider + 1) % getTimerPeriod();
+}
+
+void Dmc::save(DmcState &pb) {
+  // output unit
+  pb.set_outputlevel(outputLevel);
+  pb.set_shiftregister(shiftRegister);
+  pb.set_bitsremaining(bitsRemaining);
+  pb.set_silence(silence);
+
+  // memory reader
+  pb.set_samplebuffer(sampleBuffer);
+  pb.set_samplebufferfull(sampleBufferFull);
+  pb.set_currentaddr(currentAddr);
+  pb.set_bytesremaining(bytesRemaining);
+
+  // timer
+  pb.set_timercounter(timerCounter);
+}
+
+void Dmc::restore(const DmcState &pb) {
+  outputLevel = pb.outputlevel();
+  shiftRegister = pb.shiftregister();
+  bitsRemaining = pb.bitsremaining();
+  silence = pb.silence();
+
+  sampleBuffer = pb.samplebuffer();
+  sampleBufferFull = pb.samplebufferfull();
+  currentAddr = pb.currentaddr();
+  bytesRemaining = pb.bytesremaining();
+
+  updateTimerPeriod();
+  timerCounter = pb.timercounter();
+}
+
+void Dmc::restart() {
+  currentAddr = getSampleAddr();
+  bytesRemaining = getSampleLength();
+}
+
+void Dmc::start() {
+  if (!bytesRemaining) {
+    restart();
+  }
+}
+
+bool Dmc::fillSampleBuffer(uint8_t sample) {
+  assert(isFetchPending());
+  sampleBuffer = sample;
+  sampleBufferFull = true;
+
+  // The address wraps around to $8000 after $ffff.
+  currentAddr = currentAddr == 0xffff ? 0x8000 : currentAddr + 1;
+  bytesRemaining--;
+  if (bytesRemaining) {
+    return false;
+  }
+  if (isLoop()) {
+    restart();
+    return false;
+  }
+  return isIrqEnabled();
+}
+
+void Dmc::outputClock() {
+  if (!silence) {
+    if (shiftRegister & 1) {
+      if (outputLevel <= 125) {
+        outputLevel += 2;
+      }
+    } else if (outputLevel >= 2) {
+      outputLevel -= 2;
+    }
+  }
+  shiftRegister >>= 1;
+
+  // Start the next output cycle from the sample buffer, or silence it when there's nothing.
+  bitsRemaining--;
+  if (bitsRemaining == 0) {
+    bitsRemaining = 8;
+    silence = !sampleBufferFull;
+    if (sampleBufferFull) {
+      shiftRegister = sampleBuffer;
+      sampleBufferFull = false;
+    }
+  }
+}
+
+void Dmc::clockTimer() {
+  if (timerCounter == 0) {
+    timerCounter = timerPeriod;
+    outputClock();
+  }
+  timerCounter--;
+}
+
+uint32_t Dmc::getClocksToFetch() const {
+  // The output cycle that takes the full buffer starts on the output clock that runs the bits
+  // remaining out; the timer clocks the next one once its counter is down.
+  if (!sampleBufferFull or !bytesRemaining) {
+    return noFetch;
+  }
+  return timerCounter + (bitsRemaining - 1) * (uint32_t)timerPeriod;
+}
+
+void Dmc::skipClocks(uint32_t clocks) {
+  uint32_t outputClocks = runTimer(timerCounter, timerPeriod, clocks);
+  if (!outputClocks) {
+    return;
+  }
+
+  // Only an idle channel goes through output clocks here. Each of them shifts and counts a bit;
+  // with the buffer empty every new output cycle stays silent.
+  assert(isIdle());
+  shiftRegister = outputClocks < 8 ? shiftRegister >> outputClocks : 0;
+  bitsRemaining = (bitsRemaining + 7 - outputClocks % 8) % 8 + 1;
 }
 
 }; // namespace Rnes
@@ -17,6 +17,7 @@ namespace Rnes {
 class PulseState;
 class TriangleState;
 class NoiseState;
+class DmcState;
 
 static const uint8_t lengthCounterLut[] = {10, 254, 20,  2,  40, 4,  80, 6,  160, 8,  60,
                                            10, 14,  12,  26, 14, 12, 16, 24, 18,  48, 20,
@@ -56,8 +57,9 @@ class Pulse {
   // current sample
   uint8_t currentSample;
 
-  // timer
-  uint32_t timerDivider;
+  // timer, a down counter reloaded from the cached period
+  uint16_t timerPeriod;
+  uint16_t timerCounter;
 
   // sequencer offset
   uint32_t sequencerOffset;
@@ -80,6 +82,7 @@ class Pulse {
   void setTimerPeriod(uint16_t period) {
     regs[PULSE_FREQUENCY] = (uint8_t)period;
     regs[PULSE_LENGTH] = (regs[PULSE_LENGTH] & 0xf8) | ((uint8_t)(period >> 8) & 0x7);
+    updateTimerPeriod();
   }
   uint16_t computeSweepTarget() const;
   void sweepPeriod();
@@ -90,7 +93,9 @@ public:
   Pulse(uint8_t *argRegs, bool primaryPulse)
       : regs{argRegs}, primary{primaryPulse}, lengthCounter{0}, envelope{0}, envelopeDivider{0},
         resetEnvelopeAndDivider{true}, resetSweepDivider{true}, sweepDivider{0}, currentSample{0},
-        timerDivider{0}, sequencerOffset{0} {}
+        timerPeriod{0}, timerCounter{0}, sequencerOffset{0} {
+    updateTimerPeriod();
+  }
   Pulse(const Pulse &) = delete;
   ~Pulse() {}
 
@@ -108,6 +113,14 @@ public:
   void clockLengthAndSweep();
   void updateSample();
   void clockTimer();
+
+  // The timer period is cached, call this whenever the registers it comes from change.
+  void updateTimerPeriod() { timerPeriod = getTimerPeriod(); }
+
+  // Timer clocks that go by before the sequencer steps again, all of which can be skipped.
+  // Skipping further steps the sequencer too, only the levels in between are lost.
+  uint32_t getQuietClocks() const { return timerCounter; }
+  void skipClocks(uint32_t clocks);
 };
 
 class Triangle {
@@ -132,8 +145,9 @@ class Triangle {
   // current sample
   uint8_t currentSample;
 
-  // timer
-  uint32_t timerDivider;
+  // timer, a down counter reloaded from the cached period
+  uint16_t timerPeriod;
+  uint16_t timerCounter;
 
   // sequencer offset
   uint32_t sequencerOffset;
@@ -155,12 +169,14 @@ public:
   void setHaltFlag() { linearCounterHalt = true; }
   void resetSequencer() {
     sequencerOffset = 0;
-    timerDivider = 0;
+    timerCounter = 0;
   }
   uint8_t getCurrentSample() const { return currentSample; }
   Triangle(uint8_t *argRegs)
       : regs{argRegs}, lengthCounter{0}, linearCounterHalt{false}, linearCounter{0},
-        currentSample{0}, timerDivider{0}, sequencerOffset{0} {}
+        currentSample{0}, timerPeriod{0}, timerCounter{0}, sequencerOffset{0} {
+    updateTimerPeriod();
+  }
   Triangle(const Pulse &) = delete;
   ~Triangle() {}
 
@@ -171,6 +187,10 @@ public:
   void clockLinearCounter();
   void updateSample();
   void clockTimer();
+
+  void updateTimerPeriod() { timerPeriod = getTimerPeriod(); }
+  uint32_t getQuietClocks() const { return timerCounter; }
+  void skipClocks(uint32_t clocks);
 };
 
 class Noise {
@@ -197,8 +217,9 @@ class Noise {
   // current sample
   uint8_t currentSample;
 
-  // timer
-  uint32_t timerDivider;
+  // timer, a down counter reloaded from the cached period
+  uint16_t timerPeriod;
+  uint16_t timerCounter;
 
   // constants
   uint16_t periodTable[16] = {0x004, 0x008, 0x010, 0x020, 0x040, 0x060, 0x080, 0x0a0,
@@ -230,7 +251,9 @@ public:
   uint8_t getCurrentSample() const;
   Noise(uint8_t *argRegs)
       : regs{argRegs}, lengthCounter{0}, shiftRegister{1}, envelope{0}, envelopeDivider{0},
-        resetEnvelopeAndDivider{true}, currentSample{0}, timerDivider{0} {}
+        resetEnvelopeAndDivider{true}, currentSample{0}, timerPeriod{0}, timerCounter{0} {
+    updateTimerPeriod();
+  }
   Noise(const Pulse &) = delete;
   ~Noise() {}
 
@@ -241,6 +264,94 @@ public:
   void clockLength();
   void updateSample();
   void clockTimer();
+
+  void updateTimerPeriod() { timerPeriod = getTimerPeriod(); }
+  uint32_t getQuietClocks() const { return timerCounter; }
+  void skipClocks(uint32_t clocks);
+};
+
+class Dmc {
+  enum {
+    DMC_PLAY_MODE,     // il--rrrr (irq enable, loop, rate index)
+    DMC_OUTPUT_LEVEL,  // -ddddddd (direct load of the output level)
+    DMC_SAMPLE_ADDR,   // aaaaaaaa (sample address is $c000 + a * 64)
+    DMC_SAMPLE_LENGTH, // llllllll (sample length is l * 16 + 1 bytes)
+    DMC_REG_COUNT
+  };
+  uint8_t *regs;
+
+  // output unit
+  uint8_t outputLevel;
+  uint8_t shiftRegister;
+  uint8_t bitsRemaining;
+  bool silence;
+
+  // memory reader
+  uint8_t sampleBuffer;
+  bool sampleBufferFull;
+  uint16_t currentAddr;
+  uint16_t bytesRemaining;
+
+  // timer, a down counter reloaded from the cached period
+  uint16_t timerPeriod;
+  uint16_t timerCounter;
+
+  // constants, in cpu cycles
+  uint16_t periodTable[16] = {428, 380, 340, 320, 286, 254, 226, 214,
+                              190, 160, 142, 128, 106, 84,  72,  54};
+
+  // Query functions
+  bool isLoop() const { return (regs[DMC_PLAY_MODE] & (1 << 6)) != 0; }
+  uint16_t getTimerPeriod() const { return periodTable[regs[DMC_PLAY_MODE] & 0xf]; }
+  uint16_t getSampleAddr() const { return 0xc000 + (uint16_t)regs[DMC_SAMPLE_ADDR] * 64; }
+  uint16_t getSampleLength() const { return (uint16_t)regs[DMC_SAMPLE_LENGTH] * 16 + 1; }
+  bool isIdle() const { return silence and !sampleBufferFull and !bytesRemaining; }
+
+  void restart();
+  void outputClock();
+
+public:
+  bool isIrqEnabled() const { return (regs[DMC_PLAY_MODE] & (1 << 7)) != 0; }
+  bool isActive() const { return bytesRemaining != 0; }
+  uint8_t getCurrentSample() const { return outputLevel; }
+  void loadOutputLevel() { outputLevel = regs[DMC_OUTPUT_LEVEL] & 0x7f; }
+
+  // $4015 bit 4, playback restarts only once the current sample has run out.
+  void start();
+  void stop() { bytesRemaining = 0; }
+
+  // The memory reader wants a byte whenever the sample buffer is empty and bytes remain. The apu
+  // fetches it from the cpu bus; fillSampleBuffer returns true when that ended the sample and an
+  // irq is due.
+  bool isFetchPending() const { return !sampleBufferFull and bytesRemaining; }
+  uint16_t getFetchAddr() const { return currentAddr; }
+  bool fillSampleBuffer(uint8_t sample);
+
+  // Timer clocks until the output unit empties the sample buffer and asks for the next byte, or
+  // noFetch when it won't.
+  static const uint32_t noFetch = UINT32_MAX;
+  uint32_t getClocksToFetch() const;
+
+  Dmc(uint8_t *argRegs)
+      : regs{argRegs}, outputLevel{0}, shiftRegister{0}, bitsRemaining{8}, silence{true},
+        sampleBuffer{0}, sampleBufferFull{false}, currentAddr{0}, bytesRemaining{0},
+        timerPeriod{0}, timerCounter{0} {
+    updateTimerPeriod();
+  }
+  Dmc(const Dmc &) = delete;
+  ~Dmc() {}
+
+  void save(DmcState &pb);
+  void restore(const DmcState &pb);
+
+  void clockTimer();
+
+  void updateTimerPeriod() { timerPeriod = getTimerPeriod(); }
+
+  // An idle channel only runs down its shifter, nothing it does can be heard until a register
+  // is written. Otherwise every output clock may change the level.
+  uint32_t getQuietClocks() const { return isIdle() ? UINT32_MAX : timerCounter; }
+  void skipClocks(uint32_t clocks);
 };
 
 }; // namespace Rnes
@@ -0,0 +1,195 @@
+//
+//  audiosink.cpp
+//  rnes
+//
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "audiosink.h"
+#include "audiostats.h"
+#include "ringbuffer.h"
+#include "sdl.h"
+
+namespace Rnes {
+
+void AudioSink::getDeviceStats(AudioStats &stats) const {
+  stats.callbacks = callbacks.load(std::memory_order_relaxed);
+  stats.underruns = underruns.load(std::memory_order_relaxed);
+  stats.underrunSamples = underrunSamples.load(std::memory_order_relaxed);
+}
+
+void AudioSink::clearDeviceStats() {
+  callbacks.store(0, std::memory_order_relaxed);
+  underruns.store(0, std::memory_order_relaxed);
+  underrunSamples.store(0, std::memory_order_relaxed);
+}
+
+// The sdl device pulls from a small ring on its own thread. An underrun repeats the last sample
+// instead of clicking.
+class SdlAudioSink : public AudioSink {
+  Sdl *sdl;
+  RingBuffer<int16_t> rb{1 << 12};
+
+  static void callback(void *data, uint8_t *stream, int len);
+
+public:
+  uint32_t getSampleRate() const override { return sdl->getSampleRate(); }
+  uint32_t write(const int16_t *samples, uint32_t count, bool wait) override {
+    typedef RingBuffer<int16_t> Ring;
+    return rb.putData(samples, count, wait ? Ring::OVERFLOW_WAIT : Ring::OVERFLOW_DROP);
+  }
+  bool isRealTime() const override { return true; }
+  uint32_t getQueued() const override { return rb.getFill(); }
+  uint32_t getQueueSize() const override { return rb.getSize(); }
+  uint32_t getDeviceBufferSize() const override { return sdl->getChunkSize(); }
+
+  SdlAudioSink(Sdl *sdl) : sdl{sdl} { sdl->registerAudioCallback(callback, this); }
+  SdlAudioSink(const SdlAudioSink &) = delete;
+  ~SdlAudioSink() { sdl->unregisterAudioCallback(); }
+};
+
+void SdlAudioSink::callback(void *data, uint8_t *stream, int len) {
+  SdlAudioSink *sink = (SdlAudioSink *)data;
+  uint32_t count = len / sizeof(int16_t);
+
+  uint32_t taken = sink->rb.getData((int16_t *)stream, count);
+  sink->callbacks.fetch_add(1, std::memory_order_relaxed);
+  if (taken < count) {
+    sink->underruns.fetch_add(1, std::memory_order_relaxed);
+    sink->underrunSamples.fetch_add(count - taken, std::memory_order_relaxed);
+  }
+}
+
+class NullAudioSink : public AudioSink {
+  uint32_t sampleRate;
+
+public:
+  uint32_t getSampleRate() const override { return sampleRate; }
+  uint32_t write(const int16_t *, uint32_t count, bool) override { return count; }
+  bool isDiscarding() const override { return true; }
+
+  NullAudioSink(uint32_t rate) : sampleRate{rate} {}
+};
+
+// Samples go through a large ring to a writer thread, which writes them out in big chunks. The
+// emulation thread only ever copies into the ring; if the disk falls more than queueSize samples
+// behind, the excess is dropped rather than waited for.
+class CaptureAudioSink : public AudioSink {
+  static const uint32_t queueSize = 1 << 20;
+  static const uint32_t writeSize = 1 << 15;
+
+  FILE *file;
+  bool wav;
+  uint32_t sampleRate;
+  RingBuffer<int16_t> rb{queueSize};
+  std::thread writer;
+  std::atomic<bool> quit{false};
+
+  // Writer thread only.
+  uint64_t written = 0;
+
+  void writerMain();
+  void writeWavHeader();
+
+public:
+  uint32_t getSampleRate() const override { return sampleRate; }
+  uint32_t write(const int16_t *samples, uint32_t count, bool) override {
+    return rb.putData(samples, count, RingBuffer<int16_t>::OVERFLOW_DROP);
+  }
+
+  CaptureAudioSink(FILE *file, bool wav, uint32_t rate);
+  CaptureAudioSink(const CaptureAudioSink &) = delete;
+  ~CaptureAudioSink();
+};
+
+CaptureAudioSink::CaptureAudioSink(FILE *file, bool wav, uint32_t rate)
+    : file{file}, wav{wav}, sampleRate{rate} {
+  if (wav) {
+    // Sizes are unknown until the end, the header is rewritten then.
+    writeWavHeader();
+  }
+  writer = std::thread(&CaptureAudioSink::writerMain, this);
+}
+
+CaptureAudioSink::~CaptureAudioSink() {
+  quit.store(true, std::memory_order_release);
+  writer.join();
+  if (wav) {
+    fseek(file, 0, SEEK_SET);
+    writeWavHeader();
+  }
+  fclose(file);
+}
+
+void CaptureAudioSink::writerMain() {
+  std::vector<int16_t> buffer(writeSize);
+  while (true) {
+    // Everything put before quit was set is drained before the thread exits.
+    bool quitting = quit.load(std::memory_order_acquire);
+    uint32_t fill = rb.getFill();
+    if (fill >= writeSize or (quitting and fill)) {
+      uint32_t count = rb.getData(buffer.data(), std::min(fill, writeSize));
+      fwrite(buffer.data(), sizeof(int16_t), count, file);
+      written += count;
+    } else if (quitting) {
+      break;
+    } else {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+  }
+}
+
+void CaptureAudioSink::writeWavHeader() {
+  // Canonical 44 byte header for 16 bit mono pcm, little endian throughout.
+  uint32_t dataBytes = uint32_t(written * sizeof(int16_t));
+  uint8_t header[44];
+  auto put32 = [&](uint32_t offset, uint32_t value) {
+    for (uint32_t i = 0; i < 4; i++) {
+      header[offset + i] = uint8_t(value >> (8 * i));
+    }
+  };
+  auto put16 = [&](uint32_t offset, uint16_t value) {
+    header[offset] = uint8_t(value);
+    header[offset + 1] = uint8_t(value >> 8);
+  };
+  memcpy(&header[0], "RIFF", 4);
+  put32(4, 36 + dataBytes);
+  memcpy(&header[8], "WAVE", 4);
+  memcpy(&header[12], "fmt ", 4);
+  put32(16, 16);
+  put16(20, 1);
+  put16(22, 1);
+  put32(24, sampleRate);
+  put32(28, sampleRate * sizeof(int16_t));
+  put16(32, sizeof(int16_t));
+  put16(34, 16);
+  memcpy(&header[36], "data", 4);
+  put32(40, dataBytes);
+  fwrite(header, 1, sizeof(header), file);
+}
+
+std::unique_ptr<AudioSink> AudioSink::createSdl(Sdl *sdl) {
+  return std::unique_ptr<AudioSink>{new SdlAudioSink{sdl}};
+}
+
+std::unique_ptr<AudioSink> AudioSink::createNull(uint32_t sampleRate) {
+  return std::unique_ptr<AudioSink>{new NullAudioSink{sampleRate}};
+}
+
+std::unique_ptr<AudioSink> AudioSink::createCapture(const std::string &file,
+                                                    uint32_t sampleRate) {
+  FILE *out = fopen(file.c_str(), "wb");
+  if (!out) {
+    return nullptr;
+  }
+  bool wav = file.size() >= 4 and file.compare(file.size() - 4, 4, ".wav") == 0;
+  return std::unique_ptr<AudioSink>{new CaptureAudioSink{out, wav, sampleRate}};
+}
+
+}; // namespace Rnes
@@ -0,0 +1,68 @@
+//
+//  audiosink.h
+//  rnes
+//
+//
+
+#ifndef __AUDIOSINK_H__
+#define __AUDIOSINK_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Rnes {
+
+class Sdl;
+struct AudioStats;
+
+// Where the samples of the apu go. Every audio frame is handed to write() on the emulation
+// thread; the sink plays, stores or drops them. Sinks that buffer do so in their own queue.
+class AudioSink {
+protected:
+  // Device side counters, bumped by whatever thread consumes the queue.
+  std::atomic<uint64_t> callbacks{0};
+  std::atomic<uint64_t> underruns{0};
+  std::atomic<uint64_t> underrunSamples{0};
+
+public:
+  // Output rate of sinks that aren't tied to a device.
+  static const uint32_t defaultSampleRate = 44100;
+
+  virtual ~AudioSink() {}
+  virtual uint32_t getSampleRate() const = 0;
+
+  // Takes count samples and returns how many were kept. With wait set a real time sink blocks
+  // until its device made room, which paces emulation; without it, or for any other sink, write
+  // never waits and drops what doesn't fit.
+  virtual uint32_t write(const int16_t *samples, uint32_t count, bool wait) = 0;
+
+  // A real time sink plays its queue through a device at the sample rate, so its fill can be
+  // steered by rate control and turned into latency. Other sinks report an empty queue.
+  virtual bool isRealTime() const { return false; }
+  virtual uint32_t getQueued() const { return 0; }
+  virtual uint32_t getQueueSize() const { return 0; }
+  virtual uint32_t getDeviceBufferSize() const { return 0; }
+
+  // A discarding sink throws every sample away, so the apu doesn't bother making any.
+  virtual bool isDiscarding() const { return false; }
+
+  // Copies the device counters into stats, or clears them.
+  void getDeviceStats(AudioStats &stats) const;
+  void clearDeviceStats();
+
+  // Plays through the sdl audio device, which has to be open.
+  static std::unique_ptr<AudioSink> createSdl(Sdl *sdl);
+
+  // Drops every sample, for running without a sound device or as fast as possible.
+  static std::unique_ptr<AudioSink> createNull(uint32_t sampleRate);
+
+  // Writes 16 bit mono pcm to file from a background thread, as a wav file if the name ends in
+  // .wav and headerless otherwise. Returns nullptr if the file can't be created.
+  static std::unique_ptr<AudioSink> createCapture(const std::string &file, uint32_t sampleRate);
+};
+
+}; // namespace Rnes
+
+#endif
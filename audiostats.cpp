@@ -0,0 +1,64 @@
+//
+//  audiostats.cpp
+//  rnes
+//
+//
+
+#include <algorithm>
+#include <cmath>
+
+#include "audiostats.h"
+
+namespace Rnes {
+
+uint32_t Histogram::getBucketIndex(uint64_t value) {
+  if (value < subBuckets) {
+    return (uint32_t)value;
+  }
+  // The top subBucketBits + 1 bits of the value pick the bucket within its power of two.
+  uint32_t shift = 63 - __builtin_clzll(value) - subBucketBits;
+  uint32_t index = subBuckets * (shift + 1) + (uint32_t)(value >> shift) - subBuckets;
+  return std::min(index, bucketCount - 1);
+}
+
+uint64_t Histogram::getBucketLimit(uint32_t index) {
+  if (index < subBuckets) {
+    return index;
+  }
+  uint32_t shift = index / subBuckets - 1;
+  return ((uint64_t)(index % subBuckets + subBuckets + 1) << shift) - 1;
+}
+
+void Histogram::add(uint64_t value) {
+  buckets[getBucketIndex(value)]++;
+  count++;
+  sum += value;
+  min = std::min(min, value);
+  max = std::max(max, value);
+}
+
+uint64_t Histogram::getPercentile(double fraction) const {
+  uint64_t rank = (uint64_t)std::ceil(fraction * count);
+  uint64_t seen = 0;
+  for (uint32_t i = 0; i < bucketCount; i++) {
+    seen += buckets[i];
+    if (seen >= rank and buckets[i]) {
+      // The largest value seen bounds the top bucket, which is open ended.
+      return std::min(max, getBucketLimit(i));
+    }
+  }
+  return max;
+}
+
+void AudioStats::print(std::ostream &out) const {
+  out << "audio: frames " << frames << " samples " << samples << " dropped " << dropped
+      << " | fill p50 " << ringFill.getPercentile(0.5) << " p99 " << ringFill.getPercentile(0.99)
+      << " max " << ringFill.getMax() << " of " << ringSize << " | latency p50 "
+      << latencyUs.getPercentile(0.5) / 1000.0 << " p99 " << latencyUs.getPercentile(0.99) / 1000.0
+      << " ms | put wait mean " << putWaitUs.getMean() / 1000.0 << " max "
+      << putWaitUs.getMax() / 1000.0 << " ms | underruns " << underruns << "/" << callbacks
+      << " (" << underrunSamples << " samples) | rate " << rateAdjustPpm << " ppm ["
+      << minRateAdjustPpm << ", " << maxRateAdjustPpm << "]" << std::endl;
+}
+
+}; // namespace Rnes
@@ -0,0 +1,76 @@
+//
+//  audiostats.h
+//  rnes
+//
+//
+
+#ifndef __AUDIOSTATS_H__
+#define __AUDIOSTATS_H__
+
+#include <cstdint>
+#include <ostream>
+
+namespace Rnes {
+
+// Distribution of a non-negative quantity in log-linear buckets: values below subBuckets get a
+// bucket each, every power of two above is split into subBuckets equal parts, so a bucket is
+// never wider than 1 / subBuckets of its values. Values past 1 << 32 share the last bucket.
+class Histogram {
+public:
+  static const uint32_t subBucketBits = 3;
+  static const uint32_t subBuckets = 1 << subBucketBits;
+  static const uint32_t bucketCount = subBuckets * (32 - subBucketBits + 1);
+
+  void add(uint64_t value);
+  void clear() { *this = Histogram(); }
+
+  uint64_t getCount() const { return count; }
+  uint64_t getMin() const { return count ? min : 0; }
+  uint64_t getMax() const { return max; }
+  double getMean() const { return count ? double(sum) / count : 0.0; }
+  uint64_t getBucket(uint32_t i) const { return buckets[i]; }
+
+  // Upper bound of the bucket holding the given fraction of values, 0.5 for the median.
+  uint64_t getPercentile(double fraction) const;
+
+  static uint32_t getBucketIndex(uint64_t value);
+  static uint64_t getBucketLimit(uint32_t index);
+
+private:
+  uint64_t buckets[bucketCount] = {0};
+  uint64_t count = 0;
+  uint64_t sum = 0;
+  uint64_t min = UINT64_MAX;
+  uint64_t max = 0;
+};
+
+// What the audio path did since the stats were last cleared. The producer side is sampled once
+// per audio frame by the apu, the device side counts every callback.
+struct AudioStats {
+  // Producer, one entry per audio frame.
+  Histogram ringFill;      // samples queued right after the frame was put, out of ringSize
+  Histogram putWaitUs;     // time putData spent waiting for the device to make room
+  Histogram latencyUs;     // queued samples plus one device buffer, the age of a sample at output
+  uint64_t frames = 0;     // audio frames produced
+  uint64_t samples = 0;    // samples produced
+  uint64_t dropped = 0;    // samples that didn't fit the ring under rate control
+  uint32_t ringSize = 0;   // ring capacity in samples
+  uint32_t deviceSize = 0; // device buffer in samples
+
+  // Output rate relative to the nominal one, as steered by rate control, in parts per million.
+  int32_t rateAdjustPpm = 0;
+  int32_t minRateAdjustPpm = 0;
+  int32_t maxRateAdjustPpm = 0;
+
+  // Device callbacks, and those the ring couldn't fill completely.
+  uint64_t callbacks = 0;
+  uint64_t underruns = 0;
+  uint64_t underrunSamples = 0;
+
+  // One line summary, percentiles are bucket bounds.
+  void print(std::ostream &out) const;
+};
+
+}; // namespace Rnes
+
+#endif
@@ -0,0 +1,8421 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: save.proto
+
+#include "save.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace Rnes {
+PROTOBUF_CONSTEXPR CpuState::CpuState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.a_)*/0u
+  , /*decltype(_impl_.x_)*/0u
+  , /*decltype(_impl_.y_)*/0u
+  , /*decltype(_impl_.pc_)*/0u
+  , /*decltype(_impl_.sp_)*/0u
+  , /*decltype(_impl_.status_)*/0u
+  , /*decltype(_impl_.cycle_)*/uint64_t{0u}} {}
+struct CpuStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CpuStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CpuStateDefaultTypeInternal() {}
+  union {
+    CpuState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CpuStateDefaultTypeInternal _CpuState_default_instance_;
+PROTOBUF_CONSTEXPR PulseState::PulseState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lengthcounter_)*/0u
+  , /*decltype(_impl_.envelope_)*/0u
+  , /*decltype(_impl_.envelopedivider_)*/0u
+  , /*decltype(_impl_.primary_)*/false
+  , /*decltype(_impl_.resetenvelopeanddivider_)*/false
+  , /*decltype(_impl_.resetsweepdivider_)*/false
+  , /*decltype(_impl_.sweepdivider_)*/0u
+  , /*decltype(_impl_.currentsample_)*/0u
+  , /*decltype(_impl_.timerdivider_)*/0u
+  , /*decltype(_impl_.sequenceroffset_)*/0u} {}
+struct PulseStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PulseStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PulseStateDefaultTypeInternal() {}
+  union {
+    PulseState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PulseStateDefaultTypeInternal _PulseState_default_instance_;
+PROTOBUF_CONSTEXPR TriangleState::TriangleState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lengthcounter_)*/0u
+  , /*decltype(_impl_.linearcounterhalt_)*/false
+  , /*decltype(_impl_.linearcounter_)*/0u
+  , /*decltype(_impl_.currentsample_)*/0u
+  , /*decltype(_impl_.timerdivider_)*/0u
+  , /*decltype(_impl_.sequenceroffset_)*/0u} {}
+struct TriangleStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TriangleStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TriangleStateDefaultTypeInternal() {}
+  union {
+    TriangleState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TriangleStateDefaultTypeInternal _TriangleState_default_instance_;
+PROTOBUF_CONSTEXPR NoiseState::NoiseState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lengthcounter_)*/0u
+  , /*decltype(_impl_.shiftregister_)*/0u
+  , /*decltype(_impl_.envelope_)*/0u
+  , /*decltype(_impl_.envelopedivider_)*/0u
+  , /*decltype(_impl_.resetenvelopeanddivider_)*/false
+  , /*decltype(_impl_.currentsample_)*/0u
+  , /*decltype(_impl_.timerdivider_)*/0u} {}
+struct NoiseStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NoiseStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NoiseStateDefaultTypeInternal() {}
+  union {
+    NoiseState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NoiseStateDefaultTypeInternal _NoiseState_default_instance_;
+PROTOBUF_CONSTEXPR DmcState::DmcState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.outputlevel_)*/0u
+  , /*decltype(_impl_.shiftregister_)*/0u
+  , /*decltype(_impl_.samplebuffer_)*/0u
+  , /*decltype(_impl_.samplebufferfull_)*/false
+  , /*decltype(_impl_.currentaddr_)*/0u
+  , /*decltype(_impl_.bytesremaining_)*/0u
+  , /*decltype(_impl_.timercounter_)*/0u
+  , /*decltype(_impl_.bitsremaining_)*/8u
+  , /*decltype(_impl_.silence_)*/true} {}
+struct DmcStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DmcStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DmcStateDefaultTypeInternal() {}
+  union {
+    DmcState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DmcStateDefaultTypeInternal _DmcState_default_instance_;
+PROTOBUF_CONSTEXPR ApuState::ApuState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reg_)*/{}
+  , /*decltype(_impl_.pulsea_)*/nullptr
+  , /*decltype(_impl_.pulseb_)*/nullptr
+  , /*decltype(_impl_.triangle_)*/nullptr
+  , /*decltype(_impl_.noise_)*/nullptr
+  , /*decltype(_impl_.dmc_)*/nullptr
+  , /*decltype(_impl_.samplerate_)*/0u
+  , /*decltype(_impl_.fourframecount_)*/0u
+  , /*decltype(_impl_.fiveframecount_)*/0u
+  , /*decltype(_impl_.framedivider_)*/0u
+  , /*decltype(_impl_.step_)*/0u
+  , /*decltype(_impl_.halftimerdivider_)*/0u
+  , /*decltype(_impl_.samplerdivider_)*/0u
+  , /*decltype(_impl_.clkspersample_)*/0
+  , /*decltype(_impl_.currentsampleclk_)*/0
+  , /*decltype(_impl_.nextsamplecountdown_)*/0u
+  , /*decltype(_impl_.sampleclock_)*/uint64_t{0u}
+  , /*decltype(_impl_.audioframecycle_)*/0u} {}
+struct ApuStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ApuStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ApuStateDefaultTypeInternal() {}
+  union {
+    ApuState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApuStateDefaultTypeInternal _ApuState_default_instance_;
+PROTOBUF_CONSTEXPR PpuState_SpriteState::PpuState_SpriteState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ycoordminus1_)*/0u
+  , /*decltype(_impl_.tileindex_)*/0u
+  , /*decltype(_impl_.attr_)*/0u
+  , /*decltype(_impl_.xcoord_)*/0u} {}
+struct PpuState_SpriteStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PpuState_SpriteStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PpuState_SpriteStateDefaultTypeInternal() {}
+  union {
+    PpuState_SpriteState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PpuState_SpriteStateDefaultTypeInternal _PpuState_SpriteState_default_instance_;
+PROTOBUF_CONSTEXPR PpuState_DotState::PpuState_DotState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.secondaryoam_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.spritepatternlo_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.spritepatternhi_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.spriteattr_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.spritex_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.bgpatternshiftlo_)*/0u
+  , /*decltype(_impl_.bgpatternshifthi_)*/0u
+  , /*decltype(_impl_.bgattrshiftlo_)*/0u
+  , /*decltype(_impl_.bgattrshifthi_)*/0u
+  , /*decltype(_impl_.namelatch_)*/0u
+  , /*decltype(_impl_.attrlatch_)*/0u
+  , /*decltype(_impl_.patternlatchlo_)*/0u
+  , /*decltype(_impl_.patternlatchhi_)*/0u
+  , /*decltype(_impl_.oamlatch_)*/0u
+  , /*decltype(_impl_.evalsprite_)*/0u
+  , /*decltype(_impl_.evalbyte_)*/0u
+  , /*decltype(_impl_.secondaryoamaddr_)*/0u
+  , /*decltype(_impl_.linespritecount_)*/0u
+  , /*decltype(_impl_.evaldone_)*/false
+  , /*decltype(_impl_.sprite0next_)*/false
+  , /*decltype(_impl_.linehassprite0_)*/false
+  , /*decltype(_impl_.a12high_)*/false
+  , /*decltype(_impl_.a12lowcycle_)*/uint64_t{0u}} {}
+struct PpuState_DotStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PpuState_DotStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PpuState_DotStateDefaultTypeInternal() {}
+  union {
+    PpuState_DotState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PpuState_DotStateDefaultTypeInternal _PpuState_DotState_default_instance_;
+PROTOBUF_CONSTEXPR PpuState::PpuState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.regs_)*/{}
+  , /*decltype(_impl_.spriteram_)*/{}
+  , /*decltype(_impl_.dot_)*/nullptr
+  , /*decltype(_impl_.cycle_)*/uint64_t{0u}
+  , /*decltype(_impl_.frame_)*/uint64_t{0u}
+  , /*decltype(_impl_.vramtoggle_)*/0u
+  , /*decltype(_impl_.vramfinexscroll_)*/0u
+  , /*decltype(_impl_.vramcurrentaddr_)*/0u
+  , /*decltype(_impl_.vramtempaddr_)*/0u
+  , /*decltype(_impl_.vrammachineaddr_)*/0u
+  , /*decltype(_impl_.vramreadlatch_)*/0u
+  , /*decltype(_impl_.scrollingmachinestate_)*/0u
+  , /*decltype(_impl_.xscrollorigin_)*/0u
+  , /*decltype(_impl_.yscrollorigin_)*/0u} {}
+struct PpuStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PpuStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PpuStateDefaultTypeInternal() {}
+  union {
+    PpuState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PpuStateDefaultTypeInternal _PpuState_default_instance_;
+PROTOBUF_CONSTEXPR MmcState_MmcNoneState::MmcState_MmcNoneState(
+    ::_pbi::ConstantInitialized) {}
+struct MmcState_MmcNoneStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MmcState_MmcNoneStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MmcState_MmcNoneStateDefaultTypeInternal() {}
+  union {
+    MmcState_MmcNoneState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MmcState_MmcNoneStateDefaultTypeInternal _MmcState_MmcNoneState_default_instance_;
+PROTOBUF_CONSTEXPR MmcState_Mmc1State::MmcState_Mmc1State(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.controlreg_)*/0u
+  , /*decltype(_impl_.chr0bank_)*/0u
+  , /*decltype(_impl_.chr1bank_)*/0u
+  , /*decltype(_impl_.prgbank_)*/0u
+  , /*decltype(_impl_.shiftregister_)*/0u} {}
+struct MmcState_Mmc1StateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MmcState_Mmc1StateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MmcState_Mmc1StateDefaultTypeInternal() {}
+  union {
+    MmcState_Mmc1State _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MmcState_Mmc1StateDefaultTypeInternal _MmcState_Mmc1State_default_instance_;
+PROTOBUF_CONSTEXPR MmcState_Mmc3State::MmcState_Mmc3State(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.bankregister_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.bankselectreg_)*/0u
+  , /*decltype(_impl_.mirrorreg_)*/0u
+  , /*decltype(_impl_.prgramreg_)*/0u
+  , /*decltype(_impl_.irqreloadreg_)*/0u
+  , /*decltype(_impl_.irqcounterreg_)*/0u
+  , /*decltype(_impl_.irqenabled_)*/false
+  , /*decltype(_impl_.irqpending_)*/false} {}
+struct MmcState_Mmc3StateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MmcState_Mmc3StateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MmcState_Mmc3StateDefaultTypeInternal() {}
+  union {
+    MmcState_Mmc3State _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MmcState_Mmc3StateDefaultTypeInternal _MmcState_Mmc3State_default_instance_;
+PROTOBUF_CONSTEXPR MmcState::MmcState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.mmcnone_)*/nullptr
+  , /*decltype(_impl_.mmc1_)*/nullptr
+  , /*decltype(_impl_.mmc3_)*/nullptr} {}
+struct MmcStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MmcStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MmcStateDefaultTypeInternal() {}
+  union {
+    MmcState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MmcStateDefaultTypeInternal _MmcState_default_instance_;
+PROTOBUF_CONSTEXPR ControllerState::ControllerState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.control_)*/0u
+  , /*decltype(_impl_.shiftreg_)*/0u} {}
+struct ControllerStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ControllerStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ControllerStateDefaultTypeInternal() {}
+  union {
+    ControllerState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControllerStateDefaultTypeInternal _ControllerState_default_instance_;
+PROTOBUF_CONSTEXPR CpuMemoryState::CpuMemoryState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.cpusram_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.prgsram_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CpuMemoryStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CpuMemoryStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CpuMemoryStateDefaultTypeInternal() {}
+  union {
+    CpuMemoryState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CpuMemoryStateDefaultTypeInternal _CpuMemoryState_default_instance_;
+PROTOBUF_CONSTEXPR VideoMemoryState::VideoMemoryState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.patterntablememory_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nametablememory_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.palettememory_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct VideoMemoryStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VideoMemoryStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VideoMemoryStateDefaultTypeInternal() {}
+  union {
+    VideoMemoryState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VideoMemoryStateDefaultTypeInternal _VideoMemoryState_default_instance_;
+PROTOBUF_CONSTEXPR DmaState::DmaState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.spritedmamode_)*/false
+  , /*decltype(_impl_.spritedmacycle_)*/0u
+  , /*decltype(_impl_.spritedmasourceaddr_)*/0u} {}
+struct DmaStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DmaStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DmaStateDefaultTypeInternal() {}
+  union {
+    DmaState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DmaStateDefaultTypeInternal _DmaState_default_instance_;
+PROTOBUF_CONSTEXPR SaveState::SaveState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.savedate_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.dma_)*/nullptr
+  , /*decltype(_impl_.cpu_)*/nullptr
+  , /*decltype(_impl_.apu_)*/nullptr
+  , /*decltype(_impl_.ppu_)*/nullptr
+  , /*decltype(_impl_.controller_)*/nullptr
+  , /*decltype(_impl_.cpumem_)*/nullptr
+  , /*decltype(_impl_.vidmem_)*/nullptr
+  , /*decltype(_impl_.gametime_)*/uint64_t{0u}} {}
+struct SaveStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SaveStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SaveStateDefaultTypeInternal() {}
+  union {
+    SaveState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SaveStateDefaultTypeInternal _SaveState_default_instance_;
+}  // namespace Rnes
+static ::_pb::Metadata file_level_metadata_save_2eproto[18];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_save_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_save_2eproto = nullptr;
+
+const uint32_t TableStruct_save_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuState, _impl_.a_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuState, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuState, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuState, _impl_.pc_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuState, _impl_.sp_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuState, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuState, _impl_.cycle_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.primary_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.lengthcounter_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.envelope_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.envelopedivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.resetenvelopeanddivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.resetsweepdivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.sweepdivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.currentsample_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.timerdivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PulseState, _impl_.sequenceroffset_),
+  3,
+  0,
+  1,
+  2,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  PROTOBUF_FIELD_OFFSET(::Rnes::TriangleState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::TriangleState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::TriangleState, _impl_.lengthcounter_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::TriangleState, _impl_.linearcounterhalt_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::TriangleState, _impl_.linearcounter_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::TriangleState, _impl_.currentsample_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::TriangleState, _impl_.timerdivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::TriangleState, _impl_.sequenceroffset_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::Rnes::NoiseState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::NoiseState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::NoiseState, _impl_.lengthcounter_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::NoiseState, _impl_.shiftregister_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::NoiseState, _impl_.envelope_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::NoiseState, _impl_.envelopedivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::NoiseState, _impl_.resetenvelopeanddivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::NoiseState, _impl_.currentsample_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::NoiseState, _impl_.timerdivider_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_.outputlevel_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_.shiftregister_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_.bitsremaining_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_.silence_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_.samplebuffer_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_.samplebufferfull_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_.currentaddr_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_.bytesremaining_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmcState, _impl_.timercounter_),
+  0,
+  1,
+  7,
+  8,
+  2,
+  3,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.reg_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.samplerate_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.fourframecount_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.fiveframecount_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.framedivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.step_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.halftimerdivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.samplerdivider_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.clkspersample_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.currentsampleclk_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.nextsamplecountdown_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.audioframecycle_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.sampleclock_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.pulsea_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.pulseb_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.triangle_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.noise_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ApuState, _impl_.dmc_),
+  ~0u,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  16,
+  15,
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_SpriteState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_SpriteState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_SpriteState, _impl_.ycoordminus1_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_SpriteState, _impl_.tileindex_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_SpriteState, _impl_.attr_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_SpriteState, _impl_.xcoord_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.bgpatternshiftlo_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.bgpatternshifthi_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.bgattrshiftlo_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.bgattrshifthi_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.namelatch_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.attrlatch_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.patternlatchlo_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.patternlatchhi_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.secondaryoam_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.oamlatch_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.evalsprite_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.evalbyte_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.secondaryoamaddr_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.evaldone_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.sprite0next_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.linespritecount_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.linehassprite0_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.spritepatternlo_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.spritepatternhi_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.spriteattr_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.spritex_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.a12high_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState_DotState, _impl_.a12lowcycle_),
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  0,
+  13,
+  14,
+  15,
+  16,
+  18,
+  19,
+  17,
+  20,
+  1,
+  2,
+  3,
+  4,
+  21,
+  22,
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.cycle_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.frame_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.regs_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.spriteram_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.vramtoggle_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.vramfinexscroll_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.vramcurrentaddr_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.vramtempaddr_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.vrammachineaddr_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.vramreadlatch_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.scrollingmachinestate_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.xscrollorigin_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.yscrollorigin_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::PpuState, _impl_.dot_),
+  1,
+  2,
+  ~0u,
+  ~0u,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_MmcNoneState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc1State, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc1State, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc1State, _impl_.controlreg_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc1State, _impl_.chr0bank_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc1State, _impl_.chr1bank_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc1State, _impl_.prgbank_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc1State, _impl_.shiftregister_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _impl_.bankselectreg_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _impl_.mirrorreg_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _impl_.prgramreg_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _impl_.bankregister_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _impl_.irqreloadreg_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _impl_.irqcounterreg_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _impl_.irqenabled_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState_Mmc3State, _impl_.irqpending_),
+  1,
+  2,
+  3,
+  0,
+  4,
+  5,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState, _impl_.mmcnone_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState, _impl_.mmc1_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::MmcState, _impl_.mmc3_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::Rnes::ControllerState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ControllerState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::ControllerState, _impl_.control_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::ControllerState, _impl_.shiftreg_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuMemoryState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuMemoryState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuMemoryState, _impl_.cpusram_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::CpuMemoryState, _impl_.prgsram_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Rnes::VideoMemoryState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::VideoMemoryState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::VideoMemoryState, _impl_.patterntablememory_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::VideoMemoryState, _impl_.nametablememory_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::VideoMemoryState, _impl_.palettememory_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmaState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmaState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmaState, _impl_.spritedmamode_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmaState, _impl_.spritedmacycle_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::DmaState, _impl_.spritedmasourceaddr_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_.savedate_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_.gametime_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_.dma_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_.cpu_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_.apu_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_.ppu_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_.controller_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_.cpumem_),
+  PROTOBUF_FIELD_OFFSET(::Rnes::SaveState, _impl_.vidmem_),
+  0,
+  8,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 13, -1, sizeof(::Rnes::CpuState)},
+  { 20, 36, -1, sizeof(::Rnes::PulseState)},
+  { 46, 58, -1, sizeof(::Rnes::TriangleState)},
+  { 64, 77, -1, sizeof(::Rnes::NoiseState)},
+  { 84, 99, -1, sizeof(::Rnes::DmcState)},
+  { 108, 132, -1, sizeof(::Rnes::ApuState)},
+  { 150, 160, -1, sizeof(::Rnes::PpuState_SpriteState)},
+  { 164, 193, -1, sizeof(::Rnes::PpuState_DotState)},
+  { 216, 236, -1, sizeof(::Rnes::PpuState)},
+  { 250, -1, -1, sizeof(::Rnes::MmcState_MmcNoneState)},
+  { 256, 267, -1, sizeof(::Rnes::MmcState_Mmc1State)},
+  { 272, 286, -1, sizeof(::Rnes::MmcState_Mmc3State)},
+  { 294, 303, -1, sizeof(::Rnes::MmcState)},
+  { 306, 314, -1, sizeof(::Rnes::ControllerState)},
+  { 316, 324, -1, sizeof(::Rnes::CpuMemoryState)},
+  { 326, 335, -1, sizeof(::Rnes::VideoMemoryState)},
+  { 338, 347, -1, sizeof(::Rnes::DmaState)},
+  { 350, 365, -1, sizeof(::Rnes::SaveState)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Rnes::_CpuState_default_instance_._instance,
+  &::Rnes::_PulseState_default_instance_._instance,
+  &::Rnes::_TriangleState_default_instance_._instance,
+  &::Rnes::_NoiseState_default_instance_._instance,
+  &::Rnes::_DmcState_default_instance_._instance,
+  &::Rnes::_ApuState_default_instance_._instance,
+  &::Rnes::_PpuState_SpriteState_default_instance_._instance,
+  &::Rnes::_PpuState_DotState_default_instance_._instance,
+  &::Rnes::_PpuState_default_instance_._instance,
+  &::Rnes::_MmcState_MmcNoneState_default_instance_._instance,
+  &::Rnes::_MmcState_Mmc1State_default_instance_._instance,
+  &::Rnes::_MmcState_Mmc3State_default_instance_._instance,
+  &::Rnes::_MmcState_default_instance_._instance,
+  &::Rnes::_ControllerState_default_instance_._instance,
+  &::Rnes::_CpuMemoryState_default_instance_._instance,
+  &::Rnes::_VideoMemoryState_default_instance_._instance,
+  &::Rnes::_DmaState_default_instance_._instance,
+  &::Rnes::_SaveState_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_save_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nsave.proto\022\004Rnes\"b\n\010CpuState\022\t\n\001a\030\001 \001("
+  "\r\022\t\n\001x\030\002 \001(\r\022\t\n\001y\030\003 \001(\r\022\n\n\002pc\030\004 \001(\r\022\n\n\002s"
+  "p\030\005 \001(\r\022\016\n\006status\030\006 \001(\r\022\r\n\005cycle\030\007 \001(\004\"\367"
+  "\001\n\nPulseState\022\017\n\007primary\030\001 \001(\010\022\025\n\rlength"
+  "Counter\030\002 \001(\r\022\020\n\010envelope\030\003 \001(\r\022\027\n\017envel"
+  "opeDivider\030\004 \001(\r\022\037\n\027resetEnvelopeAndDivi"
+  "der\030\005 \001(\010\022\031\n\021resetSweepDivider\030\006 \001(\010\022\024\n\014"
+  "sweepDivider\030\007 \001(\r\022\025\n\rcurrentSample\030\010 \001("
+  "\r\022\024\n\014timerDivider\030\t \001(\r\022\027\n\017sequencerOffs"
+  "et\030\n \001(\r\"\236\001\n\rTriangleState\022\025\n\rlengthCoun"
+  "ter\030\001 \001(\r\022\031\n\021linearCounterHalt\030\002 \001(\010\022\025\n\r"
+  "linearCounter\030\003 \001(\r\022\025\n\rcurrentSample\030\004 \001"
+  "(\r\022\024\n\014timerDivider\030\005 \001(\r\022\027\n\017sequencerOff"
+  "set\030\006 \001(\r\"\263\001\n\nNoiseState\022\025\n\rlengthCounte"
+  "r\030\001 \001(\r\022\025\n\rshiftRegister\030\002 \001(\r\022\020\n\010envelo"
+  "pe\030\003 \001(\r\022\027\n\017envelopeDivider\030\004 \001(\r\022\037\n\027res"
+  "etEnvelopeAndDivider\030\005 \001(\010\022\025\n\rcurrentSam"
+  "ple\030\006 \001(\r\022\024\n\014timerDivider\030\007 \001(\r\"\332\001\n\010DmcS"
+  "tate\022\023\n\013outputLevel\030\001 \001(\r\022\025\n\rshiftRegist"
+  "er\030\002 \001(\r\022\030\n\rbitsRemaining\030\003 \001(\r:\0018\022\025\n\007si"
+  "lence\030\004 \001(\010:\004true\022\024\n\014sampleBuffer\030\005 \001(\r\022"
+  "\030\n\020sampleBufferFull\030\006 \001(\010\022\023\n\013currentAddr"
+  "\030\007 \001(\r\022\026\n\016bytesRemaining\030\010 \001(\r\022\024\n\014timerC"
+  "ounter\030\t \001(\r\"\326\003\n\010ApuState\022\013\n\003reg\030\001 \003(\r\022\022"
+  "\n\nsampleRate\030\002 \001(\r\022\026\n\016fourFrameCount\030\003 \001"
+  "(\r\022\026\n\016fiveFrameCount\030\004 \001(\r\022\024\n\014frameDivid"
+  "er\030\005 \001(\r\022\014\n\004step\030\006 \001(\r\022\030\n\020halfTimerDivid"
+  "er\030\007 \001(\r\022\026\n\016samplerDivider\030\010 \001(\r\022\025\n\rclks"
+  "PerSample\030\t \001(\002\022\030\n\020currentSampleClk\030\n \001("
+  "\002\022\033\n\023nextSampleCountdown\030\013 \001(\r\022\027\n\017audioF"
+  "rameCycle\030\014 \001(\r\022\023\n\013sampleClock\030\r \001(\004\022 \n\006"
+  "pulseA\030\024 \001(\0132\020.Rnes.PulseState\022 \n\006pulseB"
+  "\030\025 \001(\0132\020.Rnes.PulseState\022%\n\010triangle\030\026 \001"
+  "(\0132\023.Rnes.TriangleState\022\037\n\005noise\030\027 \001(\0132\020"
+  ".Rnes.NoiseState\022\033\n\003dmc\030\030 \001(\0132\016.Rnes.Dmc"
+  "State\"\274\007\n\010PpuState\022\r\n\005cycle\030\001 \001(\004\022\r\n\005fra"
+  "me\030\002 \001(\004\022\014\n\004regs\030\003 \003(\r\022-\n\tspriteRam\030\004 \003("
+  "\0132\032.Rnes.PpuState.SpriteState\022\022\n\nvramTog"
+  "gle\030\005 \001(\r\022\027\n\017vramFineXScroll\030\006 \001(\r\022\027\n\017vr"
+  "amCurrentAddr\030\007 \001(\r\022\024\n\014vramTempAddr\030\010 \001("
+  "\r\022\027\n\017vramMachineAddr\030\t \001(\r\022\025\n\rvramReadLa"
+  "tch\030\n \001(\r\022\035\n\025scrollingMachineState\030\013 \001(\r"
+  "\022\025\n\rxScrollOrigin\030\014 \001(\r\022\025\n\ryScrollOrigin"
+  "\030\r \001(\r\022$\n\003dot\030\016 \001(\0132\027.Rnes.PpuState.DotS"
+  "tate\032T\n\013SpriteState\022\024\n\014yCoordMinus1\030\001 \001("
+  "\r\022\021\n\ttileIndex\030\002 \001(\r\022\014\n\004attr\030\003 \001(\r\022\016\n\006xC"
+  "oord\030\004 \001(\r\032\377\003\n\010DotState\022\030\n\020bgPatternShif"
+  "tLo\030\001 \001(\r\022\030\n\020bgPatternShiftHi\030\002 \001(\r\022\025\n\rb"
+  "gAttrShiftLo\030\003 \001(\r\022\025\n\rbgAttrShiftHi\030\004 \001("
+  "\r\022\021\n\tnameLatch\030\005 \001(\r\022\021\n\tattrLatch\030\006 \001(\r\022"
+  "\026\n\016patternLatchLo\030\007 \001(\r\022\026\n\016patternLatchH"
+  "i\030\010 \001(\r\022\024\n\014secondaryOam\030\t \001(\014\022\020\n\010oamLatc"
+  "h\030\n \001(\r\022\022\n\nevalSprite\030\013 \001(\r\022\020\n\010evalByte\030"
+  "\014 \001(\r\022\030\n\020secondaryOamAddr\030\r \001(\r\022\020\n\010evalD"
+  "one\030\016 \001(\010\022\023\n\013sprite0Next\030\017 \001(\010\022\027\n\017lineSp"
+  "riteCount\030\020 \001(\r\022\026\n\016lineHasSprite0\030\021 \001(\010\022"
+  "\027\n\017spritePatternLo\030\022 \001(\014\022\027\n\017spritePatter"
+  "nHi\030\023 \001(\014\022\022\n\nspriteAttr\030\024 \001(\014\022\017\n\007spriteX"
+  "\030\025 \001(\014\022\017\n\007a12High\030\026 \001(\010\022\023\n\013a12LowCycle\030\027"
+  " \001(\004\"\273\003\n\010MmcState\022,\n\007mmcNone\030\001 \001(\0132\033.Rne"
+  "s.MmcState.MmcNoneState\022&\n\004mmc1\030\002 \001(\0132\030."
+  "Rnes.MmcState.Mmc1State\022&\n\004mmc3\030\003 \001(\0132\030."
+  "Rnes.MmcState.Mmc3State\032\016\n\014MmcNoneState\032"
+  "k\n\tMmc1State\022\022\n\ncontrolReg\030\001 \001(\r\022\020\n\010chr0"
+  "Bank\030\002 \001(\r\022\020\n\010chr1Bank\030\003 \001(\r\022\017\n\007prgBank\030"
+  "\004 \001(\r\022\025\n\rshiftRegister\030\005 \001(\r\032\263\001\n\tMmc3Sta"
+  "te\022\025\n\rbankSelectReg\030\001 \001(\r\022\021\n\tmirrorReg\030\002"
+  " \001(\r\022\021\n\tprgRamReg\030\003 \001(\r\022\024\n\014bankRegister\030"
+  "\004 \001(\014\022\024\n\014irqReloadReg\030\005 \001(\r\022\025\n\rirqCounte"
+  "rReg\030\006 \001(\r\022\022\n\nirqEnabled\030\007 \001(\010\022\022\n\nirqPen"
+  "ding\030\010 \001(\010\"4\n\017ControllerState\022\017\n\007control"
+  "\030\001 \001(\r\022\020\n\010shiftReg\030\002 \001(\r\"2\n\016CpuMemorySta"
+  "te\022\017\n\007cpuSram\030\001 \001(\014\022\017\n\007prgSram\030\002 \001(\014\"^\n\020"
+  "VideoMemoryState\022\032\n\022patternTableMemory\030\001"
+  " \001(\014\022\027\n\017nameTableMemory\030\002 \001(\014\022\025\n\rpalette"
+  "Memory\030\003 \001(\014\"V\n\010DmaState\022\025\n\rspriteDmaMod"
+  "e\030\001 \001(\010\022\026\n\016spriteDmaCycle\030\002 \001(\r\022\033\n\023sprit"
+  "eDmaSourceAddr\030\003 \001(\r\"\234\002\n\tSaveState\022\020\n\010sa"
+  "veDate\030\001 \001(\t\022\020\n\010gameTime\030\002 \001(\004\022\033\n\003dma\030\007 "
+  "\001(\0132\016.Rnes.DmaState\022\033\n\003cpu\030\010 \001(\0132\016.Rnes."
+  "CpuState\022\033\n\003apu\030\t \001(\0132\016.Rnes.ApuState\022\033\n"
+  "\003ppu\030\n \001(\0132\016.Rnes.PpuState\022)\n\ncontroller"
+  "\030\013 \001(\0132\025.Rnes.ControllerState\022$\n\006cpuMem\030"
+  "\014 \001(\0132\024.Rnes.CpuMemoryState\022&\n\006vidMem\030\r "
+  "\001(\0132\026.Rnes.VideoMemoryState"
+  ;
+static ::_pbi::once_flag descriptor_table_save_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_save_2eproto = {
+    false, false, 3387, descriptor_table_protodef_save_2eproto,
+    "save.proto",
+    &descriptor_table_save_2eproto_once, nullptr, 0, 18,
+    schemas, file_default_instances, TableStruct_save_2eproto::offsets,
+    file_level_metadata_save_2eproto, file_level_enum_descriptors_save_2eproto,
+    file_level_service_descriptors_save_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_save_2eproto_getter() {
+  return &descriptor_table_save_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_save_2eproto(&descriptor_table_save_2eproto);
+namespace Rnes {
+
+// ===================================================================
+
+class CpuState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CpuState>()._impl_._has_bits_);
+  static void set_has_a(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_pc(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_sp(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_cycle(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+CpuState::CpuState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.CpuState)
+}
+CpuState::CpuState(const CpuState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CpuState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.a_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.pc_){}
+    , decltype(_impl_.sp_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.cycle_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.a_, &from._impl_.a_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cycle_) -
+    reinterpret_cast<char*>(&_impl_.a_)) + sizeof(_impl_.cycle_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.CpuState)
+}
+
+inline void CpuState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.a_){0u}
+    , decltype(_impl_.x_){0u}
+    , decltype(_impl_.y_){0u}
+    , decltype(_impl_.pc_){0u}
+    , decltype(_impl_.sp_){0u}
+    , decltype(_impl_.status_){0u}
+    , decltype(_impl_.cycle_){uint64_t{0u}}
+  };
+}
+
+CpuState::~CpuState() {
+  // @@protoc_insertion_point(destructor:Rnes.CpuState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CpuState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CpuState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CpuState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.CpuState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    ::memset(&_impl_.a_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.cycle_) -
+        reinterpret_cast<char*>(&_impl_.a_)) + sizeof(_impl_.cycle_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CpuState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 a = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_a(&has_bits);
+          _impl_.a_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 x = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 y = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 pc = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_pc(&has_bits);
+          _impl_.pc_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sp = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_sp(&has_bits);
+          _impl_.sp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 status = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_status(&has_bits);
+          _impl_.status_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 cycle = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_cycle(&has_bits);
+          _impl_.cycle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CpuState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.CpuState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 a = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_a(), target);
+  }
+
+  // optional uint32 x = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_x(), target);
+  }
+
+  // optional uint32 y = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_y(), target);
+  }
+
+  // optional uint32 pc = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_pc(), target);
+  }
+
+  // optional uint32 sp = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_sp(), target);
+  }
+
+  // optional uint32 status = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_status(), target);
+  }
+
+  // optional uint64 cycle = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_cycle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.CpuState)
+  return target;
+}
+
+size_t CpuState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.CpuState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional uint32 a = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_a());
+    }
+
+    // optional uint32 x = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_x());
+    }
+
+    // optional uint32 y = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_y());
+    }
+
+    // optional uint32 pc = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_pc());
+    }
+
+    // optional uint32 sp = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sp());
+    }
+
+    // optional uint32 status = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_status());
+    }
+
+    // optional uint64 cycle = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cycle());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CpuState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CpuState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CpuState::GetClassData() const { return &_class_data_; }
+
+
+void CpuState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CpuState*>(&to_msg);
+  auto& from = static_cast<const CpuState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.CpuState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.a_ = from._impl_.a_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.x_ = from._impl_.x_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.y_ = from._impl_.y_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.pc_ = from._impl_.pc_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.sp_ = from._impl_.sp_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.cycle_ = from._impl_.cycle_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CpuState::CopyFrom(const CpuState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.CpuState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CpuState::IsInitialized() const {
+  return true;
+}
+
+void CpuState::InternalSwap(CpuState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CpuState, _impl_.cycle_)
+      + sizeof(CpuState::_impl_.cycle_)
+      - PROTOBUF_FIELD_OFFSET(CpuState, _impl_.a_)>(
+          reinterpret_cast<char*>(&_impl_.a_),
+          reinterpret_cast<char*>(&other->_impl_.a_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CpuState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[0]);
+}
+
+// ===================================================================
+
+class PulseState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PulseState>()._impl_._has_bits_);
+  static void set_has_primary(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_lengthcounter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_envelope(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_envelopedivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_resetenvelopeanddivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_resetsweepdivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_sweepdivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_currentsample(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_timerdivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_sequenceroffset(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+};
+
+PulseState::PulseState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.PulseState)
+}
+PulseState::PulseState(const PulseState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PulseState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lengthcounter_){}
+    , decltype(_impl_.envelope_){}
+    , decltype(_impl_.envelopedivider_){}
+    , decltype(_impl_.primary_){}
+    , decltype(_impl_.resetenvelopeanddivider_){}
+    , decltype(_impl_.resetsweepdivider_){}
+    , decltype(_impl_.sweepdivider_){}
+    , decltype(_impl_.currentsample_){}
+    , decltype(_impl_.timerdivider_){}
+    , decltype(_impl_.sequenceroffset_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.lengthcounter_, &from._impl_.lengthcounter_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sequenceroffset_) -
+    reinterpret_cast<char*>(&_impl_.lengthcounter_)) + sizeof(_impl_.sequenceroffset_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.PulseState)
+}
+
+inline void PulseState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lengthcounter_){0u}
+    , decltype(_impl_.envelope_){0u}
+    , decltype(_impl_.envelopedivider_){0u}
+    , decltype(_impl_.primary_){false}
+    , decltype(_impl_.resetenvelopeanddivider_){false}
+    , decltype(_impl_.resetsweepdivider_){false}
+    , decltype(_impl_.sweepdivider_){0u}
+    , decltype(_impl_.currentsample_){0u}
+    , decltype(_impl_.timerdivider_){0u}
+    , decltype(_impl_.sequenceroffset_){0u}
+  };
+}
+
+PulseState::~PulseState() {
+  // @@protoc_insertion_point(destructor:Rnes.PulseState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PulseState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PulseState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PulseState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.PulseState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.lengthcounter_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.currentsample_) -
+        reinterpret_cast<char*>(&_impl_.lengthcounter_)) + sizeof(_impl_.currentsample_));
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.timerdivider_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sequenceroffset_) -
+        reinterpret_cast<char*>(&_impl_.timerdivider_)) + sizeof(_impl_.sequenceroffset_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PulseState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool primary = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_primary(&has_bits);
+          _impl_.primary_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 lengthCounter = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_lengthcounter(&has_bits);
+          _impl_.lengthcounter_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 envelope = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_envelope(&has_bits);
+          _impl_.envelope_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 envelopeDivider = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_envelopedivider(&has_bits);
+          _impl_.envelopedivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool resetEnvelopeAndDivider = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_resetenvelopeanddivider(&has_bits);
+          _impl_.resetenvelopeanddivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool resetSweepDivider = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_resetsweepdivider(&has_bits);
+          _impl_.resetsweepdivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sweepDivider = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_sweepdivider(&has_bits);
+          _impl_.sweepdivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 currentSample = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_currentsample(&has_bits);
+          _impl_.currentsample_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 timerDivider = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_timerdivider(&has_bits);
+          _impl_.timerdivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sequencerOffset = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_sequenceroffset(&has_bits);
+          _impl_.sequenceroffset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PulseState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.PulseState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool primary = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_primary(), target);
+  }
+
+  // optional uint32 lengthCounter = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_lengthcounter(), target);
+  }
+
+  // optional uint32 envelope = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_envelope(), target);
+  }
+
+  // optional uint32 envelopeDivider = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_envelopedivider(), target);
+  }
+
+  // optional bool resetEnvelopeAndDivider = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_resetenvelopeanddivider(), target);
+  }
+
+  // optional bool resetSweepDivider = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_resetsweepdivider(), target);
+  }
+
+  // optional uint32 sweepDivider = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_sweepdivider(), target);
+  }
+
+  // optional uint32 currentSample = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_currentsample(), target);
+  }
+
+  // optional uint32 timerDivider = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_timerdivider(), target);
+  }
+
+  // optional uint32 sequencerOffset = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_sequenceroffset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.PulseState)
+  return target;
+}
+
+size_t PulseState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.PulseState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional uint32 lengthCounter = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_lengthcounter());
+    }
+
+    // optional uint32 envelope = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_envelope());
+    }
+
+    // optional uint32 envelopeDivider = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_envelopedivider());
+    }
+
+    // optional bool primary = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool resetEnvelopeAndDivider = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool resetSweepDivider = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 sweepDivider = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sweepdivider());
+    }
+
+    // optional uint32 currentSample = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_currentsample());
+    }
+
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional uint32 timerDivider = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timerdivider());
+    }
+
+    // optional uint32 sequencerOffset = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sequenceroffset());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PulseState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PulseState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PulseState::GetClassData() const { return &_class_data_; }
+
+
+void PulseState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PulseState*>(&to_msg);
+  auto& from = static_cast<const PulseState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.PulseState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.lengthcounter_ = from._impl_.lengthcounter_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.envelope_ = from._impl_.envelope_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.envelopedivider_ = from._impl_.envelopedivider_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.primary_ = from._impl_.primary_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.resetenvelopeanddivider_ = from._impl_.resetenvelopeanddivider_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.resetsweepdivider_ = from._impl_.resetsweepdivider_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.sweepdivider_ = from._impl_.sweepdivider_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.currentsample_ = from._impl_.currentsample_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.timerdivider_ = from._impl_.timerdivider_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.sequenceroffset_ = from._impl_.sequenceroffset_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PulseState::CopyFrom(const PulseState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.PulseState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PulseState::IsInitialized() const {
+  return true;
+}
+
+void PulseState::InternalSwap(PulseState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PulseState, _impl_.sequenceroffset_)
+      + sizeof(PulseState::_impl_.sequenceroffset_)
+      - PROTOBUF_FIELD_OFFSET(PulseState, _impl_.lengthcounter_)>(
+          reinterpret_cast<char*>(&_impl_.lengthcounter_),
+          reinterpret_cast<char*>(&other->_impl_.lengthcounter_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PulseState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[1]);
+}
+
+// ===================================================================
+
+class TriangleState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TriangleState>()._impl_._has_bits_);
+  static void set_has_lengthcounter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_linearcounterhalt(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_linearcounter(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_currentsample(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_timerdivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_sequenceroffset(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+TriangleState::TriangleState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.TriangleState)
+}
+TriangleState::TriangleState(const TriangleState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TriangleState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lengthcounter_){}
+    , decltype(_impl_.linearcounterhalt_){}
+    , decltype(_impl_.linearcounter_){}
+    , decltype(_impl_.currentsample_){}
+    , decltype(_impl_.timerdivider_){}
+    , decltype(_impl_.sequenceroffset_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.lengthcounter_, &from._impl_.lengthcounter_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sequenceroffset_) -
+    reinterpret_cast<char*>(&_impl_.lengthcounter_)) + sizeof(_impl_.sequenceroffset_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.TriangleState)
+}
+
+inline void TriangleState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lengthcounter_){0u}
+    , decltype(_impl_.linearcounterhalt_){false}
+    , decltype(_impl_.linearcounter_){0u}
+    , decltype(_impl_.currentsample_){0u}
+    , decltype(_impl_.timerdivider_){0u}
+    , decltype(_impl_.sequenceroffset_){0u}
+  };
+}
+
+TriangleState::~TriangleState() {
+  // @@protoc_insertion_point(destructor:Rnes.TriangleState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TriangleState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TriangleState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TriangleState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.TriangleState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    ::memset(&_impl_.lengthcounter_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sequenceroffset_) -
+        reinterpret_cast<char*>(&_impl_.lengthcounter_)) + sizeof(_impl_.sequenceroffset_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TriangleState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 lengthCounter = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_lengthcounter(&has_bits);
+          _impl_.lengthcounter_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool linearCounterHalt = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_linearcounterhalt(&has_bits);
+          _impl_.linearcounterhalt_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 linearCounter = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_linearcounter(&has_bits);
+          _impl_.linearcounter_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 currentSample = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_currentsample(&has_bits);
+          _impl_.currentsample_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 timerDivider = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_timerdivider(&has_bits);
+          _impl_.timerdivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sequencerOffset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_sequenceroffset(&has_bits);
+          _impl_.sequenceroffset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TriangleState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.TriangleState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 lengthCounter = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_lengthcounter(), target);
+  }
+
+  // optional bool linearCounterHalt = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_linearcounterhalt(), target);
+  }
+
+  // optional uint32 linearCounter = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_linearcounter(), target);
+  }
+
+  // optional uint32 currentSample = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_currentsample(), target);
+  }
+
+  // optional uint32 timerDivider = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_timerdivider(), target);
+  }
+
+  // optional uint32 sequencerOffset = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_sequenceroffset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.TriangleState)
+  return target;
+}
+
+size_t TriangleState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.TriangleState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional uint32 lengthCounter = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_lengthcounter());
+    }
+
+    // optional bool linearCounterHalt = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 linearCounter = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_linearcounter());
+    }
+
+    // optional uint32 currentSample = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_currentsample());
+    }
+
+    // optional uint32 timerDivider = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timerdivider());
+    }
+
+    // optional uint32 sequencerOffset = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sequenceroffset());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TriangleState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TriangleState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TriangleState::GetClassData() const { return &_class_data_; }
+
+
+void TriangleState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TriangleState*>(&to_msg);
+  auto& from = static_cast<const TriangleState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.TriangleState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.lengthcounter_ = from._impl_.lengthcounter_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.linearcounterhalt_ = from._impl_.linearcounterhalt_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.linearcounter_ = from._impl_.linearcounter_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.currentsample_ = from._impl_.currentsample_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.timerdivider_ = from._impl_.timerdivider_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.sequenceroffset_ = from._impl_.sequenceroffset_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TriangleState::CopyFrom(const TriangleState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.TriangleState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TriangleState::IsInitialized() const {
+  return true;
+}
+
+void TriangleState::InternalSwap(TriangleState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TriangleState, _impl_.sequenceroffset_)
+      + sizeof(TriangleState::_impl_.sequenceroffset_)
+      - PROTOBUF_FIELD_OFFSET(TriangleState, _impl_.lengthcounter_)>(
+          reinterpret_cast<char*>(&_impl_.lengthcounter_),
+          reinterpret_cast<char*>(&other->_impl_.lengthcounter_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TriangleState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[2]);
+}
+
+// ===================================================================
+
+class NoiseState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NoiseState>()._impl_._has_bits_);
+  static void set_has_lengthcounter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_shiftregister(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_envelope(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_envelopedivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_resetenvelopeanddivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_currentsample(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_timerdivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+NoiseState::NoiseState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.NoiseState)
+}
+NoiseState::NoiseState(const NoiseState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NoiseState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lengthcounter_){}
+    , decltype(_impl_.shiftregister_){}
+    , decltype(_impl_.envelope_){}
+    , decltype(_impl_.envelopedivider_){}
+    , decltype(_impl_.resetenvelopeanddivider_){}
+    , decltype(_impl_.currentsample_){}
+    , decltype(_impl_.timerdivider_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.lengthcounter_, &from._impl_.lengthcounter_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timerdivider_) -
+    reinterpret_cast<char*>(&_impl_.lengthcounter_)) + sizeof(_impl_.timerdivider_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.NoiseState)
+}
+
+inline void NoiseState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lengthcounter_){0u}
+    , decltype(_impl_.shiftregister_){0u}
+    , decltype(_impl_.envelope_){0u}
+    , decltype(_impl_.envelopedivider_){0u}
+    , decltype(_impl_.resetenvelopeanddivider_){false}
+    , decltype(_impl_.currentsample_){0u}
+    , decltype(_impl_.timerdivider_){0u}
+  };
+}
+
+NoiseState::~NoiseState() {
+  // @@protoc_insertion_point(destructor:Rnes.NoiseState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NoiseState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void NoiseState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NoiseState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.NoiseState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    ::memset(&_impl_.lengthcounter_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.timerdivider_) -
+        reinterpret_cast<char*>(&_impl_.lengthcounter_)) + sizeof(_impl_.timerdivider_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NoiseState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 lengthCounter = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_lengthcounter(&has_bits);
+          _impl_.lengthcounter_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 shiftRegister = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_shiftregister(&has_bits);
+          _impl_.shiftregister_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 envelope = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_envelope(&has_bits);
+          _impl_.envelope_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 envelopeDivider = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_envelopedivider(&has_bits);
+          _impl_.envelopedivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool resetEnvelopeAndDivider = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_resetenvelopeanddivider(&has_bits);
+          _impl_.resetenvelopeanddivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 currentSample = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_currentsample(&has_bits);
+          _impl_.currentsample_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 timerDivider = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_timerdivider(&has_bits);
+          _impl_.timerdivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NoiseState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.NoiseState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 lengthCounter = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_lengthcounter(), target);
+  }
+
+  // optional uint32 shiftRegister = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_shiftregister(), target);
+  }
+
+  // optional uint32 envelope = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_envelope(), target);
+  }
+
+  // optional uint32 envelopeDivider = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_envelopedivider(), target);
+  }
+
+  // optional bool resetEnvelopeAndDivider = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_resetenvelopeanddivider(), target);
+  }
+
+  // optional uint32 currentSample = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_currentsample(), target);
+  }
+
+  // optional uint32 timerDivider = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_timerdivider(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.NoiseState)
+  return target;
+}
+
+size_t NoiseState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.NoiseState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional uint32 lengthCounter = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_lengthcounter());
+    }
+
+    // optional uint32 shiftRegister = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shiftregister());
+    }
+
+    // optional uint32 envelope = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_envelope());
+    }
+
+    // optional uint32 envelopeDivider = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_envelopedivider());
+    }
+
+    // optional bool resetEnvelopeAndDivider = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 currentSample = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_currentsample());
+    }
+
+    // optional uint32 timerDivider = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timerdivider());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NoiseState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NoiseState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NoiseState::GetClassData() const { return &_class_data_; }
+
+
+void NoiseState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NoiseState*>(&to_msg);
+  auto& from = static_cast<const NoiseState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.NoiseState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.lengthcounter_ = from._impl_.lengthcounter_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shiftregister_ = from._impl_.shiftregister_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.envelope_ = from._impl_.envelope_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.envelopedivider_ = from._impl_.envelopedivider_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.resetenvelopeanddivider_ = from._impl_.resetenvelopeanddivider_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.currentsample_ = from._impl_.currentsample_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.timerdivider_ = from._impl_.timerdivider_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NoiseState::CopyFrom(const NoiseState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.NoiseState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NoiseState::IsInitialized() const {
+  return true;
+}
+
+void NoiseState::InternalSwap(NoiseState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NoiseState, _impl_.timerdivider_)
+      + sizeof(NoiseState::_impl_.timerdivider_)
+      - PROTOBUF_FIELD_OFFSET(NoiseState, _impl_.lengthcounter_)>(
+          reinterpret_cast<char*>(&_impl_.lengthcounter_),
+          reinterpret_cast<char*>(&other->_impl_.lengthcounter_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NoiseState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[3]);
+}
+
+// ===================================================================
+
+class DmcState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DmcState>()._impl_._has_bits_);
+  static void set_has_outputlevel(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_shiftregister(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_bitsremaining(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_silence(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_samplebuffer(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_samplebufferfull(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_currentaddr(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_bytesremaining(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_timercounter(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+DmcState::DmcState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.DmcState)
+}
+DmcState::DmcState(const DmcState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DmcState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.outputlevel_){}
+    , decltype(_impl_.shiftregister_){}
+    , decltype(_impl_.samplebuffer_){}
+    , decltype(_impl_.samplebufferfull_){}
+    , decltype(_impl_.currentaddr_){}
+    , decltype(_impl_.bytesremaining_){}
+    , decltype(_impl_.timercounter_){}
+    , decltype(_impl_.bitsremaining_){}
+    , decltype(_impl_.silence_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.outputlevel_, &from._impl_.outputlevel_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.silence_) -
+    reinterpret_cast<char*>(&_impl_.outputlevel_)) + sizeof(_impl_.silence_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.DmcState)
+}
+
+inline void DmcState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.outputlevel_){0u}
+    , decltype(_impl_.shiftregister_){0u}
+    , decltype(_impl_.samplebuffer_){0u}
+    , decltype(_impl_.samplebufferfull_){false}
+    , decltype(_impl_.currentaddr_){0u}
+    , decltype(_impl_.bytesremaining_){0u}
+    , decltype(_impl_.timercounter_){0u}
+    , decltype(_impl_.bitsremaining_){8u}
+    , decltype(_impl_.silence_){true}
+  };
+}
+
+DmcState::~DmcState() {
+  // @@protoc_insertion_point(destructor:Rnes.DmcState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DmcState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void DmcState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DmcState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.DmcState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.outputlevel_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.timercounter_) -
+        reinterpret_cast<char*>(&_impl_.outputlevel_)) + sizeof(_impl_.timercounter_));
+    _impl_.bitsremaining_ = 8u;
+  }
+  _impl_.silence_ = true;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DmcState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 outputLevel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_outputlevel(&has_bits);
+          _impl_.outputlevel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 shiftRegister = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_shiftregister(&has_bits);
+          _impl_.shiftregister_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bitsRemaining = 3 [default = 8];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_bitsremaining(&has_bits);
+          _impl_.bitsremaining_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool silence = 4 [default = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_silence(&has_bits);
+          _impl_.silence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sampleBuffer = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_samplebuffer(&has_bits);
+          _impl_.samplebuffer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool sampleBufferFull = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_samplebufferfull(&has_bits);
+          _impl_.samplebufferfull_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 currentAddr = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_currentaddr(&has_bits);
+          _impl_.currentaddr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bytesRemaining = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_bytesremaining(&has_bits);
+          _impl_.bytesremaining_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 timerCounter = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_timercounter(&has_bits);
+          _impl_.timercounter_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DmcState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.DmcState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 outputLevel = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_outputlevel(), target);
+  }
+
+  // optional uint32 shiftRegister = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_shiftregister(), target);
+  }
+
+  // optional uint32 bitsRemaining = 3 [default = 8];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_bitsremaining(), target);
+  }
+
+  // optional bool silence = 4 [default = true];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_silence(), target);
+  }
+
+  // optional uint32 sampleBuffer = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_samplebuffer(), target);
+  }
+
+  // optional bool sampleBufferFull = 6;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_samplebufferfull(), target);
+  }
+
+  // optional uint32 currentAddr = 7;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_currentaddr(), target);
+  }
+
+  // optional uint32 bytesRemaining = 8;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_bytesremaining(), target);
+  }
+
+  // optional uint32 timerCounter = 9;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_timercounter(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.DmcState)
+  return target;
+}
+
+size_t DmcState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.DmcState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional uint32 outputLevel = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_outputlevel());
+    }
+
+    // optional uint32 shiftRegister = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shiftregister());
+    }
+
+    // optional uint32 sampleBuffer = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_samplebuffer());
+    }
+
+    // optional bool sampleBufferFull = 6;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 currentAddr = 7;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_currentaddr());
+    }
+
+    // optional uint32 bytesRemaining = 8;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bytesremaining());
+    }
+
+    // optional uint32 timerCounter = 9;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timercounter());
+    }
+
+    // optional uint32 bitsRemaining = 3 [default = 8];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bitsremaining());
+    }
+
+  }
+  // optional bool silence = 4 [default = true];
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DmcState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DmcState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DmcState::GetClassData() const { return &_class_data_; }
+
+
+void DmcState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DmcState*>(&to_msg);
+  auto& from = static_cast<const DmcState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.DmcState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.outputlevel_ = from._impl_.outputlevel_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shiftregister_ = from._impl_.shiftregister_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.samplebuffer_ = from._impl_.samplebuffer_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.samplebufferfull_ = from._impl_.samplebufferfull_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.currentaddr_ = from._impl_.currentaddr_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.bytesremaining_ = from._impl_.bytesremaining_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.timercounter_ = from._impl_.timercounter_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.bitsremaining_ = from._impl_.bitsremaining_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_silence(from._internal_silence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DmcState::CopyFrom(const DmcState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.DmcState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DmcState::IsInitialized() const {
+  return true;
+}
+
+void DmcState::InternalSwap(DmcState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DmcState, _impl_.timercounter_)
+      + sizeof(DmcState::_impl_.timercounter_)
+      - PROTOBUF_FIELD_OFFSET(DmcState, _impl_.outputlevel_)>(
+          reinterpret_cast<char*>(&_impl_.outputlevel_),
+          reinterpret_cast<char*>(&other->_impl_.outputlevel_));
+  swap(_impl_.bitsremaining_, other->_impl_.bitsremaining_);
+  swap(_impl_.silence_, other->_impl_.silence_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DmcState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[4]);
+}
+
+// ===================================================================
+
+class ApuState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ApuState>()._impl_._has_bits_);
+  static void set_has_samplerate(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_fourframecount(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_fiveframecount(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_framedivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_step(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_halftimerdivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_samplerdivider(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_clkspersample(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_currentsampleclk(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_nextsamplecountdown(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_audioframecycle(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_sampleclock(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static const ::Rnes::PulseState& pulsea(const ApuState* msg);
+  static void set_has_pulsea(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Rnes::PulseState& pulseb(const ApuState* msg);
+  static void set_has_pulseb(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::Rnes::TriangleState& triangle(const ApuState* msg);
+  static void set_has_triangle(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::Rnes::NoiseState& noise(const ApuState* msg);
+  static void set_has_noise(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::Rnes::DmcState& dmc(const ApuState* msg);
+  static void set_has_dmc(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::Rnes::PulseState&
+ApuState::_Internal::pulsea(const ApuState* msg) {
+  return *msg->_impl_.pulsea_;
+}
+const ::Rnes::PulseState&
+ApuState::_Internal::pulseb(const ApuState* msg) {
+  return *msg->_impl_.pulseb_;
+}
+const ::Rnes::TriangleState&
+ApuState::_Internal::triangle(const ApuState* msg) {
+  return *msg->_impl_.triangle_;
+}
+const ::Rnes::NoiseState&
+ApuState::_Internal::noise(const ApuState* msg) {
+  return *msg->_impl_.noise_;
+}
+const ::Rnes::DmcState&
+ApuState::_Internal::dmc(const ApuState* msg) {
+  return *msg->_impl_.dmc_;
+}
+ApuState::ApuState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.ApuState)
+}
+ApuState::ApuState(const ApuState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ApuState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reg_){from._impl_.reg_}
+    , decltype(_impl_.pulsea_){nullptr}
+    , decltype(_impl_.pulseb_){nullptr}
+    , decltype(_impl_.triangle_){nullptr}
+    , decltype(_impl_.noise_){nullptr}
+    , decltype(_impl_.dmc_){nullptr}
+    , decltype(_impl_.samplerate_){}
+    , decltype(_impl_.fourframecount_){}
+    , decltype(_impl_.fiveframecount_){}
+    , decltype(_impl_.framedivider_){}
+    , decltype(_impl_.step_){}
+    , decltype(_impl_.halftimerdivider_){}
+    , decltype(_impl_.samplerdivider_){}
+    , decltype(_impl_.clkspersample_){}
+    , decltype(_impl_.currentsampleclk_){}
+    , decltype(_impl_.nextsamplecountdown_){}
+    , decltype(_impl_.sampleclock_){}
+    , decltype(_impl_.audioframecycle_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_pulsea()) {
+    _this->_impl_.pulsea_ = new ::Rnes::PulseState(*from._impl_.pulsea_);
+  }
+  if (from._internal_has_pulseb()) {
+    _this->_impl_.pulseb_ = new ::Rnes::PulseState(*from._impl_.pulseb_);
+  }
+  if (from._internal_has_triangle()) {
+    _this->_impl_.triangle_ = new ::Rnes::TriangleState(*from._impl_.triangle_);
+  }
+  if (from._internal_has_noise()) {
+    _this->_impl_.noise_ = new ::Rnes::NoiseState(*from._impl_.noise_);
+  }
+  if (from._internal_has_dmc()) {
+    _this->_impl_.dmc_ = new ::Rnes::DmcState(*from._impl_.dmc_);
+  }
+  ::memcpy(&_impl_.samplerate_, &from._impl_.samplerate_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.audioframecycle_) -
+    reinterpret_cast<char*>(&_impl_.samplerate_)) + sizeof(_impl_.audioframecycle_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.ApuState)
+}
+
+inline void ApuState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reg_){arena}
+    , decltype(_impl_.pulsea_){nullptr}
+    , decltype(_impl_.pulseb_){nullptr}
+    , decltype(_impl_.triangle_){nullptr}
+    , decltype(_impl_.noise_){nullptr}
+    , decltype(_impl_.dmc_){nullptr}
+    , decltype(_impl_.samplerate_){0u}
+    , decltype(_impl_.fourframecount_){0u}
+    , decltype(_impl_.fiveframecount_){0u}
+    , decltype(_impl_.framedivider_){0u}
+    , decltype(_impl_.step_){0u}
+    , decltype(_impl_.halftimerdivider_){0u}
+    , decltype(_impl_.samplerdivider_){0u}
+    , decltype(_impl_.clkspersample_){0}
+    , decltype(_impl_.currentsampleclk_){0}
+    , decltype(_impl_.nextsamplecountdown_){0u}
+    , decltype(_impl_.sampleclock_){uint64_t{0u}}
+    , decltype(_impl_.audioframecycle_){0u}
+  };
+}
+
+ApuState::~ApuState() {
+  // @@protoc_insertion_point(destructor:Rnes.ApuState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ApuState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reg_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.pulsea_;
+  if (this != internal_default_instance()) delete _impl_.pulseb_;
+  if (this != internal_default_instance()) delete _impl_.triangle_;
+  if (this != internal_default_instance()) delete _impl_.noise_;
+  if (this != internal_default_instance()) delete _impl_.dmc_;
+}
+
+void ApuState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ApuState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.ApuState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.reg_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.pulsea_ != nullptr);
+      _impl_.pulsea_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.pulseb_ != nullptr);
+      _impl_.pulseb_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.triangle_ != nullptr);
+      _impl_.triangle_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.noise_ != nullptr);
+      _impl_.noise_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.dmc_ != nullptr);
+      _impl_.dmc_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000e0u) {
+    ::memset(&_impl_.samplerate_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.fiveframecount_) -
+        reinterpret_cast<char*>(&_impl_.samplerate_)) + sizeof(_impl_.fiveframecount_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.framedivider_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sampleclock_) -
+        reinterpret_cast<char*>(&_impl_.framedivider_)) + sizeof(_impl_.sampleclock_));
+  }
+  _impl_.audioframecycle_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ApuState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 reg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_reg(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_reg(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 sampleRate = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_samplerate(&has_bits);
+          _impl_.samplerate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 fourFrameCount = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_fourframecount(&has_bits);
+          _impl_.fourframecount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 fiveFrameCount = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_fiveframecount(&has_bits);
+          _impl_.fiveframecount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 frameDivider = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_framedivider(&has_bits);
+          _impl_.framedivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 step = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_step(&has_bits);
+          _impl_.step_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 halfTimerDivider = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_halftimerdivider(&has_bits);
+          _impl_.halftimerdivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 samplerDivider = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_samplerdivider(&has_bits);
+          _impl_.samplerdivider_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float clksPerSample = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_clkspersample(&has_bits);
+          _impl_.clkspersample_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float currentSampleClk = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _Internal::set_has_currentsampleclk(&has_bits);
+          _impl_.currentsampleclk_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 nextSampleCountdown = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_nextsamplecountdown(&has_bits);
+          _impl_.nextsamplecountdown_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 audioFrameCycle = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_audioframecycle(&has_bits);
+          _impl_.audioframecycle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 sampleClock = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_sampleclock(&has_bits);
+          _impl_.sampleclock_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.PulseState pulseA = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pulsea(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.PulseState pulseB = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pulseb(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.TriangleState triangle = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr = ctx->ParseMessage(_internal_mutable_triangle(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.NoiseState noise = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 186)) {
+          ptr = ctx->ParseMessage(_internal_mutable_noise(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.DmcState dmc = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          ptr = ctx->ParseMessage(_internal_mutable_dmc(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ApuState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.ApuState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 reg = 1;
+  for (int i = 0, n = this->_internal_reg_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_reg(i), target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 sampleRate = 2;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_samplerate(), target);
+  }
+
+  // optional uint32 fourFrameCount = 3;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_fourframecount(), target);
+  }
+
+  // optional uint32 fiveFrameCount = 4;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_fiveframecount(), target);
+  }
+
+  // optional uint32 frameDivider = 5;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_framedivider(), target);
+  }
+
+  // optional uint32 step = 6;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_step(), target);
+  }
+
+  // optional uint32 halfTimerDivider = 7;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_halftimerdivider(), target);
+  }
+
+  // optional uint32 samplerDivider = 8;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_samplerdivider(), target);
+  }
+
+  // optional float clksPerSample = 9;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_clkspersample(), target);
+  }
+
+  // optional float currentSampleClk = 10;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(10, this->_internal_currentsampleclk(), target);
+  }
+
+  // optional uint32 nextSampleCountdown = 11;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_nextsamplecountdown(), target);
+  }
+
+  // optional uint32 audioFrameCycle = 12;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_audioframecycle(), target);
+  }
+
+  // optional uint64 sampleClock = 13;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(13, this->_internal_sampleclock(), target);
+  }
+
+  // optional .Rnes.PulseState pulseA = 20;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(20, _Internal::pulsea(this),
+        _Internal::pulsea(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.PulseState pulseB = 21;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(21, _Internal::pulseb(this),
+        _Internal::pulseb(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.TriangleState triangle = 22;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(22, _Internal::triangle(this),
+        _Internal::triangle(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.NoiseState noise = 23;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(23, _Internal::noise(this),
+        _Internal::noise(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.DmcState dmc = 24;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(24, _Internal::dmc(this),
+        _Internal::dmc(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.ApuState)
+  return target;
+}
+
+size_t ApuState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.ApuState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 reg = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.reg_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_reg_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .Rnes.PulseState pulseA = 20;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pulsea_);
+    }
+
+    // optional .Rnes.PulseState pulseB = 21;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pulseb_);
+    }
+
+    // optional .Rnes.TriangleState triangle = 22;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.triangle_);
+    }
+
+    // optional .Rnes.NoiseState noise = 23;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.noise_);
+    }
+
+    // optional .Rnes.DmcState dmc = 24;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.dmc_);
+    }
+
+    // optional uint32 sampleRate = 2;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_samplerate());
+    }
+
+    // optional uint32 fourFrameCount = 3;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_fourframecount());
+    }
+
+    // optional uint32 fiveFrameCount = 4;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_fiveframecount());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional uint32 frameDivider = 5;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_framedivider());
+    }
+
+    // optional uint32 step = 6;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step());
+    }
+
+    // optional uint32 halfTimerDivider = 7;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_halftimerdivider());
+    }
+
+    // optional uint32 samplerDivider = 8;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_samplerdivider());
+    }
+
+    // optional float clksPerSample = 9;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional float currentSampleClk = 10;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 4;
+    }
+
+    // optional uint32 nextSampleCountdown = 11;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_nextsamplecountdown());
+    }
+
+    // optional uint64 sampleClock = 13;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sampleclock());
+    }
+
+  }
+  // optional uint32 audioFrameCycle = 12;
+  if (cached_has_bits & 0x00010000u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_audioframecycle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ApuState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ApuState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ApuState::GetClassData() const { return &_class_data_; }
+
+
+void ApuState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ApuState*>(&to_msg);
+  auto& from = static_cast<const ApuState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.ApuState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.reg_.MergeFrom(from._impl_.reg_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_pulsea()->::Rnes::PulseState::MergeFrom(
+          from._internal_pulsea());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_pulseb()->::Rnes::PulseState::MergeFrom(
+          from._internal_pulseb());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_triangle()->::Rnes::TriangleState::MergeFrom(
+          from._internal_triangle());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_noise()->::Rnes::NoiseState::MergeFrom(
+          from._internal_noise());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_dmc()->::Rnes::DmcState::MergeFrom(
+          from._internal_dmc());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.samplerate_ = from._impl_.samplerate_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.fourframecount_ = from._impl_.fourframecount_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.fiveframecount_ = from._impl_.fiveframecount_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.framedivider_ = from._impl_.framedivider_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.step_ = from._impl_.step_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.halftimerdivider_ = from._impl_.halftimerdivider_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.samplerdivider_ = from._impl_.samplerdivider_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.clkspersample_ = from._impl_.clkspersample_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.currentsampleclk_ = from._impl_.currentsampleclk_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.nextsamplecountdown_ = from._impl_.nextsamplecountdown_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.sampleclock_ = from._impl_.sampleclock_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00010000u) {
+    _this->_internal_set_audioframecycle(from._internal_audioframecycle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ApuState::CopyFrom(const ApuState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.ApuState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ApuState::IsInitialized() const {
+  return true;
+}
+
+void ApuState::InternalSwap(ApuState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.reg_.InternalSwap(&other->_impl_.reg_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ApuState, _impl_.audioframecycle_)
+      + sizeof(ApuState::_impl_.audioframecycle_)
+      - PROTOBUF_FIELD_OFFSET(ApuState, _impl_.pulsea_)>(
+          reinterpret_cast<char*>(&_impl_.pulsea_),
+          reinterpret_cast<char*>(&other->_impl_.pulsea_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ApuState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[5]);
+}
+
+// ===================================================================
+
+class PpuState_SpriteState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PpuState_SpriteState>()._impl_._has_bits_);
+  static void set_has_ycoordminus1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_tileindex(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_attr(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_xcoord(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+PpuState_SpriteState::PpuState_SpriteState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.PpuState.SpriteState)
+}
+PpuState_SpriteState::PpuState_SpriteState(const PpuState_SpriteState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PpuState_SpriteState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ycoordminus1_){}
+    , decltype(_impl_.tileindex_){}
+    , decltype(_impl_.attr_){}
+    , decltype(_impl_.xcoord_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ycoordminus1_, &from._impl_.ycoordminus1_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.xcoord_) -
+    reinterpret_cast<char*>(&_impl_.ycoordminus1_)) + sizeof(_impl_.xcoord_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.PpuState.SpriteState)
+}
+
+inline void PpuState_SpriteState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ycoordminus1_){0u}
+    , decltype(_impl_.tileindex_){0u}
+    , decltype(_impl_.attr_){0u}
+    , decltype(_impl_.xcoord_){0u}
+  };
+}
+
+PpuState_SpriteState::~PpuState_SpriteState() {
+  // @@protoc_insertion_point(destructor:Rnes.PpuState.SpriteState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PpuState_SpriteState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PpuState_SpriteState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PpuState_SpriteState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.PpuState.SpriteState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.ycoordminus1_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.xcoord_) -
+        reinterpret_cast<char*>(&_impl_.ycoordminus1_)) + sizeof(_impl_.xcoord_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PpuState_SpriteState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 yCoordMinus1 = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_ycoordminus1(&has_bits);
+          _impl_.ycoordminus1_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 tileIndex = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_tileindex(&has_bits);
+          _impl_.tileindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 attr = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_attr(&has_bits);
+          _impl_.attr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 xCoord = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_xcoord(&has_bits);
+          _impl_.xcoord_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PpuState_SpriteState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.PpuState.SpriteState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 yCoordMinus1 = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_ycoordminus1(), target);
+  }
+
+  // optional uint32 tileIndex = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_tileindex(), target);
+  }
+
+  // optional uint32 attr = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_attr(), target);
+  }
+
+  // optional uint32 xCoord = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_xcoord(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.PpuState.SpriteState)
+  return target;
+}
+
+size_t PpuState_SpriteState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.PpuState.SpriteState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional uint32 yCoordMinus1 = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ycoordminus1());
+    }
+
+    // optional uint32 tileIndex = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tileindex());
+    }
+
+    // optional uint32 attr = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_attr());
+    }
+
+    // optional uint32 xCoord = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_xcoord());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PpuState_SpriteState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PpuState_SpriteState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PpuState_SpriteState::GetClassData() const { return &_class_data_; }
+
+
+void PpuState_SpriteState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PpuState_SpriteState*>(&to_msg);
+  auto& from = static_cast<const PpuState_SpriteState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.PpuState.SpriteState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.ycoordminus1_ = from._impl_.ycoordminus1_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tileindex_ = from._impl_.tileindex_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.attr_ = from._impl_.attr_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.xcoord_ = from._impl_.xcoord_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PpuState_SpriteState::CopyFrom(const PpuState_SpriteState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.PpuState.SpriteState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PpuState_SpriteState::IsInitialized() const {
+  return true;
+}
+
+void PpuState_SpriteState::InternalSwap(PpuState_SpriteState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PpuState_SpriteState, _impl_.xcoord_)
+      + sizeof(PpuState_SpriteState::_impl_.xcoord_)
+      - PROTOBUF_FIELD_OFFSET(PpuState_SpriteState, _impl_.ycoordminus1_)>(
+          reinterpret_cast<char*>(&_impl_.ycoordminus1_),
+          reinterpret_cast<char*>(&other->_impl_.ycoordminus1_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PpuState_SpriteState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[6]);
+}
+
+// ===================================================================
+
+class PpuState_DotState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PpuState_DotState>()._impl_._has_bits_);
+  static void set_has_bgpatternshiftlo(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_bgpatternshifthi(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_bgattrshiftlo(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_bgattrshifthi(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_namelatch(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_attrlatch(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_patternlatchlo(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_patternlatchhi(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_secondaryoam(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_oamlatch(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_evalsprite(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_evalbyte(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_secondaryoamaddr(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static void set_has_evaldone(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static void set_has_sprite0next(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+  static void set_has_linespritecount(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static void set_has_linehassprite0(HasBits* has_bits) {
+    (*has_bits)[0] |= 1048576u;
+  }
+  static void set_has_spritepatternlo(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_spritepatternhi(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_spriteattr(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_spritex(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_a12high(HasBits* has_bits) {
+    (*has_bits)[0] |= 2097152u;
+  }
+  static void set_has_a12lowcycle(HasBits* has_bits) {
+    (*has_bits)[0] |= 4194304u;
+  }
+};
+
+PpuState_DotState::PpuState_DotState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.PpuState.DotState)
+}
+PpuState_DotState::PpuState_DotState(const PpuState_DotState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PpuState_DotState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.secondaryoam_){}
+    , decltype(_impl_.spritepatternlo_){}
+    , decltype(_impl_.spritepatternhi_){}
+    , decltype(_impl_.spriteattr_){}
+    , decltype(_impl_.spritex_){}
+    , decltype(_impl_.bgpatternshiftlo_){}
+    , decltype(_impl_.bgpatternshifthi_){}
+    , decltype(_impl_.bgattrshiftlo_){}
+    , decltype(_impl_.bgattrshifthi_){}
+    , decltype(_impl_.namelatch_){}
+    , decltype(_impl_.attrlatch_){}
+    , decltype(_impl_.patternlatchlo_){}
+    , decltype(_impl_.patternlatchhi_){}
+    , decltype(_impl_.oamlatch_){}
+    , decltype(_impl_.evalsprite_){}
+    , decltype(_impl_.evalbyte_){}
+    , decltype(_impl_.secondaryoamaddr_){}
+    , decltype(_impl_.linespritecount_){}
+    , decltype(_impl_.evaldone_){}
+    , decltype(_impl_.sprite0next_){}
+    , decltype(_impl_.linehassprite0_){}
+    , decltype(_impl_.a12high_){}
+    , decltype(_impl_.a12lowcycle_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.secondaryoam_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.secondaryoam_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_secondaryoam()) {
+    _this->_impl_.secondaryoam_.Set(from._internal_secondaryoam(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.spritepatternlo_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.spritepatternlo_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_spritepatternlo()) {
+    _this->_impl_.spritepatternlo_.Set(from._internal_spritepatternlo(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.spritepatternhi_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.spritepatternhi_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_spritepatternhi()) {
+    _this->_impl_.spritepatternhi_.Set(from._internal_spritepatternhi(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.spriteattr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.spriteattr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_spriteattr()) {
+    _this->_impl_.spriteattr_.Set(from._internal_spriteattr(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.spritex_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.spritex_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_spritex()) {
+    _this->_impl_.spritex_.Set(from._internal_spritex(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.bgpatternshiftlo_, &from._impl_.bgpatternshiftlo_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.a12lowcycle_) -
+    reinterpret_cast<char*>(&_impl_.bgpatternshiftlo_)) + sizeof(_impl_.a12lowcycle_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.PpuState.DotState)
+}
+
+inline void PpuState_DotState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.secondaryoam_){}
+    , decltype(_impl_.spritepatternlo_){}
+    , decltype(_impl_.spritepatternhi_){}
+    , decltype(_impl_.spriteattr_){}
+    , decltype(_impl_.spritex_){}
+    , decltype(_impl_.bgpatternshiftlo_){0u}
+    , decltype(_impl_.bgpatternshifthi_){0u}
+    , decltype(_impl_.bgattrshiftlo_){0u}
+    , decltype(_impl_.bgattrshifthi_){0u}
+    , decltype(_impl_.namelatch_){0u}
+    , decltype(_impl_.attrlatch_){0u}
+    , decltype(_impl_.patternlatchlo_){0u}
+    , decltype(_impl_.patternlatchhi_){0u}
+    , decltype(_impl_.oamlatch_){0u}
+    , decltype(_impl_.evalsprite_){0u}
+    , decltype(_impl_.evalbyte_){0u}
+    , decltype(_impl_.secondaryoamaddr_){0u}
+    , decltype(_impl_.linespritecount_){0u}
+    , decltype(_impl_.evaldone_){false}
+    , decltype(_impl_.sprite0next_){false}
+    , decltype(_impl_.linehassprite0_){false}
+    , decltype(_impl_.a12high_){false}
+    , decltype(_impl_.a12lowcycle_){uint64_t{0u}}
+  };
+  _impl_.secondaryoam_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.secondaryoam_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.spritepatternlo_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.spritepatternlo_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.spritepatternhi_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.spritepatternhi_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.spriteattr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.spriteattr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.spritex_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.spritex_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PpuState_DotState::~PpuState_DotState() {
+  // @@protoc_insertion_point(destructor:Rnes.PpuState.DotState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PpuState_DotState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.secondaryoam_.Destroy();
+  _impl_.spritepatternlo_.Destroy();
+  _impl_.spritepatternhi_.Destroy();
+  _impl_.spriteattr_.Destroy();
+  _impl_.spritex_.Destroy();
+}
+
+void PpuState_DotState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PpuState_DotState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.PpuState.DotState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.secondaryoam_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.spritepatternlo_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.spritepatternhi_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.spriteattr_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.spritex_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000e0u) {
+    ::memset(&_impl_.bgpatternshiftlo_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bgattrshiftlo_) -
+        reinterpret_cast<char*>(&_impl_.bgpatternshiftlo_)) + sizeof(_impl_.bgattrshiftlo_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.bgattrshifthi_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.evalbyte_) -
+        reinterpret_cast<char*>(&_impl_.bgattrshifthi_)) + sizeof(_impl_.evalbyte_));
+  }
+  if (cached_has_bits & 0x007f0000u) {
+    ::memset(&_impl_.secondaryoamaddr_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.a12lowcycle_) -
+        reinterpret_cast<char*>(&_impl_.secondaryoamaddr_)) + sizeof(_impl_.a12lowcycle_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PpuState_DotState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 bgPatternShiftLo = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_bgpatternshiftlo(&has_bits);
+          _impl_.bgpatternshiftlo_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bgPatternShiftHi = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_bgpatternshifthi(&has_bits);
+          _impl_.bgpatternshifthi_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bgAttrShiftLo = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_bgattrshiftlo(&has_bits);
+          _impl_.bgattrshiftlo_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bgAttrShiftHi = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_bgattrshifthi(&has_bits);
+          _impl_.bgattrshifthi_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 nameLatch = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_namelatch(&has_bits);
+          _impl_.namelatch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 attrLatch = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_attrlatch(&has_bits);
+          _impl_.attrlatch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 patternLatchLo = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_patternlatchlo(&has_bits);
+          _impl_.patternlatchlo_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 patternLatchHi = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_patternlatchhi(&has_bits);
+          _impl_.patternlatchhi_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes secondaryOam = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_secondaryoam();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 oamLatch = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_oamlatch(&has_bits);
+          _impl_.oamlatch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 evalSprite = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_evalsprite(&has_bits);
+          _impl_.evalsprite_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 evalByte = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_evalbyte(&has_bits);
+          _impl_.evalbyte_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 secondaryOamAddr = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_secondaryoamaddr(&has_bits);
+          _impl_.secondaryoamaddr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool evalDone = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_evaldone(&has_bits);
+          _impl_.evaldone_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool sprite0Next = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_sprite0next(&has_bits);
+          _impl_.sprite0next_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 lineSpriteCount = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_linespritecount(&has_bits);
+          _impl_.linespritecount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool lineHasSprite0 = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_linehassprite0(&has_bits);
+          _impl_.linehassprite0_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes spritePatternLo = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          auto str = _internal_mutable_spritepatternlo();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes spritePatternHi = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          auto str = _internal_mutable_spritepatternhi();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes spriteAttr = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          auto str = _internal_mutable_spriteattr();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes spriteX = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          auto str = _internal_mutable_spritex();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool a12High = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 176)) {
+          _Internal::set_has_a12high(&has_bits);
+          _impl_.a12high_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 a12LowCycle = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          _Internal::set_has_a12lowcycle(&has_bits);
+          _impl_.a12lowcycle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PpuState_DotState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.PpuState.DotState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 bgPatternShiftLo = 1;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_bgpatternshiftlo(), target);
+  }
+
+  // optional uint32 bgPatternShiftHi = 2;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_bgpatternshifthi(), target);
+  }
+
+  // optional uint32 bgAttrShiftLo = 3;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_bgattrshiftlo(), target);
+  }
+
+  // optional uint32 bgAttrShiftHi = 4;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_bgattrshifthi(), target);
+  }
+
+  // optional uint32 nameLatch = 5;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_namelatch(), target);
+  }
+
+  // optional uint32 attrLatch = 6;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_attrlatch(), target);
+  }
+
+  // optional uint32 patternLatchLo = 7;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_patternlatchlo(), target);
+  }
+
+  // optional uint32 patternLatchHi = 8;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_patternlatchhi(), target);
+  }
+
+  // optional bytes secondaryOam = 9;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_secondaryoam(), target);
+  }
+
+  // optional uint32 oamLatch = 10;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_oamlatch(), target);
+  }
+
+  // optional uint32 evalSprite = 11;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_evalsprite(), target);
+  }
+
+  // optional uint32 evalByte = 12;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_evalbyte(), target);
+  }
+
+  // optional uint32 secondaryOamAddr = 13;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_secondaryoamaddr(), target);
+  }
+
+  // optional bool evalDone = 14;
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(14, this->_internal_evaldone(), target);
+  }
+
+  // optional bool sprite0Next = 15;
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(15, this->_internal_sprite0next(), target);
+  }
+
+  // optional uint32 lineSpriteCount = 16;
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(16, this->_internal_linespritecount(), target);
+  }
+
+  // optional bool lineHasSprite0 = 17;
+  if (cached_has_bits & 0x00100000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(17, this->_internal_linehassprite0(), target);
+  }
+
+  // optional bytes spritePatternLo = 18;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        18, this->_internal_spritepatternlo(), target);
+  }
+
+  // optional bytes spritePatternHi = 19;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        19, this->_internal_spritepatternhi(), target);
+  }
+
+  // optional bytes spriteAttr = 20;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->WriteBytesMaybeAliased(
+        20, this->_internal_spriteattr(), target);
+  }
+
+  // optional bytes spriteX = 21;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->WriteBytesMaybeAliased(
+        21, this->_internal_spritex(), target);
+  }
+
+  // optional bool a12High = 22;
+  if (cached_has_bits & 0x00200000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(22, this->_internal_a12high(), target);
+  }
+
+  // optional uint64 a12LowCycle = 23;
+  if (cached_has_bits & 0x00400000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(23, this->_internal_a12lowcycle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.PpuState.DotState)
+  return target;
+}
+
+size_t PpuState_DotState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.PpuState.DotState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional bytes secondaryOam = 9;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_secondaryoam());
+    }
+
+    // optional bytes spritePatternLo = 18;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_spritepatternlo());
+    }
+
+    // optional bytes spritePatternHi = 19;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_spritepatternhi());
+    }
+
+    // optional bytes spriteAttr = 20;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_spriteattr());
+    }
+
+    // optional bytes spriteX = 21;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_spritex());
+    }
+
+    // optional uint32 bgPatternShiftLo = 1;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bgpatternshiftlo());
+    }
+
+    // optional uint32 bgPatternShiftHi = 2;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bgpatternshifthi());
+    }
+
+    // optional uint32 bgAttrShiftLo = 3;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bgattrshiftlo());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional uint32 bgAttrShiftHi = 4;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bgattrshifthi());
+    }
+
+    // optional uint32 nameLatch = 5;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_namelatch());
+    }
+
+    // optional uint32 attrLatch = 6;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_attrlatch());
+    }
+
+    // optional uint32 patternLatchLo = 7;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_patternlatchlo());
+    }
+
+    // optional uint32 patternLatchHi = 8;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_patternlatchhi());
+    }
+
+    // optional uint32 oamLatch = 10;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_oamlatch());
+    }
+
+    // optional uint32 evalSprite = 11;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_evalsprite());
+    }
+
+    // optional uint32 evalByte = 12;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_evalbyte());
+    }
+
+  }
+  if (cached_has_bits & 0x007f0000u) {
+    // optional uint32 secondaryOamAddr = 13;
+    if (cached_has_bits & 0x00010000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_secondaryoamaddr());
+    }
+
+    // optional uint32 lineSpriteCount = 16;
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_linespritecount());
+    }
+
+    // optional bool evalDone = 14;
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool sprite0Next = 15;
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool lineHasSprite0 = 17;
+    if (cached_has_bits & 0x00100000u) {
+      total_size += 2 + 1;
+    }
+
+    // optional bool a12High = 22;
+    if (cached_has_bits & 0x00200000u) {
+      total_size += 2 + 1;
+    }
+
+    // optional uint64 a12LowCycle = 23;
+    if (cached_has_bits & 0x00400000u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_a12lowcycle());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PpuState_DotState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PpuState_DotState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PpuState_DotState::GetClassData() const { return &_class_data_; }
+
+
+void PpuState_DotState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PpuState_DotState*>(&to_msg);
+  auto& from = static_cast<const PpuState_DotState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.PpuState.DotState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_secondaryoam(from._internal_secondaryoam());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_spritepatternlo(from._internal_spritepatternlo());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_spritepatternhi(from._internal_spritepatternhi());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_spriteattr(from._internal_spriteattr());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_spritex(from._internal_spritex());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.bgpatternshiftlo_ = from._impl_.bgpatternshiftlo_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.bgpatternshifthi_ = from._impl_.bgpatternshifthi_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.bgattrshiftlo_ = from._impl_.bgattrshiftlo_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.bgattrshifthi_ = from._impl_.bgattrshifthi_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.namelatch_ = from._impl_.namelatch_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.attrlatch_ = from._impl_.attrlatch_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.patternlatchlo_ = from._impl_.patternlatchlo_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.patternlatchhi_ = from._impl_.patternlatchhi_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.oamlatch_ = from._impl_.oamlatch_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.evalsprite_ = from._impl_.evalsprite_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.evalbyte_ = from._impl_.evalbyte_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x007f0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _this->_impl_.secondaryoamaddr_ = from._impl_.secondaryoamaddr_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _this->_impl_.linespritecount_ = from._impl_.linespritecount_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _this->_impl_.evaldone_ = from._impl_.evaldone_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _this->_impl_.sprite0next_ = from._impl_.sprite0next_;
+    }
+    if (cached_has_bits & 0x00100000u) {
+      _this->_impl_.linehassprite0_ = from._impl_.linehassprite0_;
+    }
+    if (cached_has_bits & 0x00200000u) {
+      _this->_impl_.a12high_ = from._impl_.a12high_;
+    }
+    if (cached_has_bits & 0x00400000u) {
+      _this->_impl_.a12lowcycle_ = from._impl_.a12lowcycle_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PpuState_DotState::CopyFrom(const PpuState_DotState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.PpuState.DotState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PpuState_DotState::IsInitialized() const {
+  return true;
+}
+
+void PpuState_DotState::InternalSwap(PpuState_DotState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.secondaryoam_, lhs_arena,
+      &other->_impl_.secondaryoam_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.spritepatternlo_, lhs_arena,
+      &other->_impl_.spritepatternlo_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.spritepatternhi_, lhs_arena,
+      &other->_impl_.spritepatternhi_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.spriteattr_, lhs_arena,
+      &other->_impl_.spriteattr_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.spritex_, lhs_arena,
+      &other->_impl_.spritex_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PpuState_DotState, _impl_.a12lowcycle_)
+      + sizeof(PpuState_DotState::_impl_.a12lowcycle_)
+      - PROTOBUF_FIELD_OFFSET(PpuState_DotState, _impl_.bgpatternshiftlo_)>(
+          reinterpret_cast<char*>(&_impl_.bgpatternshiftlo_),
+          reinterpret_cast<char*>(&other->_impl_.bgpatternshiftlo_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PpuState_DotState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[7]);
+}
+
+// ===================================================================
+
+class PpuState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PpuState>()._impl_._has_bits_);
+  static void set_has_cycle(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_frame(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_vramtoggle(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_vramfinexscroll(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_vramcurrentaddr(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_vramtempaddr(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_vrammachineaddr(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_vramreadlatch(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_scrollingmachinestate(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_xscrollorigin(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_yscrollorigin(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static const ::Rnes::PpuState_DotState& dot(const PpuState* msg);
+  static void set_has_dot(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::Rnes::PpuState_DotState&
+PpuState::_Internal::dot(const PpuState* msg) {
+  return *msg->_impl_.dot_;
+}
+PpuState::PpuState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.PpuState)
+}
+PpuState::PpuState(const PpuState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PpuState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.regs_){from._impl_.regs_}
+    , decltype(_impl_.spriteram_){from._impl_.spriteram_}
+    , decltype(_impl_.dot_){nullptr}
+    , decltype(_impl_.cycle_){}
+    , decltype(_impl_.frame_){}
+    , decltype(_impl_.vramtoggle_){}
+    , decltype(_impl_.vramfinexscroll_){}
+    , decltype(_impl_.vramcurrentaddr_){}
+    , decltype(_impl_.vramtempaddr_){}
+    , decltype(_impl_.vrammachineaddr_){}
+    , decltype(_impl_.vramreadlatch_){}
+    , decltype(_impl_.scrollingmachinestate_){}
+    , decltype(_impl_.xscrollorigin_){}
+    , decltype(_impl_.yscrollorigin_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_dot()) {
+    _this->_impl_.dot_ = new ::Rnes::PpuState_DotState(*from._impl_.dot_);
+  }
+  ::memcpy(&_impl_.cycle_, &from._impl_.cycle_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.yscrollorigin_) -
+    reinterpret_cast<char*>(&_impl_.cycle_)) + sizeof(_impl_.yscrollorigin_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.PpuState)
+}
+
+inline void PpuState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.regs_){arena}
+    , decltype(_impl_.spriteram_){arena}
+    , decltype(_impl_.dot_){nullptr}
+    , decltype(_impl_.cycle_){uint64_t{0u}}
+    , decltype(_impl_.frame_){uint64_t{0u}}
+    , decltype(_impl_.vramtoggle_){0u}
+    , decltype(_impl_.vramfinexscroll_){0u}
+    , decltype(_impl_.vramcurrentaddr_){0u}
+    , decltype(_impl_.vramtempaddr_){0u}
+    , decltype(_impl_.vrammachineaddr_){0u}
+    , decltype(_impl_.vramreadlatch_){0u}
+    , decltype(_impl_.scrollingmachinestate_){0u}
+    , decltype(_impl_.xscrollorigin_){0u}
+    , decltype(_impl_.yscrollorigin_){0u}
+  };
+}
+
+PpuState::~PpuState() {
+  // @@protoc_insertion_point(destructor:Rnes.PpuState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PpuState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.regs_.~RepeatedField();
+  _impl_.spriteram_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.dot_;
+}
+
+void PpuState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PpuState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.PpuState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.regs_.Clear();
+  _impl_.spriteram_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.dot_ != nullptr);
+    _impl_.dot_->Clear();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.cycle_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.vrammachineaddr_) -
+        reinterpret_cast<char*>(&_impl_.cycle_)) + sizeof(_impl_.vrammachineaddr_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.vramreadlatch_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.yscrollorigin_) -
+        reinterpret_cast<char*>(&_impl_.vramreadlatch_)) + sizeof(_impl_.yscrollorigin_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PpuState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 cycle = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_cycle(&has_bits);
+          _impl_.cycle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 frame = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_frame(&has_bits);
+          _impl_.frame_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 regs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_regs(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_regs(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Rnes.PpuState.SpriteState spriteRam = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_spriteram(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 vramToggle = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_vramtoggle(&has_bits);
+          _impl_.vramtoggle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 vramFineXScroll = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_vramfinexscroll(&has_bits);
+          _impl_.vramfinexscroll_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 vramCurrentAddr = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_vramcurrentaddr(&has_bits);
+          _impl_.vramcurrentaddr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 vramTempAddr = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_vramtempaddr(&has_bits);
+          _impl_.vramtempaddr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 vramMachineAddr = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_vrammachineaddr(&has_bits);
+          _impl_.vrammachineaddr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 vramReadLatch = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_vramreadlatch(&has_bits);
+          _impl_.vramreadlatch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 scrollingMachineState = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_scrollingmachinestate(&has_bits);
+          _impl_.scrollingmachinestate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 xScrollOrigin = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_xscrollorigin(&has_bits);
+          _impl_.xscrollorigin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 yScrollOrigin = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_yscrollorigin(&has_bits);
+          _impl_.yscrollorigin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.PpuState.DotState dot = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_dot(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PpuState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.PpuState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 cycle = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_cycle(), target);
+  }
+
+  // optional uint64 frame = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_frame(), target);
+  }
+
+  // repeated uint32 regs = 3;
+  for (int i = 0, n = this->_internal_regs_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_regs(i), target);
+  }
+
+  // repeated .Rnes.PpuState.SpriteState spriteRam = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_spriteram_size()); i < n; i++) {
+    const auto& repfield = this->_internal_spriteram(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 vramToggle = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_vramtoggle(), target);
+  }
+
+  // optional uint32 vramFineXScroll = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_vramfinexscroll(), target);
+  }
+
+  // optional uint32 vramCurrentAddr = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_vramcurrentaddr(), target);
+  }
+
+  // optional uint32 vramTempAddr = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_vramtempaddr(), target);
+  }
+
+  // optional uint32 vramMachineAddr = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_vrammachineaddr(), target);
+  }
+
+  // optional uint32 vramReadLatch = 10;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_vramreadlatch(), target);
+  }
+
+  // optional uint32 scrollingMachineState = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_scrollingmachinestate(), target);
+  }
+
+  // optional uint32 xScrollOrigin = 12;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_xscrollorigin(), target);
+  }
+
+  // optional uint32 yScrollOrigin = 13;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(13, this->_internal_yscrollorigin(), target);
+  }
+
+  // optional .Rnes.PpuState.DotState dot = 14;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::dot(this),
+        _Internal::dot(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.PpuState)
+  return target;
+}
+
+size_t PpuState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.PpuState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 regs = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.regs_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_regs_size());
+    total_size += data_size;
+  }
+
+  // repeated .Rnes.PpuState.SpriteState spriteRam = 4;
+  total_size += 1UL * this->_internal_spriteram_size();
+  for (const auto& msg : this->_impl_.spriteram_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .Rnes.PpuState.DotState dot = 14;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.dot_);
+    }
+
+    // optional uint64 cycle = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cycle());
+    }
+
+    // optional uint64 frame = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_frame());
+    }
+
+    // optional uint32 vramToggle = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vramtoggle());
+    }
+
+    // optional uint32 vramFineXScroll = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vramfinexscroll());
+    }
+
+    // optional uint32 vramCurrentAddr = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vramcurrentaddr());
+    }
+
+    // optional uint32 vramTempAddr = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vramtempaddr());
+    }
+
+    // optional uint32 vramMachineAddr = 9;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vrammachineaddr());
+    }
+
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    // optional uint32 vramReadLatch = 10;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vramreadlatch());
+    }
+
+    // optional uint32 scrollingMachineState = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_scrollingmachinestate());
+    }
+
+    // optional uint32 xScrollOrigin = 12;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_xscrollorigin());
+    }
+
+    // optional uint32 yScrollOrigin = 13;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_yscrollorigin());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PpuState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PpuState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PpuState::GetClassData() const { return &_class_data_; }
+
+
+void PpuState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PpuState*>(&to_msg);
+  auto& from = static_cast<const PpuState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.PpuState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.regs_.MergeFrom(from._impl_.regs_);
+  _this->_impl_.spriteram_.MergeFrom(from._impl_.spriteram_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_dot()->::Rnes::PpuState_DotState::MergeFrom(
+          from._internal_dot());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.cycle_ = from._impl_.cycle_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.frame_ = from._impl_.frame_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.vramtoggle_ = from._impl_.vramtoggle_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.vramfinexscroll_ = from._impl_.vramfinexscroll_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.vramcurrentaddr_ = from._impl_.vramcurrentaddr_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.vramtempaddr_ = from._impl_.vramtempaddr_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.vrammachineaddr_ = from._impl_.vrammachineaddr_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.vramreadlatch_ = from._impl_.vramreadlatch_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.scrollingmachinestate_ = from._impl_.scrollingmachinestate_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.xscrollorigin_ = from._impl_.xscrollorigin_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.yscrollorigin_ = from._impl_.yscrollorigin_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PpuState::CopyFrom(const PpuState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.PpuState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PpuState::IsInitialized() const {
+  return true;
+}
+
+void PpuState::InternalSwap(PpuState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.regs_.InternalSwap(&other->_impl_.regs_);
+  _impl_.spriteram_.InternalSwap(&other->_impl_.spriteram_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PpuState, _impl_.yscrollorigin_)
+      + sizeof(PpuState::_impl_.yscrollorigin_)
+      - PROTOBUF_FIELD_OFFSET(PpuState, _impl_.dot_)>(
+          reinterpret_cast<char*>(&_impl_.dot_),
+          reinterpret_cast<char*>(&other->_impl_.dot_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PpuState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[8]);
+}
+
+// ===================================================================
+
+class MmcState_MmcNoneState::_Internal {
+ public:
+};
+
+MmcState_MmcNoneState::MmcState_MmcNoneState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:Rnes.MmcState.MmcNoneState)
+}
+MmcState_MmcNoneState::MmcState_MmcNoneState(const MmcState_MmcNoneState& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  MmcState_MmcNoneState* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:Rnes.MmcState.MmcNoneState)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MmcState_MmcNoneState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MmcState_MmcNoneState::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata MmcState_MmcNoneState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[9]);
+}
+
+// ===================================================================
+
+class MmcState_Mmc1State::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MmcState_Mmc1State>()._impl_._has_bits_);
+  static void set_has_controlreg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_chr0bank(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_chr1bank(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_prgbank(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_shiftregister(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+MmcState_Mmc1State::MmcState_Mmc1State(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.MmcState.Mmc1State)
+}
+MmcState_Mmc1State::MmcState_Mmc1State(const MmcState_Mmc1State& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MmcState_Mmc1State* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.controlreg_){}
+    , decltype(_impl_.chr0bank_){}
+    , decltype(_impl_.chr1bank_){}
+    , decltype(_impl_.prgbank_){}
+    , decltype(_impl_.shiftregister_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.controlreg_, &from._impl_.controlreg_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shiftregister_) -
+    reinterpret_cast<char*>(&_impl_.controlreg_)) + sizeof(_impl_.shiftregister_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.MmcState.Mmc1State)
+}
+
+inline void MmcState_Mmc1State::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.controlreg_){0u}
+    , decltype(_impl_.chr0bank_){0u}
+    , decltype(_impl_.chr1bank_){0u}
+    , decltype(_impl_.prgbank_){0u}
+    , decltype(_impl_.shiftregister_){0u}
+  };
+}
+
+MmcState_Mmc1State::~MmcState_Mmc1State() {
+  // @@protoc_insertion_point(destructor:Rnes.MmcState.Mmc1State)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MmcState_Mmc1State::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MmcState_Mmc1State::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MmcState_Mmc1State::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.MmcState.Mmc1State)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.controlreg_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.shiftregister_) -
+        reinterpret_cast<char*>(&_impl_.controlreg_)) + sizeof(_impl_.shiftregister_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MmcState_Mmc1State::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 controlReg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_controlreg(&has_bits);
+          _impl_.controlreg_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 chr0Bank = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_chr0bank(&has_bits);
+          _impl_.chr0bank_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 chr1Bank = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_chr1bank(&has_bits);
+          _impl_.chr1bank_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 prgBank = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_prgbank(&has_bits);
+          _impl_.prgbank_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 shiftRegister = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_shiftregister(&has_bits);
+          _impl_.shiftregister_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MmcState_Mmc1State::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.MmcState.Mmc1State)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 controlReg = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_controlreg(), target);
+  }
+
+  // optional uint32 chr0Bank = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_chr0bank(), target);
+  }
+
+  // optional uint32 chr1Bank = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_chr1bank(), target);
+  }
+
+  // optional uint32 prgBank = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_prgbank(), target);
+  }
+
+  // optional uint32 shiftRegister = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_shiftregister(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.MmcState.Mmc1State)
+  return target;
+}
+
+size_t MmcState_Mmc1State::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.MmcState.Mmc1State)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional uint32 controlReg = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_controlreg());
+    }
+
+    // optional uint32 chr0Bank = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chr0bank());
+    }
+
+    // optional uint32 chr1Bank = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chr1bank());
+    }
+
+    // optional uint32 prgBank = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prgbank());
+    }
+
+    // optional uint32 shiftRegister = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shiftregister());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MmcState_Mmc1State::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MmcState_Mmc1State::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MmcState_Mmc1State::GetClassData() const { return &_class_data_; }
+
+
+void MmcState_Mmc1State::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MmcState_Mmc1State*>(&to_msg);
+  auto& from = static_cast<const MmcState_Mmc1State&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.MmcState.Mmc1State)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.controlreg_ = from._impl_.controlreg_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.chr0bank_ = from._impl_.chr0bank_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.chr1bank_ = from._impl_.chr1bank_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.prgbank_ = from._impl_.prgbank_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.shiftregister_ = from._impl_.shiftregister_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MmcState_Mmc1State::CopyFrom(const MmcState_Mmc1State& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.MmcState.Mmc1State)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MmcState_Mmc1State::IsInitialized() const {
+  return true;
+}
+
+void MmcState_Mmc1State::InternalSwap(MmcState_Mmc1State* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MmcState_Mmc1State, _impl_.shiftregister_)
+      + sizeof(MmcState_Mmc1State::_impl_.shiftregister_)
+      - PROTOBUF_FIELD_OFFSET(MmcState_Mmc1State, _impl_.controlreg_)>(
+          reinterpret_cast<char*>(&_impl_.controlreg_),
+          reinterpret_cast<char*>(&other->_impl_.controlreg_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MmcState_Mmc1State::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[10]);
+}
+
+// ===================================================================
+
+class MmcState_Mmc3State::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MmcState_Mmc3State>()._impl_._has_bits_);
+  static void set_has_bankselectreg(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_mirrorreg(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_prgramreg(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_bankregister(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_irqreloadreg(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_irqcounterreg(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_irqenabled(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_irqpending(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+};
+
+MmcState_Mmc3State::MmcState_Mmc3State(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.MmcState.Mmc3State)
+}
+MmcState_Mmc3State::MmcState_Mmc3State(const MmcState_Mmc3State& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MmcState_Mmc3State* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bankregister_){}
+    , decltype(_impl_.bankselectreg_){}
+    , decltype(_impl_.mirrorreg_){}
+    , decltype(_impl_.prgramreg_){}
+    , decltype(_impl_.irqreloadreg_){}
+    , decltype(_impl_.irqcounterreg_){}
+    , decltype(_impl_.irqenabled_){}
+    , decltype(_impl_.irqpending_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.bankregister_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bankregister_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_bankregister()) {
+    _this->_impl_.bankregister_.Set(from._internal_bankregister(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.bankselectreg_, &from._impl_.bankselectreg_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.irqpending_) -
+    reinterpret_cast<char*>(&_impl_.bankselectreg_)) + sizeof(_impl_.irqpending_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.MmcState.Mmc3State)
+}
+
+inline void MmcState_Mmc3State::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bankregister_){}
+    , decltype(_impl_.bankselectreg_){0u}
+    , decltype(_impl_.mirrorreg_){0u}
+    , decltype(_impl_.prgramreg_){0u}
+    , decltype(_impl_.irqreloadreg_){0u}
+    , decltype(_impl_.irqcounterreg_){0u}
+    , decltype(_impl_.irqenabled_){false}
+    , decltype(_impl_.irqpending_){false}
+  };
+  _impl_.bankregister_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bankregister_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MmcState_Mmc3State::~MmcState_Mmc3State() {
+  // @@protoc_insertion_point(destructor:Rnes.MmcState.Mmc3State)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MmcState_Mmc3State::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bankregister_.Destroy();
+}
+
+void MmcState_Mmc3State::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MmcState_Mmc3State::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.MmcState.Mmc3State)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.bankregister_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.bankselectreg_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.irqpending_) -
+        reinterpret_cast<char*>(&_impl_.bankselectreg_)) + sizeof(_impl_.irqpending_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MmcState_Mmc3State::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 bankSelectReg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_bankselectreg(&has_bits);
+          _impl_.bankselectreg_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 mirrorReg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_mirrorreg(&has_bits);
+          _impl_.mirrorreg_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 prgRamReg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_prgramreg(&has_bits);
+          _impl_.prgramreg_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes bankRegister = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_bankregister();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 irqReloadReg = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_irqreloadreg(&has_bits);
+          _impl_.irqreloadreg_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 irqCounterReg = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_irqcounterreg(&has_bits);
+          _impl_.irqcounterreg_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool irqEnabled = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_irqenabled(&has_bits);
+          _impl_.irqenabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool irqPending = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_irqpending(&has_bits);
+          _impl_.irqpending_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MmcState_Mmc3State::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.MmcState.Mmc3State)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 bankSelectReg = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_bankselectreg(), target);
+  }
+
+  // optional uint32 mirrorReg = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_mirrorreg(), target);
+  }
+
+  // optional uint32 prgRamReg = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_prgramreg(), target);
+  }
+
+  // optional bytes bankRegister = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_bankregister(), target);
+  }
+
+  // optional uint32 irqReloadReg = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_irqreloadreg(), target);
+  }
+
+  // optional uint32 irqCounterReg = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_irqcounterreg(), target);
+  }
+
+  // optional bool irqEnabled = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_irqenabled(), target);
+  }
+
+  // optional bool irqPending = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_irqpending(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.MmcState.Mmc3State)
+  return target;
+}
+
+size_t MmcState_Mmc3State::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.MmcState.Mmc3State)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional bytes bankRegister = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_bankregister());
+    }
+
+    // optional uint32 bankSelectReg = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bankselectreg());
+    }
+
+    // optional uint32 mirrorReg = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mirrorreg());
+    }
+
+    // optional uint32 prgRamReg = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prgramreg());
+    }
+
+    // optional uint32 irqReloadReg = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_irqreloadreg());
+    }
+
+    // optional uint32 irqCounterReg = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_irqcounterreg());
+    }
+
+    // optional bool irqEnabled = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool irqPending = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MmcState_Mmc3State::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MmcState_Mmc3State::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MmcState_Mmc3State::GetClassData() const { return &_class_data_; }
+
+
+void MmcState_Mmc3State::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MmcState_Mmc3State*>(&to_msg);
+  auto& from = static_cast<const MmcState_Mmc3State&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.MmcState.Mmc3State)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_bankregister(from._internal_bankregister());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.bankselectreg_ = from._impl_.bankselectreg_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.mirrorreg_ = from._impl_.mirrorreg_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.prgramreg_ = from._impl_.prgramreg_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.irqreloadreg_ = from._impl_.irqreloadreg_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.irqcounterreg_ = from._impl_.irqcounterreg_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.irqenabled_ = from._impl_.irqenabled_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.irqpending_ = from._impl_.irqpending_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MmcState_Mmc3State::CopyFrom(const MmcState_Mmc3State& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.MmcState.Mmc3State)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MmcState_Mmc3State::IsInitialized() const {
+  return true;
+}
+
+void MmcState_Mmc3State::InternalSwap(MmcState_Mmc3State* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bankregister_, lhs_arena,
+      &other->_impl_.bankregister_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MmcState_Mmc3State, _impl_.irqpending_)
+      + sizeof(MmcState_Mmc3State::_impl_.irqpending_)
+      - PROTOBUF_FIELD_OFFSET(MmcState_Mmc3State, _impl_.bankselectreg_)>(
+          reinterpret_cast<char*>(&_impl_.bankselectreg_),
+          reinterpret_cast<char*>(&other->_impl_.bankselectreg_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MmcState_Mmc3State::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[11]);
+}
+
+// ===================================================================
+
+class MmcState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MmcState>()._impl_._has_bits_);
+  static const ::Rnes::MmcState_MmcNoneState& mmcnone(const MmcState* msg);
+  static void set_has_mmcnone(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Rnes::MmcState_Mmc1State& mmc1(const MmcState* msg);
+  static void set_has_mmc1(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::Rnes::MmcState_Mmc3State& mmc3(const MmcState* msg);
+  static void set_has_mmc3(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::Rnes::MmcState_MmcNoneState&
+MmcState::_Internal::mmcnone(const MmcState* msg) {
+  return *msg->_impl_.mmcnone_;
+}
+const ::Rnes::MmcState_Mmc1State&
+MmcState::_Internal::mmc1(const MmcState* msg) {
+  return *msg->_impl_.mmc1_;
+}
+const ::Rnes::MmcState_Mmc3State&
+MmcState::_Internal::mmc3(const MmcState* msg) {
+  return *msg->_impl_.mmc3_;
+}
+MmcState::MmcState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.MmcState)
+}
+MmcState::MmcState(const MmcState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MmcState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mmcnone_){nullptr}
+    , decltype(_impl_.mmc1_){nullptr}
+    , decltype(_impl_.mmc3_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_mmcnone()) {
+    _this->_impl_.mmcnone_ = new ::Rnes::MmcState_MmcNoneState(*from._impl_.mmcnone_);
+  }
+  if (from._internal_has_mmc1()) {
+    _this->_impl_.mmc1_ = new ::Rnes::MmcState_Mmc1State(*from._impl_.mmc1_);
+  }
+  if (from._internal_has_mmc3()) {
+    _this->_impl_.mmc3_ = new ::Rnes::MmcState_Mmc3State(*from._impl_.mmc3_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Rnes.MmcState)
+}
+
+inline void MmcState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mmcnone_){nullptr}
+    , decltype(_impl_.mmc1_){nullptr}
+    , decltype(_impl_.mmc3_){nullptr}
+  };
+}
+
+MmcState::~MmcState() {
+  // @@protoc_insertion_point(destructor:Rnes.MmcState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MmcState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.mmcnone_;
+  if (this != internal_default_instance()) delete _impl_.mmc1_;
+  if (this != internal_default_instance()) delete _impl_.mmc3_;
+}
+
+void MmcState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MmcState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.MmcState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.mmcnone_ != nullptr);
+      _impl_.mmcnone_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.mmc1_ != nullptr);
+      _impl_.mmc1_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.mmc3_ != nullptr);
+      _impl_.mmc3_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MmcState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .Rnes.MmcState.MmcNoneState mmcNone = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mmcnone(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.MmcState.Mmc1State mmc1 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mmc1(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.MmcState.Mmc3State mmc3 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mmc3(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MmcState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.MmcState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .Rnes.MmcState.MmcNoneState mmcNone = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::mmcnone(this),
+        _Internal::mmcnone(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.MmcState.Mmc1State mmc1 = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::mmc1(this),
+        _Internal::mmc1(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.MmcState.Mmc3State mmc3 = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::mmc3(this),
+        _Internal::mmc3(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.MmcState)
+  return target;
+}
+
+size_t MmcState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.MmcState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .Rnes.MmcState.MmcNoneState mmcNone = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.mmcnone_);
+    }
+
+    // optional .Rnes.MmcState.Mmc1State mmc1 = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.mmc1_);
+    }
+
+    // optional .Rnes.MmcState.Mmc3State mmc3 = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.mmc3_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MmcState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MmcState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MmcState::GetClassData() const { return &_class_data_; }
+
+
+void MmcState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MmcState*>(&to_msg);
+  auto& from = static_cast<const MmcState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.MmcState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_mmcnone()->::Rnes::MmcState_MmcNoneState::MergeFrom(
+          from._internal_mmcnone());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_mmc1()->::Rnes::MmcState_Mmc1State::MergeFrom(
+          from._internal_mmc1());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_mmc3()->::Rnes::MmcState_Mmc3State::MergeFrom(
+          from._internal_mmc3());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MmcState::CopyFrom(const MmcState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.MmcState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MmcState::IsInitialized() const {
+  return true;
+}
+
+void MmcState::InternalSwap(MmcState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MmcState, _impl_.mmc3_)
+      + sizeof(MmcState::_impl_.mmc3_)
+      - PROTOBUF_FIELD_OFFSET(MmcState, _impl_.mmcnone_)>(
+          reinterpret_cast<char*>(&_impl_.mmcnone_),
+          reinterpret_cast<char*>(&other->_impl_.mmcnone_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MmcState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[12]);
+}
+
+// ===================================================================
+
+class ControllerState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ControllerState>()._impl_._has_bits_);
+  static void set_has_control(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_shiftreg(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ControllerState::ControllerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.ControllerState)
+}
+ControllerState::ControllerState(const ControllerState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ControllerState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.control_){}
+    , decltype(_impl_.shiftreg_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.control_, &from._impl_.control_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.shiftreg_) -
+    reinterpret_cast<char*>(&_impl_.control_)) + sizeof(_impl_.shiftreg_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.ControllerState)
+}
+
+inline void ControllerState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.control_){0u}
+    , decltype(_impl_.shiftreg_){0u}
+  };
+}
+
+ControllerState::~ControllerState() {
+  // @@protoc_insertion_point(destructor:Rnes.ControllerState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ControllerState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ControllerState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ControllerState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.ControllerState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.control_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.shiftreg_) -
+        reinterpret_cast<char*>(&_impl_.control_)) + sizeof(_impl_.shiftreg_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ControllerState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 control = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_control(&has_bits);
+          _impl_.control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 shiftReg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_shiftreg(&has_bits);
+          _impl_.shiftreg_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ControllerState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.ControllerState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 control = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_control(), target);
+  }
+
+  // optional uint32 shiftReg = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_shiftreg(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.ControllerState)
+  return target;
+}
+
+size_t ControllerState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.ControllerState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 control = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_control());
+    }
+
+    // optional uint32 shiftReg = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shiftreg());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControllerState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ControllerState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControllerState::GetClassData() const { return &_class_data_; }
+
+
+void ControllerState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControllerState*>(&to_msg);
+  auto& from = static_cast<const ControllerState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.ControllerState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.control_ = from._impl_.control_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shiftreg_ = from._impl_.shiftreg_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ControllerState::CopyFrom(const ControllerState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.ControllerState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ControllerState::IsInitialized() const {
+  return true;
+}
+
+void ControllerState::InternalSwap(ControllerState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ControllerState, _impl_.shiftreg_)
+      + sizeof(ControllerState::_impl_.shiftreg_)
+      - PROTOBUF_FIELD_OFFSET(ControllerState, _impl_.control_)>(
+          reinterpret_cast<char*>(&_impl_.control_),
+          reinterpret_cast<char*>(&other->_impl_.control_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ControllerState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[13]);
+}
+
+// ===================================================================
+
+class CpuMemoryState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CpuMemoryState>()._impl_._has_bits_);
+  static void set_has_cpusram(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_prgsram(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+CpuMemoryState::CpuMemoryState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.CpuMemoryState)
+}
+CpuMemoryState::CpuMemoryState(const CpuMemoryState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CpuMemoryState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cpusram_){}
+    , decltype(_impl_.prgsram_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.cpusram_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cpusram_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cpusram()) {
+    _this->_impl_.cpusram_.Set(from._internal_cpusram(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.prgsram_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prgsram_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_prgsram()) {
+    _this->_impl_.prgsram_.Set(from._internal_prgsram(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:Rnes.CpuMemoryState)
+}
+
+inline void CpuMemoryState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.cpusram_){}
+    , decltype(_impl_.prgsram_){}
+  };
+  _impl_.cpusram_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cpusram_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.prgsram_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prgsram_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CpuMemoryState::~CpuMemoryState() {
+  // @@protoc_insertion_point(destructor:Rnes.CpuMemoryState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CpuMemoryState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cpusram_.Destroy();
+  _impl_.prgsram_.Destroy();
+}
+
+void CpuMemoryState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CpuMemoryState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.CpuMemoryState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.cpusram_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.prgsram_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CpuMemoryState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bytes cpuSram = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_cpusram();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes prgSram = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_prgsram();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CpuMemoryState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.CpuMemoryState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bytes cpuSram = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_cpusram(), target);
+  }
+
+  // optional bytes prgSram = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_prgsram(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.CpuMemoryState)
+  return target;
+}
+
+size_t CpuMemoryState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.CpuMemoryState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes cpuSram = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_cpusram());
+    }
+
+    // optional bytes prgSram = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_prgsram());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CpuMemoryState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CpuMemoryState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CpuMemoryState::GetClassData() const { return &_class_data_; }
+
+
+void CpuMemoryState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CpuMemoryState*>(&to_msg);
+  auto& from = static_cast<const CpuMemoryState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.CpuMemoryState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_cpusram(from._internal_cpusram());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_prgsram(from._internal_prgsram());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CpuMemoryState::CopyFrom(const CpuMemoryState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.CpuMemoryState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CpuMemoryState::IsInitialized() const {
+  return true;
+}
+
+void CpuMemoryState::InternalSwap(CpuMemoryState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cpusram_, lhs_arena,
+      &other->_impl_.cpusram_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prgsram_, lhs_arena,
+      &other->_impl_.prgsram_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CpuMemoryState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[14]);
+}
+
+// ===================================================================
+
+class VideoMemoryState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<VideoMemoryState>()._impl_._has_bits_);
+  static void set_has_patterntablememory(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_nametablememory(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_palettememory(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+VideoMemoryState::VideoMemoryState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.VideoMemoryState)
+}
+VideoMemoryState::VideoMemoryState(const VideoMemoryState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VideoMemoryState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.patterntablememory_){}
+    , decltype(_impl_.nametablememory_){}
+    , decltype(_impl_.palettememory_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.patterntablememory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.patterntablememory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_patterntablememory()) {
+    _this->_impl_.patterntablememory_.Set(from._internal_patterntablememory(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.nametablememory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nametablememory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_nametablememory()) {
+    _this->_impl_.nametablememory_.Set(from._internal_nametablememory(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.palettememory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.palettememory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_palettememory()) {
+    _this->_impl_.palettememory_.Set(from._internal_palettememory(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:Rnes.VideoMemoryState)
+}
+
+inline void VideoMemoryState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.patterntablememory_){}
+    , decltype(_impl_.nametablememory_){}
+    , decltype(_impl_.palettememory_){}
+  };
+  _impl_.patterntablememory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.patterntablememory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.nametablememory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nametablememory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.palettememory_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.palettememory_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+VideoMemoryState::~VideoMemoryState() {
+  // @@protoc_insertion_point(destructor:Rnes.VideoMemoryState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VideoMemoryState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.patterntablememory_.Destroy();
+  _impl_.nametablememory_.Destroy();
+  _impl_.palettememory_.Destroy();
+}
+
+void VideoMemoryState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VideoMemoryState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.VideoMemoryState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.patterntablememory_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.nametablememory_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.palettememory_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VideoMemoryState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bytes patternTableMemory = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_patterntablememory();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes nameTableMemory = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_nametablememory();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes paletteMemory = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_palettememory();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VideoMemoryState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.VideoMemoryState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bytes patternTableMemory = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_patterntablememory(), target);
+  }
+
+  // optional bytes nameTableMemory = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_nametablememory(), target);
+  }
+
+  // optional bytes paletteMemory = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_palettememory(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.VideoMemoryState)
+  return target;
+}
+
+size_t VideoMemoryState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.VideoMemoryState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bytes patternTableMemory = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_patterntablememory());
+    }
+
+    // optional bytes nameTableMemory = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_nametablememory());
+    }
+
+    // optional bytes paletteMemory = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_palettememory());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VideoMemoryState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VideoMemoryState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VideoMemoryState::GetClassData() const { return &_class_data_; }
+
+
+void VideoMemoryState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VideoMemoryState*>(&to_msg);
+  auto& from = static_cast<const VideoMemoryState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.VideoMemoryState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_patterntablememory(from._internal_patterntablememory());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_nametablememory(from._internal_nametablememory());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_palettememory(from._internal_palettememory());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VideoMemoryState::CopyFrom(const VideoMemoryState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.VideoMemoryState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VideoMemoryState::IsInitialized() const {
+  return true;
+}
+
+void VideoMemoryState::InternalSwap(VideoMemoryState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.patterntablememory_, lhs_arena,
+      &other->_impl_.patterntablememory_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nametablememory_, lhs_arena,
+      &other->_impl_.nametablememory_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.palettememory_, lhs_arena,
+      &other->_impl_.palettememory_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VideoMemoryState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[15]);
+}
+
+// ===================================================================
+
+class DmaState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DmaState>()._impl_._has_bits_);
+  static void set_has_spritedmamode(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_spritedmacycle(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_spritedmasourceaddr(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+DmaState::DmaState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.DmaState)
+}
+DmaState::DmaState(const DmaState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DmaState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.spritedmamode_){}
+    , decltype(_impl_.spritedmacycle_){}
+    , decltype(_impl_.spritedmasourceaddr_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.spritedmamode_, &from._impl_.spritedmamode_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.spritedmasourceaddr_) -
+    reinterpret_cast<char*>(&_impl_.spritedmamode_)) + sizeof(_impl_.spritedmasourceaddr_));
+  // @@protoc_insertion_point(copy_constructor:Rnes.DmaState)
+}
+
+inline void DmaState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.spritedmamode_){false}
+    , decltype(_impl_.spritedmacycle_){0u}
+    , decltype(_impl_.spritedmasourceaddr_){0u}
+  };
+}
+
+DmaState::~DmaState() {
+  // @@protoc_insertion_point(destructor:Rnes.DmaState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DmaState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void DmaState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DmaState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.DmaState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.spritedmamode_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.spritedmasourceaddr_) -
+        reinterpret_cast<char*>(&_impl_.spritedmamode_)) + sizeof(_impl_.spritedmasourceaddr_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DmaState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool spriteDmaMode = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_spritedmamode(&has_bits);
+          _impl_.spritedmamode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 spriteDmaCycle = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_spritedmacycle(&has_bits);
+          _impl_.spritedmacycle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 spriteDmaSourceAddr = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_spritedmasourceaddr(&has_bits);
+          _impl_.spritedmasourceaddr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DmaState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.DmaState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool spriteDmaMode = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_spritedmamode(), target);
+  }
+
+  // optional uint32 spriteDmaCycle = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_spritedmacycle(), target);
+  }
+
+  // optional uint32 spriteDmaSourceAddr = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_spritedmasourceaddr(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.DmaState)
+  return target;
+}
+
+size_t DmaState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.DmaState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bool spriteDmaMode = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 spriteDmaCycle = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_spritedmacycle());
+    }
+
+    // optional uint32 spriteDmaSourceAddr = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_spritedmasourceaddr());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DmaState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DmaState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DmaState::GetClassData() const { return &_class_data_; }
+
+
+void DmaState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DmaState*>(&to_msg);
+  auto& from = static_cast<const DmaState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.DmaState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.spritedmamode_ = from._impl_.spritedmamode_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.spritedmacycle_ = from._impl_.spritedmacycle_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.spritedmasourceaddr_ = from._impl_.spritedmasourceaddr_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DmaState::CopyFrom(const DmaState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.DmaState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DmaState::IsInitialized() const {
+  return true;
+}
+
+void DmaState::InternalSwap(DmaState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DmaState, _impl_.spritedmasourceaddr_)
+      + sizeof(DmaState::_impl_.spritedmasourceaddr_)
+      - PROTOBUF_FIELD_OFFSET(DmaState, _impl_.spritedmamode_)>(
+          reinterpret_cast<char*>(&_impl_.spritedmamode_),
+          reinterpret_cast<char*>(&other->_impl_.spritedmamode_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DmaState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[16]);
+}
+
+// ===================================================================
+
+class SaveState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SaveState>()._impl_._has_bits_);
+  static void set_has_savedate(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_gametime(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::Rnes::DmaState& dma(const SaveState* msg);
+  static void set_has_dma(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::Rnes::CpuState& cpu(const SaveState* msg);
+  static void set_has_cpu(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::Rnes::ApuState& apu(const SaveState* msg);
+  static void set_has_apu(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::Rnes::PpuState& ppu(const SaveState* msg);
+  static void set_has_ppu(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::Rnes::ControllerState& controller(const SaveState* msg);
+  static void set_has_controller(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::Rnes::CpuMemoryState& cpumem(const SaveState* msg);
+  static void set_has_cpumem(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::Rnes::VideoMemoryState& vidmem(const SaveState* msg);
+  static void set_has_vidmem(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+};
+
+const ::Rnes::DmaState&
+SaveState::_Internal::dma(const SaveState* msg) {
+  return *msg->_impl_.dma_;
+}
+const ::Rnes::CpuState&
+SaveState::_Internal::cpu(const SaveState* msg) {
+  return *msg->_impl_.cpu_;
+}
+const ::Rnes::ApuState&
+SaveState::_Internal::apu(const SaveState* msg) {
+  return *msg->_impl_.apu_;
+}
+const ::Rnes::PpuState&
+SaveState::_Internal::ppu(const SaveState* msg) {
+  return *msg->_impl_.ppu_;
+}
+const ::Rnes::ControllerState&
+SaveState::_Internal::controller(const SaveState* msg) {
+  return *msg->_impl_.controller_;
+}
+const ::Rnes::CpuMemoryState&
+SaveState::_Internal::cpumem(const SaveState* msg) {
+  return *msg->_impl_.cpumem_;
+}
+const ::Rnes::VideoMemoryState&
+SaveState::_Internal::vidmem(const SaveState* msg) {
+  return *msg->_impl_.vidmem_;
+}
+SaveState::SaveState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Rnes.SaveState)
+}
+SaveState::SaveState(const SaveState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SaveState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.savedate_){}
+    , decltype(_impl_.dma_){nullptr}
+    , decltype(_impl_.cpu_){nullptr}
+    , decltype(_impl_.apu_){nullptr}
+    , decltype(_impl_.ppu_){nullptr}
+    , decltype(_impl_.controller_){nullptr}
+    , decltype(_impl_.cpumem_){nullptr}
+    , decltype(_impl_.vidmem_){nullptr}
+    , decltype(_impl_.gametime_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.savedate_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.savedate_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_savedate()) {
+    _this->_impl_.savedate_.Set(from._internal_savedate(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_dma()) {
+    _this->_impl_.dma_ = new ::Rnes::DmaState(*from._impl_.dma_);
+  }
+  if (from._internal_has_cpu()) {
+    _this->_impl_.cpu_ = new ::Rnes::CpuState(*from._impl_.cpu_);
+  }
+  if (from._internal_has_apu()) {
+    _this->_impl_.apu_ = new ::Rnes::ApuState(*from._impl_.apu_);
+  }
+  if (from._internal_has_ppu()) {
+    _this->_impl_.ppu_ = new ::Rnes::PpuState(*from._impl_.ppu_);
+  }
+  if (from._internal_has_controller()) {
+    _this->_impl_.controller_ = new ::Rnes::ControllerState(*from._impl_.controller_);
+  }
+  if (from._internal_has_cpumem()) {
+    _this->_impl_.cpumem_ = new ::Rnes::CpuMemoryState(*from._impl_.cpumem_);
+  }
+  if (from._internal_has_vidmem()) {
+    _this->_impl_.vidmem_ = new ::Rnes::VideoMemoryState(*from._impl_.vidmem_);
+  }
+  _this->_impl_.gametime_ = from._impl_.gametime_;
+  // @@protoc_insertion_point(copy_constructor:Rnes.SaveState)
+}
+
+inline void SaveState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.savedate_){}
+    , decltype(_impl_.dma_){nullptr}
+    , decltype(_impl_.cpu_){nullptr}
+    , decltype(_impl_.apu_){nullptr}
+    , decltype(_impl_.ppu_){nullptr}
+    , decltype(_impl_.controller_){nullptr}
+    , decltype(_impl_.cpumem_){nullptr}
+    , decltype(_impl_.vidmem_){nullptr}
+    , decltype(_impl_.gametime_){uint64_t{0u}}
+  };
+  _impl_.savedate_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.savedate_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SaveState::~SaveState() {
+  // @@protoc_insertion_point(destructor:Rnes.SaveState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SaveState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.savedate_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.dma_;
+  if (this != internal_default_instance()) delete _impl_.cpu_;
+  if (this != internal_default_instance()) delete _impl_.apu_;
+  if (this != internal_default_instance()) delete _impl_.ppu_;
+  if (this != internal_default_instance()) delete _impl_.controller_;
+  if (this != internal_default_instance()) delete _impl_.cpumem_;
+  if (this != internal_default_instance()) delete _impl_.vidmem_;
+}
+
+void SaveState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SaveState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Rnes.SaveState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.savedate_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.dma_ != nullptr);
+      _impl_.dma_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.cpu_ != nullptr);
+      _impl_.cpu_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.apu_ != nullptr);
+      _impl_.apu_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.ppu_ != nullptr);
+      _impl_.ppu_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.controller_ != nullptr);
+      _impl_.controller_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.cpumem_ != nullptr);
+      _impl_.cpumem_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.vidmem_ != nullptr);
+      _impl_.vidmem_->Clear();
+    }
+  }
+  _impl_.gametime_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SaveState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string saveDate = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_savedate();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Rnes.SaveState.saveDate");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 gameTime = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_gametime(&has_bits);
+          _impl_.gametime_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.DmaState dma = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_dma(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.CpuState cpu = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cpu(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.ApuState apu = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_apu(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.PpuState ppu = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ppu(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.ControllerState controller = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_controller(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.CpuMemoryState cpuMem = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_cpumem(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Rnes.VideoMemoryState vidMem = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_vidmem(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SaveState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Rnes.SaveState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string saveDate = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_savedate().data(), static_cast<int>(this->_internal_savedate().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Rnes.SaveState.saveDate");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_savedate(), target);
+  }
+
+  // optional uint64 gameTime = 2;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_gametime(), target);
+  }
+
+  // optional .Rnes.DmaState dma = 7;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::dma(this),
+        _Internal::dma(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.CpuState cpu = 8;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::cpu(this),
+        _Internal::cpu(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.ApuState apu = 9;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::apu(this),
+        _Internal::apu(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.PpuState ppu = 10;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::ppu(this),
+        _Internal::ppu(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.ControllerState controller = 11;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::controller(this),
+        _Internal::controller(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.CpuMemoryState cpuMem = 12;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::cpumem(this),
+        _Internal::cpumem(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Rnes.VideoMemoryState vidMem = 13;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::vidmem(this),
+        _Internal::vidmem(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Rnes.SaveState)
+  return target;
+}
+
+size_t SaveState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Rnes.SaveState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string saveDate = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_savedate());
+    }
+
+    // optional .Rnes.DmaState dma = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.dma_);
+    }
+
+    // optional .Rnes.CpuState cpu = 8;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.cpu_);
+    }
+
+    // optional .Rnes.ApuState apu = 9;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.apu_);
+    }
+
+    // optional .Rnes.PpuState ppu = 10;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.ppu_);
+    }
+
+    // optional .Rnes.ControllerState controller = 11;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.controller_);
+    }
+
+    // optional .Rnes.CpuMemoryState cpuMem = 12;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.cpumem_);
+    }
+
+    // optional .Rnes.VideoMemoryState vidMem = 13;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.vidmem_);
+    }
+
+  }
+  // optional uint64 gameTime = 2;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_gametime());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SaveState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SaveState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SaveState::GetClassData() const { return &_class_data_; }
+
+
+void SaveState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SaveState*>(&to_msg);
+  auto& from = static_cast<const SaveState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Rnes.SaveState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_savedate(from._internal_savedate());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_dma()->::Rnes::DmaState::MergeFrom(
+          from._internal_dma());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_cpu()->::Rnes::CpuState::MergeFrom(
+          from._internal_cpu());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_apu()->::Rnes::ApuState::MergeFrom(
+          from._internal_apu());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_ppu()->::Rnes::PpuState::MergeFrom(
+          from._internal_ppu());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_controller()->::Rnes::ControllerState::MergeFrom(
+          from._internal_controller());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_cpumem()->::Rnes::CpuMemoryState::MergeFrom(
+          from._internal_cpumem());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_vidmem()->::Rnes::VideoMemoryState::MergeFrom(
+          from._internal_vidmem());
+    }
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_gametime(from._internal_gametime());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SaveState::CopyFrom(const SaveState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Rnes.SaveState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SaveState::IsInitialized() const {
+  return true;
+}
+
+void SaveState::InternalSwap(SaveState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.savedate_, lhs_arena,
+      &other->_impl_.savedate_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SaveState, _impl_.gametime_)
+      + sizeof(SaveState::_impl_.gametime_)
+      - PROTOBUF_FIELD_OFFSET(SaveState, _impl_.dma_)>(
+          reinterpret_cast<char*>(&_impl_.dma_),
+          reinterpret_cast<char*>(&other->_impl_.dma_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SaveState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_save_2eproto_getter, &descriptor_table_save_2eproto_once,
+      file_level_metadata_save_2eproto[17]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Rnes
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Rnes::CpuState*
+Arena::CreateMaybeMessage< ::Rnes::CpuState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::CpuState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::PulseState*
+Arena::CreateMaybeMessage< ::Rnes::PulseState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::PulseState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::TriangleState*
+Arena::CreateMaybeMessage< ::Rnes::TriangleState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::TriangleState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::NoiseState*
+Arena::CreateMaybeMessage< ::Rnes::NoiseState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::NoiseState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::DmcState*
+Arena::CreateMaybeMessage< ::Rnes::DmcState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::DmcState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::ApuState*
+Arena::CreateMaybeMessage< ::Rnes::ApuState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::ApuState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::PpuState_SpriteState*
+Arena::CreateMaybeMessage< ::Rnes::PpuState_SpriteState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::PpuState_SpriteState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::PpuState_DotState*
+Arena::CreateMaybeMessage< ::Rnes::PpuState_DotState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::PpuState_DotState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::PpuState*
+Arena::CreateMaybeMessage< ::Rnes::PpuState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::PpuState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::MmcState_MmcNoneState*
+Arena::CreateMaybeMessage< ::Rnes::MmcState_MmcNoneState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::MmcState_MmcNoneState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::MmcState_Mmc1State*
+Arena::CreateMaybeMessage< ::Rnes::MmcState_Mmc1State >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::MmcState_Mmc1State >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::MmcState_Mmc3State*
+Arena::CreateMaybeMessage< ::Rnes::MmcState_Mmc3State >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::MmcState_Mmc3State >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::MmcState*
+Arena::CreateMaybeMessage< ::Rnes::MmcState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::MmcState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::ControllerState*
+Arena::CreateMaybeMessage< ::Rnes::ControllerState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::ControllerState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::CpuMemoryState*
+Arena::CreateMaybeMessage< ::Rnes::CpuMemoryState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::CpuMemoryState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::VideoMemoryState*
+Arena::CreateMaybeMessage< ::Rnes::VideoMemoryState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::VideoMemoryState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::DmaState*
+Arena::CreateMaybeMessage< ::Rnes::DmaState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::DmaState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Rnes::SaveState*
+Arena::CreateMaybeMessage< ::Rnes::SaveState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Rnes::SaveState >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,10251 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: save.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_save_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_save_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_save_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_save_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_save_2eproto;
+namespace Rnes {
+class ApuState;
+struct ApuStateDefaultTypeInternal;
+extern ApuStateDefaultTypeInternal _ApuState_default_instance_;
+class ControllerState;
+struct ControllerStateDefaultTypeInternal;
+extern ControllerStateDefaultTypeInternal _ControllerState_default_instance_;
+class CpuMemoryState;
+struct CpuMemoryStateDefaultTypeInternal;
+extern CpuMemoryStateDefaultTypeInternal _CpuMemoryState_default_instance_;
+class CpuState;
+struct CpuStateDefaultTypeInternal;
+extern CpuStateDefaultTypeInternal _CpuState_default_instance_;
+class DmaState;
+struct DmaStateDefaultTypeInternal;
+extern DmaStateDefaultTypeInternal _DmaState_default_instance_;
+class DmcState;
+struct DmcStateDefaultTypeInternal;
+extern DmcStateDefaultTypeInternal _DmcState_default_instance_;
+class MmcState;
+struct MmcStateDefaultTypeInternal;
+extern MmcStateDefaultTypeInternal _MmcState_default_instance_;
+class MmcState_Mmc1State;
+struct MmcState_Mmc1StateDefaultTypeInternal;
+extern MmcState_Mmc1StateDefaultTypeInternal _MmcState_Mmc1State_default_instance_;
+class MmcState_Mmc3State;
+struct MmcState_Mmc3StateDefaultTypeInternal;
+extern MmcState_Mmc3StateDefaultTypeInternal _MmcState_Mmc3State_default_instance_;
+class MmcState_MmcNoneState;
+struct MmcState_MmcNoneStateDefaultTypeInternal;
+extern MmcState_MmcNoneStateDefaultTypeInternal _MmcState_MmcNoneState_default_instance_;
+class NoiseState;
+struct NoiseStateDefaultTypeInternal;
+extern NoiseStateDefaultTypeInternal _NoiseState_default_instance_;
+class PpuState;
+struct PpuStateDefaultTypeInternal;
+extern PpuStateDefaultTypeInternal _PpuState_default_instance_;
+class PpuState_DotState;
+struct PpuState_DotStateDefaultTypeInternal;
+extern PpuState_DotStateDefaultTypeInternal _PpuState_DotState_default_instance_;
+class PpuState_SpriteState;
+struct PpuState_SpriteStateDefaultTypeInternal;
+extern PpuState_SpriteStateDefaultTypeInternal _PpuState_SpriteState_default_instance_;
+class PulseState;
+struct PulseStateDefaultTypeInternal;
+extern PulseStateDefaultTypeInternal _PulseState_default_instance_;
+class SaveState;
+struct SaveStateDefaultTypeInternal;
+extern SaveStateDefaultTypeInternal _SaveState_default_instance_;
+class TriangleState;
+struct TriangleStateDefaultTypeInternal;
+extern TriangleStateDefaultTypeInternal _TriangleState_default_instance_;
+class VideoMemoryState;
+struct VideoMemoryStateDefaultTypeInternal;
+extern VideoMemoryStateDefaultTypeInternal _VideoMemoryState_default_instance_;
+}  // namespace Rnes
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Rnes::ApuState* Arena::CreateMaybeMessage<::Rnes::ApuState>(Arena*);
+template<> ::Rnes::ControllerState* Arena::CreateMaybeMessage<::Rnes::ControllerState>(Arena*);
+template<> ::Rnes::CpuMemoryState* Arena::CreateMaybeMessage<::Rnes::CpuMemoryState>(Arena*);
+template<> ::Rnes::CpuState* Arena::CreateMaybeMessage<::Rnes::CpuState>(Arena*);
+template<> ::Rnes::DmaState* Arena::CreateMaybeMessage<::Rnes::DmaState>(Arena*);
+template<> ::Rnes::DmcState* Arena::CreateMaybeMessage<::Rnes::DmcState>(Arena*);
+template<> ::Rnes::MmcState* Arena::CreateMaybeMessage<::Rnes::MmcState>(Arena*);
+template<> ::Rnes::MmcState_Mmc1State* Arena::CreateMaybeMessage<::Rnes::MmcState_Mmc1State>(Arena*);
+template<> ::Rnes::MmcState_Mmc3State* Arena::CreateMaybeMessage<::Rnes::MmcState_Mmc3State>(Arena*);
+template<> ::Rnes::MmcState_MmcNoneState* Arena::CreateMaybeMessage<::Rnes::MmcState_MmcNoneState>(Arena*);
+template<> ::Rnes::NoiseState* Arena::CreateMaybeMessage<::Rnes::NoiseState>(Arena*);
+template<> ::Rnes::PpuState* Arena::CreateMaybeMessage<::Rnes::PpuState>(Arena*);
+template<> ::Rnes::PpuState_DotState* Arena::CreateMaybeMessage<::Rnes::PpuState_DotState>(Arena*);
+template<> ::Rnes::PpuState_SpriteState* Arena::CreateMaybeMessage<::Rnes::PpuState_SpriteState>(Arena*);
+template<> ::Rnes::PulseState* Arena::CreateMaybeMessage<::Rnes::PulseState>(Arena*);
+template<> ::Rnes::SaveState* Arena::CreateMaybeMessage<::Rnes::SaveState>(Arena*);
+template<> ::Rnes::TriangleState* Arena::CreateMaybeMessage<::Rnes::TriangleState>(Arena*);
+template<> ::Rnes::VideoMemoryState* Arena::CreateMaybeMessage<::Rnes::VideoMemoryState>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace Rnes {
+
+// ===================================================================
+
+class CpuState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.CpuState) */ {
+ public:
+  inline CpuState() : CpuState(nullptr) {}
+  ~CpuState() override;
+  explicit PROTOBUF_CONSTEXPR CpuState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CpuState(const CpuState& from);
+  CpuState(CpuState&& from) noexcept
+    : CpuState() {
+    *this = ::std::move(from);
+  }
+
+  inline CpuState& operator=(const CpuState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CpuState& operator=(CpuState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CpuState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CpuState* internal_default_instance() {
+    return reinterpret_cast<const CpuState*>(
+               &_CpuState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CpuState& a, CpuState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CpuState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CpuState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CpuState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CpuState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CpuState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CpuState& from) {
+    CpuState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CpuState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.CpuState";
+  }
+  protected:
+  explicit CpuState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAFieldNumber = 1,
+    kXFieldNumber = 2,
+    kYFieldNumber = 3,
+    kPcFieldNumber = 4,
+    kSpFieldNumber = 5,
+    kStatusFieldNumber = 6,
+    kCycleFieldNumber = 7,
+  };
+  // optional uint32 a = 1;
+  bool has_a() const;
+  private:
+  bool _internal_has_a() const;
+  public:
+  void clear_a();
+  uint32_t a() const;
+  void set_a(uint32_t value);
+  private:
+  uint32_t _internal_a() const;
+  void _internal_set_a(uint32_t value);
+  public:
+
+  // optional uint32 x = 2;
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  uint32_t x() const;
+  void set_x(uint32_t value);
+  private:
+  uint32_t _internal_x() const;
+  void _internal_set_x(uint32_t value);
+  public:
+
+  // optional uint32 y = 3;
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  uint32_t y() const;
+  void set_y(uint32_t value);
+  private:
+  uint32_t _internal_y() const;
+  void _internal_set_y(uint32_t value);
+  public:
+
+  // optional uint32 pc = 4;
+  bool has_pc() const;
+  private:
+  bool _internal_has_pc() const;
+  public:
+  void clear_pc();
+  uint32_t pc() const;
+  void set_pc(uint32_t value);
+  private:
+  uint32_t _internal_pc() const;
+  void _internal_set_pc(uint32_t value);
+  public:
+
+  // optional uint32 sp = 5;
+  bool has_sp() const;
+  private:
+  bool _internal_has_sp() const;
+  public:
+  void clear_sp();
+  uint32_t sp() const;
+  void set_sp(uint32_t value);
+  private:
+  uint32_t _internal_sp() const;
+  void _internal_set_sp(uint32_t value);
+  public:
+
+  // optional uint32 status = 6;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  uint32_t status() const;
+  void set_status(uint32_t value);
+  private:
+  uint32_t _internal_status() const;
+  void _internal_set_status(uint32_t value);
+  public:
+
+  // optional uint64 cycle = 7;
+  bool has_cycle() const;
+  private:
+  bool _internal_has_cycle() const;
+  public:
+  void clear_cycle();
+  uint64_t cycle() const;
+  void set_cycle(uint64_t value);
+  private:
+  uint64_t _internal_cycle() const;
+  void _internal_set_cycle(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.CpuState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t a_;
+    uint32_t x_;
+    uint32_t y_;
+    uint32_t pc_;
+    uint32_t sp_;
+    uint32_t status_;
+    uint64_t cycle_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PulseState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.PulseState) */ {
+ public:
+  inline PulseState() : PulseState(nullptr) {}
+  ~PulseState() override;
+  explicit PROTOBUF_CONSTEXPR PulseState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PulseState(const PulseState& from);
+  PulseState(PulseState&& from) noexcept
+    : PulseState() {
+    *this = ::std::move(from);
+  }
+
+  inline PulseState& operator=(const PulseState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PulseState& operator=(PulseState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PulseState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PulseState* internal_default_instance() {
+    return reinterpret_cast<const PulseState*>(
+               &_PulseState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(PulseState& a, PulseState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PulseState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PulseState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PulseState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PulseState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PulseState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PulseState& from) {
+    PulseState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PulseState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.PulseState";
+  }
+  protected:
+  explicit PulseState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLengthCounterFieldNumber = 2,
+    kEnvelopeFieldNumber = 3,
+    kEnvelopeDividerFieldNumber = 4,
+    kPrimaryFieldNumber = 1,
+    kResetEnvelopeAndDividerFieldNumber = 5,
+    kResetSweepDividerFieldNumber = 6,
+    kSweepDividerFieldNumber = 7,
+    kCurrentSampleFieldNumber = 8,
+    kTimerDividerFieldNumber = 9,
+    kSequencerOffsetFieldNumber = 10,
+  };
+  // optional uint32 lengthCounter = 2;
+  bool has_lengthcounter() const;
+  private:
+  bool _internal_has_lengthcounter() const;
+  public:
+  void clear_lengthcounter();
+  uint32_t lengthcounter() const;
+  void set_lengthcounter(uint32_t value);
+  private:
+  uint32_t _internal_lengthcounter() const;
+  void _internal_set_lengthcounter(uint32_t value);
+  public:
+
+  // optional uint32 envelope = 3;
+  bool has_envelope() const;
+  private:
+  bool _internal_has_envelope() const;
+  public:
+  void clear_envelope();
+  uint32_t envelope() const;
+  void set_envelope(uint32_t value);
+  private:
+  uint32_t _internal_envelope() const;
+  void _internal_set_envelope(uint32_t value);
+  public:
+
+  // optional uint32 envelopeDivider = 4;
+  bool has_envelopedivider() const;
+  private:
+  bool _internal_has_envelopedivider() const;
+  public:
+  void clear_envelopedivider();
+  uint32_t envelopedivider() const;
+  void set_envelopedivider(uint32_t value);
+  private:
+  uint32_t _internal_envelopedivider() const;
+  void _internal_set_envelopedivider(uint32_t value);
+  public:
+
+  // optional bool primary = 1;
+  bool has_primary() const;
+  private:
+  bool _internal_has_primary() const;
+  public:
+  void clear_primary();
+  bool primary() const;
+  void set_primary(bool value);
+  private:
+  bool _internal_primary() const;
+  void _internal_set_primary(bool value);
+  public:
+
+  // optional bool resetEnvelopeAndDivider = 5;
+  bool has_resetenvelopeanddivider() const;
+  private:
+  bool _internal_has_resetenvelopeanddivider() const;
+  public:
+  void clear_resetenvelopeanddivider();
+  bool resetenvelopeanddivider() const;
+  void set_resetenvelopeanddivider(bool value);
+  private:
+  bool _internal_resetenvelopeanddivider() const;
+  void _internal_set_resetenvelopeanddivider(bool value);
+  public:
+
+  // optional bool resetSweepDivider = 6;
+  bool has_resetsweepdivider() const;
+  private:
+  bool _internal_has_resetsweepdivider() const;
+  public:
+  void clear_resetsweepdivider();
+  bool resetsweepdivider() const;
+  void set_resetsweepdivider(bool value);
+  private:
+  bool _internal_resetsweepdivider() const;
+  void _internal_set_resetsweepdivider(bool value);
+  public:
+
+  // optional uint32 sweepDivider = 7;
+  bool has_sweepdivider() const;
+  private:
+  bool _internal_has_sweepdivider() const;
+  public:
+  void clear_sweepdivider();
+  uint32_t sweepdivider() const;
+  void set_sweepdivider(uint32_t value);
+  private:
+  uint32_t _internal_sweepdivider() const;
+  void _internal_set_sweepdivider(uint32_t value);
+  public:
+
+  // optional uint32 currentSample = 8;
+  bool has_currentsample() const;
+  private:
+  bool _internal_has_currentsample() const;
+  public:
+  void clear_currentsample();
+  uint32_t currentsample() const;
+  void set_currentsample(uint32_t value);
+  private:
+  uint32_t _internal_currentsample() const;
+  void _internal_set_currentsample(uint32_t value);
+  public:
+
+  // optional uint32 timerDivider = 9;
+  bool has_timerdivider() const;
+  private:
+  bool _internal_has_timerdivider() const;
+  public:
+  void clear_timerdivider();
+  uint32_t timerdivider() const;
+  void set_timerdivider(uint32_t value);
+  private:
+  uint32_t _internal_timerdivider() const;
+  void _internal_set_timerdivider(uint32_t value);
+  public:
+
+  // optional uint32 sequencerOffset = 10;
+  bool has_sequenceroffset() const;
+  private:
+  bool _internal_has_sequenceroffset() const;
+  public:
+  void clear_sequenceroffset();
+  uint32_t sequenceroffset() const;
+  void set_sequenceroffset(uint32_t value);
+  private:
+  uint32_t _internal_sequenceroffset() const;
+  void _internal_set_sequenceroffset(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.PulseState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t lengthcounter_;
+    uint32_t envelope_;
+    uint32_t envelopedivider_;
+    bool primary_;
+    bool resetenvelopeanddivider_;
+    bool resetsweepdivider_;
+    uint32_t sweepdivider_;
+    uint32_t currentsample_;
+    uint32_t timerdivider_;
+    uint32_t sequenceroffset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TriangleState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.TriangleState) */ {
+ public:
+  inline TriangleState() : TriangleState(nullptr) {}
+  ~TriangleState() override;
+  explicit PROTOBUF_CONSTEXPR TriangleState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TriangleState(const TriangleState& from);
+  TriangleState(TriangleState&& from) noexcept
+    : TriangleState() {
+    *this = ::std::move(from);
+  }
+
+  inline TriangleState& operator=(const TriangleState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TriangleState& operator=(TriangleState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TriangleState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TriangleState* internal_default_instance() {
+    return reinterpret_cast<const TriangleState*>(
+               &_TriangleState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TriangleState& a, TriangleState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TriangleState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TriangleState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TriangleState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TriangleState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TriangleState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TriangleState& from) {
+    TriangleState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TriangleState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.TriangleState";
+  }
+  protected:
+  explicit TriangleState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLengthCounterFieldNumber = 1,
+    kLinearCounterHaltFieldNumber = 2,
+    kLinearCounterFieldNumber = 3,
+    kCurrentSampleFieldNumber = 4,
+    kTimerDividerFieldNumber = 5,
+    kSequencerOffsetFieldNumber = 6,
+  };
+  // optional uint32 lengthCounter = 1;
+  bool has_lengthcounter() const;
+  private:
+  bool _internal_has_lengthcounter() const;
+  public:
+  void clear_lengthcounter();
+  uint32_t lengthcounter() const;
+  void set_lengthcounter(uint32_t value);
+  private:
+  uint32_t _internal_lengthcounter() const;
+  void _internal_set_lengthcounter(uint32_t value);
+  public:
+
+  // optional bool linearCounterHalt = 2;
+  bool has_linearcounterhalt() const;
+  private:
+  bool _internal_has_linearcounterhalt() const;
+  public:
+  void clear_linearcounterhalt();
+  bool linearcounterhalt() const;
+  void set_linearcounterhalt(bool value);
+  private:
+  bool _internal_linearcounterhalt() const;
+  void _internal_set_linearcounterhalt(bool value);
+  public:
+
+  // optional uint32 linearCounter = 3;
+  bool has_linearcounter() const;
+  private:
+  bool _internal_has_linearcounter() const;
+  public:
+  void clear_linearcounter();
+  uint32_t linearcounter() const;
+  void set_linearcounter(uint32_t value);
+  private:
+  uint32_t _internal_linearcounter() const;
+  void _internal_set_linearcounter(uint32_t value);
+  public:
+
+  // optional uint32 currentSample = 4;
+  bool has_currentsample() const;
+  private:
+  bool _internal_has_currentsample() const;
+  public:
+  void clear_currentsample();
+  uint32_t currentsample() const;
+  void set_currentsample(uint32_t value);
+  private:
+  uint32_t _internal_currentsample() const;
+  void _internal_set_currentsample(uint32_t value);
+  public:
+
+  // optional uint32 timerDivider = 5;
+  bool has_timerdivider() const;
+  private:
+  bool _internal_has_timerdivider() const;
+  public:
+  void clear_timerdivider();
+  uint32_t timerdivider() const;
+  void set_timerdivider(uint32_t value);
+  private:
+  uint32_t _internal_timerdivider() const;
+  void _internal_set_timerdivider(uint32_t value);
+  public:
+
+  // optional uint32 sequencerOffset = 6;
+  bool has_sequenceroffset() const;
+  private:
+  bool _internal_has_sequenceroffset() const;
+  public:
+  void clear_sequenceroffset();
+  uint32_t sequenceroffset() const;
+  void set_sequenceroffset(uint32_t value);
+  private:
+  uint32_t _internal_sequenceroffset() const;
+  void _internal_set_sequenceroffset(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.TriangleState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t lengthcounter_;
+    bool linearcounterhalt_;
+    uint32_t linearcounter_;
+    uint32_t currentsample_;
+    uint32_t timerdivider_;
+    uint32_t sequenceroffset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NoiseState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.NoiseState) */ {
+ public:
+  inline NoiseState() : NoiseState(nullptr) {}
+  ~NoiseState() override;
+  explicit PROTOBUF_CONSTEXPR NoiseState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NoiseState(const NoiseState& from);
+  NoiseState(NoiseState&& from) noexcept
+    : NoiseState() {
+    *this = ::std::move(from);
+  }
+
+  inline NoiseState& operator=(const NoiseState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NoiseState& operator=(NoiseState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NoiseState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NoiseState* internal_default_instance() {
+    return reinterpret_cast<const NoiseState*>(
+               &_NoiseState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(NoiseState& a, NoiseState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NoiseState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NoiseState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NoiseState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NoiseState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NoiseState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NoiseState& from) {
+    NoiseState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NoiseState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.NoiseState";
+  }
+  protected:
+  explicit NoiseState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLengthCounterFieldNumber = 1,
+    kShiftRegisterFieldNumber = 2,
+    kEnvelopeFieldNumber = 3,
+    kEnvelopeDividerFieldNumber = 4,
+    kResetEnvelopeAndDividerFieldNumber = 5,
+    kCurrentSampleFieldNumber = 6,
+    kTimerDividerFieldNumber = 7,
+  };
+  // optional uint32 lengthCounter = 1;
+  bool has_lengthcounter() const;
+  private:
+  bool _internal_has_lengthcounter() const;
+  public:
+  void clear_lengthcounter();
+  uint32_t lengthcounter() const;
+  void set_lengthcounter(uint32_t value);
+  private:
+  uint32_t _internal_lengthcounter() const;
+  void _internal_set_lengthcounter(uint32_t value);
+  public:
+
+  // optional uint32 shiftRegister = 2;
+  bool has_shiftregister() const;
+  private:
+  bool _internal_has_shiftregister() const;
+  public:
+  void clear_shiftregister();
+  uint32_t shiftregister() const;
+  void set_shiftregister(uint32_t value);
+  private:
+  uint32_t _internal_shiftregister() const;
+  void _internal_set_shiftregister(uint32_t value);
+  public:
+
+  // optional uint32 envelope = 3;
+  bool has_envelope() const;
+  private:
+  bool _internal_has_envelope() const;
+  public:
+  void clear_envelope();
+  uint32_t envelope() const;
+  void set_envelope(uint32_t value);
+  private:
+  uint32_t _internal_envelope() const;
+  void _internal_set_envelope(uint32_t value);
+  public:
+
+  // optional uint32 envelopeDivider = 4;
+  bool has_envelopedivider() const;
+  private:
+  bool _internal_has_envelopedivider() const;
+  public:
+  void clear_envelopedivider();
+  uint32_t envelopedivider() const;
+  void set_envelopedivider(uint32_t value);
+  private:
+  uint32_t _internal_envelopedivider() const;
+  void _internal_set_envelopedivider(uint32_t value);
+  public:
+
+  // optional bool resetEnvelopeAndDivider = 5;
+  bool has_resetenvelopeanddivider() const;
+  private:
+  bool _internal_has_resetenvelopeanddivider() const;
+  public:
+  void clear_resetenvelopeanddivider();
+  bool resetenvelopeanddivider() const;
+  void set_resetenvelopeanddivider(bool value);
+  private:
+  bool _internal_resetenvelopeanddivider() const;
+  void _internal_set_resetenvelopeanddivider(bool value);
+  public:
+
+  // optional uint32 currentSample = 6;
+  bool has_currentsample() const;
+  private:
+  bool _internal_has_currentsample() const;
+  public:
+  void clear_currentsample();
+  uint32_t currentsample() const;
+  void set_currentsample(uint32_t value);
+  private:
+  uint32_t _internal_currentsample() const;
+  void _internal_set_currentsample(uint32_t value);
+  public:
+
+  // optional uint32 timerDivider = 7;
+  bool has_timerdivider() const;
+  private:
+  bool _internal_has_timerdivider() const;
+  public:
+  void clear_timerdivider();
+  uint32_t timerdivider() const;
+  void set_timerdivider(uint32_t value);
+  private:
+  uint32_t _internal_timerdivider() const;
+  void _internal_set_timerdivider(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.NoiseState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t lengthcounter_;
+    uint32_t shiftregister_;
+    uint32_t envelope_;
+    uint32_t envelopedivider_;
+    bool resetenvelopeanddivider_;
+    uint32_t currentsample_;
+    uint32_t timerdivider_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DmcState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.DmcState) */ {
+ public:
+  inline DmcState() : DmcState(nullptr) {}
+  ~DmcState() override;
+  explicit PROTOBUF_CONSTEXPR DmcState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DmcState(const DmcState& from);
+  DmcState(DmcState&& from) noexcept
+    : DmcState() {
+    *this = ::std::move(from);
+  }
+
+  inline DmcState& operator=(const DmcState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DmcState& operator=(DmcState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DmcState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DmcState* internal_default_instance() {
+    return reinterpret_cast<const DmcState*>(
+               &_DmcState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(DmcState& a, DmcState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DmcState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DmcState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DmcState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DmcState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DmcState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DmcState& from) {
+    DmcState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DmcState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.DmcState";
+  }
+  protected:
+  explicit DmcState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOutputLevelFieldNumber = 1,
+    kShiftRegisterFieldNumber = 2,
+    kSampleBufferFieldNumber = 5,
+    kSampleBufferFullFieldNumber = 6,
+    kCurrentAddrFieldNumber = 7,
+    kBytesRemainingFieldNumber = 8,
+    kTimerCounterFieldNumber = 9,
+    kBitsRemainingFieldNumber = 3,
+    kSilenceFieldNumber = 4,
+  };
+  // optional uint32 outputLevel = 1;
+  bool has_outputlevel() const;
+  private:
+  bool _internal_has_outputlevel() const;
+  public:
+  void clear_outputlevel();
+  uint32_t outputlevel() const;
+  void set_outputlevel(uint32_t value);
+  private:
+  uint32_t _internal_outputlevel() const;
+  void _internal_set_outputlevel(uint32_t value);
+  public:
+
+  // optional uint32 shiftRegister = 2;
+  bool has_shiftregister() const;
+  private:
+  bool _internal_has_shiftregister() const;
+  public:
+  void clear_shiftregister();
+  uint32_t shiftregister() const;
+  void set_shiftregister(uint32_t value);
+  private:
+  uint32_t _internal_shiftregister() const;
+  void _internal_set_shiftregister(uint32_t value);
+  public:
+
+  // optional uint32 sampleBuffer = 5;
+  bool has_samplebuffer() const;
+  private:
+  bool _internal_has_samplebuffer() const;
+  public:
+  void clear_samplebuffer();
+  uint32_t samplebuffer() const;
+  void set_samplebuffer(uint32_t value);
+  private:
+  uint32_t _internal_samplebuffer() const;
+  void _internal_set_samplebuffer(uint32_t value);
+  public:
+
+  // optional bool sampleBufferFull = 6;
+  bool has_samplebufferfull() const;
+  private:
+  bool _internal_has_samplebufferfull() const;
+  public:
+  void clear_samplebufferfull();
+  bool samplebufferfull() const;
+  void set_samplebufferfull(bool value);
+  private:
+  bool _internal_samplebufferfull() const;
+  void _internal_set_samplebufferfull(bool value);
+  public:
+
+  // optional uint32 currentAddr = 7;
+  bool has_currentaddr() const;
+  private:
+  bool _internal_has_currentaddr() const;
+  public:
+  void clear_currentaddr();
+  uint32_t currentaddr() const;
+  void set_currentaddr(uint32_t value);
+  private:
+  uint32_t _internal_currentaddr() const;
+  void _internal_set_currentaddr(uint32_t value);
+  public:
+
+  // optional uint32 bytesRemaining = 8;
+  bool has_bytesremaining() const;
+  private:
+  bool _internal_has_bytesremaining() const;
+  public:
+  void clear_bytesremaining();
+  uint32_t bytesremaining() const;
+  void set_bytesremaining(uint32_t value);
+  private:
+  uint32_t _internal_bytesremaining() const;
+  void _internal_set_bytesremaining(uint32_t value);
+  public:
+
+  // optional uint32 timerCounter = 9;
+  bool has_timercounter() const;
+  private:
+  bool _internal_has_timercounter() const;
+  public:
+  void clear_timercounter();
+  uint32_t timercounter() const;
+  void set_timercounter(uint32_t value);
+  private:
+  uint32_t _internal_timercounter() const;
+  void _internal_set_timercounter(uint32_t value);
+  public:
+
+  // optional uint32 bitsRemaining = 3 [default = 8];
+  bool has_bitsremaining() const;
+  private:
+  bool _internal_has_bitsremaining() const;
+  public:
+  void clear_bitsremaining();
+  uint32_t bitsremaining() const;
+  void set_bitsremaining(uint32_t value);
+  private:
+  uint32_t _internal_bitsremaining() const;
+  void _internal_set_bitsremaining(uint32_t value);
+  public:
+
+  // optional bool silence = 4 [default = true];
+  bool has_silence() const;
+  private:
+  bool _internal_has_silence() const;
+  public:
+  void clear_silence();
+  bool silence() const;
+  void set_silence(bool value);
+  private:
+  bool _internal_silence() const;
+  void _internal_set_silence(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.DmcState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t outputlevel_;
+    uint32_t shiftregister_;
+    uint32_t samplebuffer_;
+    bool samplebufferfull_;
+    uint32_t currentaddr_;
+    uint32_t bytesremaining_;
+    uint32_t timercounter_;
+    uint32_t bitsremaining_;
+    bool silence_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ApuState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.ApuState) */ {
+ public:
+  inline ApuState() : ApuState(nullptr) {}
+  ~ApuState() override;
+  explicit PROTOBUF_CONSTEXPR ApuState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ApuState(const ApuState& from);
+  ApuState(ApuState&& from) noexcept
+    : ApuState() {
+    *this = ::std::move(from);
+  }
+
+  inline ApuState& operator=(const ApuState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ApuState& operator=(ApuState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ApuState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ApuState* internal_default_instance() {
+    return reinterpret_cast<const ApuState*>(
+               &_ApuState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ApuState& a, ApuState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ApuState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ApuState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ApuState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ApuState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ApuState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ApuState& from) {
+    ApuState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ApuState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.ApuState";
+  }
+  protected:
+  explicit ApuState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRegFieldNumber = 1,
+    kPulseAFieldNumber = 20,
+    kPulseBFieldNumber = 21,
+    kTriangleFieldNumber = 22,
+    kNoiseFieldNumber = 23,
+    kDmcFieldNumber = 24,
+    kSampleRateFieldNumber = 2,
+    kFourFrameCountFieldNumber = 3,
+    kFiveFrameCountFieldNumber = 4,
+    kFrameDividerFieldNumber = 5,
+    kStepFieldNumber = 6,
+    kHalfTimerDividerFieldNumber = 7,
+    kSamplerDividerFieldNumber = 8,
+    kClksPerSampleFieldNumber = 9,
+    kCurrentSampleClkFieldNumber = 10,
+    kNextSampleCountdownFieldNumber = 11,
+    kSampleClockFieldNumber = 13,
+    kAudioFrameCycleFieldNumber = 12,
+  };
+  // repeated uint32 reg = 1;
+  int reg_size() const;
+  private:
+  int _internal_reg_size() const;
+  public:
+  void clear_reg();
+  private:
+  uint32_t _internal_reg(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_reg() const;
+  void _internal_add_reg(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_reg();
+  public:
+  uint32_t reg(int index) const;
+  void set_reg(int index, uint32_t value);
+  void add_reg(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      reg() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_reg();
+
+  // optional .Rnes.PulseState pulseA = 20;
+  bool has_pulsea() const;
+  private:
+  bool _internal_has_pulsea() const;
+  public:
+  void clear_pulsea();
+  const ::Rnes::PulseState& pulsea() const;
+  PROTOBUF_NODISCARD ::Rnes::PulseState* release_pulsea();
+  ::Rnes::PulseState* mutable_pulsea();
+  void set_allocated_pulsea(::Rnes::PulseState* pulsea);
+  private:
+  const ::Rnes::PulseState& _internal_pulsea() const;
+  ::Rnes::PulseState* _internal_mutable_pulsea();
+  public:
+  void unsafe_arena_set_allocated_pulsea(
+      ::Rnes::PulseState* pulsea);
+  ::Rnes::PulseState* unsafe_arena_release_pulsea();
+
+  // optional .Rnes.PulseState pulseB = 21;
+  bool has_pulseb() const;
+  private:
+  bool _internal_has_pulseb() const;
+  public:
+  void clear_pulseb();
+  const ::Rnes::PulseState& pulseb() const;
+  PROTOBUF_NODISCARD ::Rnes::PulseState* release_pulseb();
+  ::Rnes::PulseState* mutable_pulseb();
+  void set_allocated_pulseb(::Rnes::PulseState* pulseb);
+  private:
+  const ::Rnes::PulseState& _internal_pulseb() const;
+  ::Rnes::PulseState* _internal_mutable_pulseb();
+  public:
+  void unsafe_arena_set_allocated_pulseb(
+      ::Rnes::PulseState* pulseb);
+  ::Rnes::PulseState* unsafe_arena_release_pulseb();
+
+  // optional .Rnes.TriangleState triangle = 22;
+  bool has_triangle() const;
+  private:
+  bool _internal_has_triangle() const;
+  public:
+  void clear_triangle();
+  const ::Rnes::TriangleState& triangle() const;
+  PROTOBUF_NODISCARD ::Rnes::TriangleState* release_triangle();
+  ::Rnes::TriangleState* mutable_triangle();
+  void set_allocated_triangle(::Rnes::TriangleState* triangle);
+  private:
+  const ::Rnes::TriangleState& _internal_triangle() const;
+  ::Rnes::TriangleState* _internal_mutable_triangle();
+  public:
+  void unsafe_arena_set_allocated_triangle(
+      ::Rnes::TriangleState* triangle);
+  ::Rnes::TriangleState* unsafe_arena_release_triangle();
+
+  // optional .Rnes.NoiseState noise = 23;
+  bool has_noise() const;
+  private:
+  bool _internal_has_noise() const;
+  public:
+  void clear_noise();
+  const ::Rnes::NoiseState& noise() const;
+  PROTOBUF_NODISCARD ::Rnes::NoiseState* release_noise();
+  ::Rnes::NoiseState* mutable_noise();
+  void set_allocated_noise(::Rnes::NoiseState* noise);
+  private:
+  const ::Rnes::NoiseState& _internal_noise() const;
+  ::Rnes::NoiseState* _internal_mutable_noise();
+  public:
+  void unsafe_arena_set_allocated_noise(
+      ::Rnes::NoiseState* noise);
+  ::Rnes::NoiseState* unsafe_arena_release_noise();
+
+  // optional .Rnes.DmcState dmc = 24;
+  bool has_dmc() const;
+  private:
+  bool _internal_has_dmc() const;
+  public:
+  void clear_dmc();
+  const ::Rnes::DmcState& dmc() const;
+  PROTOBUF_NODISCARD ::Rnes::DmcState* release_dmc();
+  ::Rnes::DmcState* mutable_dmc();
+  void set_allocated_dmc(::Rnes::DmcState* dmc);
+  private:
+  const ::Rnes::DmcState& _internal_dmc() const;
+  ::Rnes::DmcState* _internal_mutable_dmc();
+  public:
+  void unsafe_arena_set_allocated_dmc(
+      ::Rnes::DmcState* dmc);
+  ::Rnes::DmcState* unsafe_arena_release_dmc();
+
+  // optional uint32 sampleRate = 2;
+  bool has_samplerate() const;
+  private:
+  bool _internal_has_samplerate() const;
+  public:
+  void clear_samplerate();
+  uint32_t samplerate() const;
+  void set_samplerate(uint32_t value);
+  private:
+  uint32_t _internal_samplerate() const;
+  void _internal_set_samplerate(uint32_t value);
+  public:
+
+  // optional uint32 fourFrameCount = 3;
+  bool has_fourframecount() const;
+  private:
+  bool _internal_has_fourframecount() const;
+  public:
+  void clear_fourframecount();
+  uint32_t fourframecount() const;
+  void set_fourframecount(uint32_t value);
+  private:
+  uint32_t _internal_fourframecount() const;
+  void _internal_set_fourframecount(uint32_t value);
+  public:
+
+  // optional uint32 fiveFrameCount = 4;
+  bool has_fiveframecount() const;
+  private:
+  bool _internal_has_fiveframecount() const;
+  public:
+  void clear_fiveframecount();
+  uint32_t fiveframecount() const;
+  void set_fiveframecount(uint32_t value);
+  private:
+  uint32_t _internal_fiveframecount() const;
+  void _internal_set_fiveframecount(uint32_t value);
+  public:
+
+  // optional uint32 frameDivider = 5;
+  bool has_framedivider() const;
+  private:
+  bool _internal_has_framedivider() const;
+  public:
+  void clear_framedivider();
+  uint32_t framedivider() const;
+  void set_framedivider(uint32_t value);
+  private:
+  uint32_t _internal_framedivider() const;
+  void _internal_set_framedivider(uint32_t value);
+  public:
+
+  // optional uint32 step = 6;
+  bool has_step() const;
+  private:
+  bool _internal_has_step() const;
+  public:
+  void clear_step();
+  uint32_t step() const;
+  void set_step(uint32_t value);
+  private:
+  uint32_t _internal_step() const;
+  void _internal_set_step(uint32_t value);
+  public:
+
+  // optional uint32 halfTimerDivider = 7;
+  bool has_halftimerdivider() const;
+  private:
+  bool _internal_has_halftimerdivider() const;
+  public:
+  void clear_halftimerdivider();
+  uint32_t halftimerdivider() const;
+  void set_halftimerdivider(uint32_t value);
+  private:
+  uint32_t _internal_halftimerdivider() const;
+  void _internal_set_halftimerdivider(uint32_t value);
+  public:
+
+  // optional uint32 samplerDivider = 8;
+  bool has_samplerdivider() const;
+  private:
+  bool _internal_has_samplerdivider() const;
+  public:
+  void clear_samplerdivider();
+  uint32_t samplerdivider() const;
+  void set_samplerdivider(uint32_t value);
+  private:
+  uint32_t _internal_samplerdivider() const;
+  void _internal_set_samplerdivider(uint32_t value);
+  public:
+
+  // optional float clksPerSample = 9;
+  bool has_clkspersample() const;
+  private:
+  bool _internal_has_clkspersample() const;
+  public:
+  void clear_clkspersample();
+  float clkspersample() const;
+  void set_clkspersample(float value);
+  private:
+  float _internal_clkspersample() const;
+  void _internal_set_clkspersample(float value);
+  public:
+
+  // optional float currentSampleClk = 10;
+  bool has_currentsampleclk() const;
+  private:
+  bool _internal_has_currentsampleclk() const;
+  public:
+  void clear_currentsampleclk();
+  float currentsampleclk() const;
+  void set_currentsampleclk(float value);
+  private:
+  float _internal_currentsampleclk() const;
+  void _internal_set_currentsampleclk(float value);
+  public:
+
+  // optional uint32 nextSampleCountdown = 11;
+  bool has_nextsamplecountdown() const;
+  private:
+  bool _internal_has_nextsamplecountdown() const;
+  public:
+  void clear_nextsamplecountdown();
+  uint32_t nextsamplecountdown() const;
+  void set_nextsamplecountdown(uint32_t value);
+  private:
+  uint32_t _internal_nextsamplecountdown() const;
+  void _internal_set_nextsamplecountdown(uint32_t value);
+  public:
+
+  // optional uint64 sampleClock = 13;
+  bool has_sampleclock() const;
+  private:
+  bool _internal_has_sampleclock() const;
+  public:
+  void clear_sampleclock();
+  uint64_t sampleclock() const;
+  void set_sampleclock(uint64_t value);
+  private:
+  uint64_t _internal_sampleclock() const;
+  void _internal_set_sampleclock(uint64_t value);
+  public:
+
+  // optional uint32 audioFrameCycle = 12;
+  bool has_audioframecycle() const;
+  private:
+  bool _internal_has_audioframecycle() const;
+  public:
+  void clear_audioframecycle();
+  uint32_t audioframecycle() const;
+  void set_audioframecycle(uint32_t value);
+  private:
+  uint32_t _internal_audioframecycle() const;
+  void _internal_set_audioframecycle(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.ApuState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > reg_;
+    ::Rnes::PulseState* pulsea_;
+    ::Rnes::PulseState* pulseb_;
+    ::Rnes::TriangleState* triangle_;
+    ::Rnes::NoiseState* noise_;
+    ::Rnes::DmcState* dmc_;
+    uint32_t samplerate_;
+    uint32_t fourframecount_;
+    uint32_t fiveframecount_;
+    uint32_t framedivider_;
+    uint32_t step_;
+    uint32_t halftimerdivider_;
+    uint32_t samplerdivider_;
+    float clkspersample_;
+    float currentsampleclk_;
+    uint32_t nextsamplecountdown_;
+    uint64_t sampleclock_;
+    uint32_t audioframecycle_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PpuState_SpriteState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.PpuState.SpriteState) */ {
+ public:
+  inline PpuState_SpriteState() : PpuState_SpriteState(nullptr) {}
+  ~PpuState_SpriteState() override;
+  explicit PROTOBUF_CONSTEXPR PpuState_SpriteState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PpuState_SpriteState(const PpuState_SpriteState& from);
+  PpuState_SpriteState(PpuState_SpriteState&& from) noexcept
+    : PpuState_SpriteState() {
+    *this = ::std::move(from);
+  }
+
+  inline PpuState_SpriteState& operator=(const PpuState_SpriteState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PpuState_SpriteState& operator=(PpuState_SpriteState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PpuState_SpriteState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PpuState_SpriteState* internal_default_instance() {
+    return reinterpret_cast<const PpuState_SpriteState*>(
+               &_PpuState_SpriteState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(PpuState_SpriteState& a, PpuState_SpriteState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PpuState_SpriteState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PpuState_SpriteState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PpuState_SpriteState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PpuState_SpriteState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PpuState_SpriteState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PpuState_SpriteState& from) {
+    PpuState_SpriteState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PpuState_SpriteState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.PpuState.SpriteState";
+  }
+  protected:
+  explicit PpuState_SpriteState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kYCoordMinus1FieldNumber = 1,
+    kTileIndexFieldNumber = 2,
+    kAttrFieldNumber = 3,
+    kXCoordFieldNumber = 4,
+  };
+  // optional uint32 yCoordMinus1 = 1;
+  bool has_ycoordminus1() const;
+  private:
+  bool _internal_has_ycoordminus1() const;
+  public:
+  void clear_ycoordminus1();
+  uint32_t ycoordminus1() const;
+  void set_ycoordminus1(uint32_t value);
+  private:
+  uint32_t _internal_ycoordminus1() const;
+  void _internal_set_ycoordminus1(uint32_t value);
+  public:
+
+  // optional uint32 tileIndex = 2;
+  bool has_tileindex() const;
+  private:
+  bool _internal_has_tileindex() const;
+  public:
+  void clear_tileindex();
+  uint32_t tileindex() const;
+  void set_tileindex(uint32_t value);
+  private:
+  uint32_t _internal_tileindex() const;
+  void _internal_set_tileindex(uint32_t value);
+  public:
+
+  // optional uint32 attr = 3;
+  bool has_attr() const;
+  private:
+  bool _internal_has_attr() const;
+  public:
+  void clear_attr();
+  uint32_t attr() const;
+  void set_attr(uint32_t value);
+  private:
+  uint32_t _internal_attr() const;
+  void _internal_set_attr(uint32_t value);
+  public:
+
+  // optional uint32 xCoord = 4;
+  bool has_xcoord() const;
+  private:
+  bool _internal_has_xcoord() const;
+  public:
+  void clear_xcoord();
+  uint32_t xcoord() const;
+  void set_xcoord(uint32_t value);
+  private:
+  uint32_t _internal_xcoord() const;
+  void _internal_set_xcoord(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.PpuState.SpriteState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t ycoordminus1_;
+    uint32_t tileindex_;
+    uint32_t attr_;
+    uint32_t xcoord_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PpuState_DotState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.PpuState.DotState) */ {
+ public:
+  inline PpuState_DotState() : PpuState_DotState(nullptr) {}
+  ~PpuState_DotState() override;
+  explicit PROTOBUF_CONSTEXPR PpuState_DotState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PpuState_DotState(const PpuState_DotState& from);
+  PpuState_DotState(PpuState_DotState&& from) noexcept
+    : PpuState_DotState() {
+    *this = ::std::move(from);
+  }
+
+  inline PpuState_DotState& operator=(const PpuState_DotState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PpuState_DotState& operator=(PpuState_DotState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PpuState_DotState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PpuState_DotState* internal_default_instance() {
+    return reinterpret_cast<const PpuState_DotState*>(
+               &_PpuState_DotState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(PpuState_DotState& a, PpuState_DotState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PpuState_DotState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PpuState_DotState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PpuState_DotState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PpuState_DotState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PpuState_DotState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PpuState_DotState& from) {
+    PpuState_DotState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PpuState_DotState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.PpuState.DotState";
+  }
+  protected:
+  explicit PpuState_DotState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSecondaryOamFieldNumber = 9,
+    kSpritePatternLoFieldNumber = 18,
+    kSpritePatternHiFieldNumber = 19,
+    kSpriteAttrFieldNumber = 20,
+    kSpriteXFieldNumber = 21,
+    kBgPatternShiftLoFieldNumber = 1,
+    kBgPatternShiftHiFieldNumber = 2,
+    kBgAttrShiftLoFieldNumber = 3,
+    kBgAttrShiftHiFieldNumber = 4,
+    kNameLatchFieldNumber = 5,
+    kAttrLatchFieldNumber = 6,
+    kPatternLatchLoFieldNumber = 7,
+    kPatternLatchHiFieldNumber = 8,
+    kOamLatchFieldNumber = 10,
+    kEvalSpriteFieldNumber = 11,
+    kEvalByteFieldNumber = 12,
+    kSecondaryOamAddrFieldNumber = 13,
+    kLineSpriteCountFieldNumber = 16,
+    kEvalDoneFieldNumber = 14,
+    kSprite0NextFieldNumber = 15,
+    kLineHasSprite0FieldNumber = 17,
+    kA12HighFieldNumber = 22,
+    kA12LowCycleFieldNumber = 23,
+  };
+  // optional bytes secondaryOam = 9;
+  bool has_secondaryoam() const;
+  private:
+  bool _internal_has_secondaryoam() const;
+  public:
+  void clear_secondaryoam();
+  const std::string& secondaryoam() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_secondaryoam(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_secondaryoam();
+  PROTOBUF_NODISCARD std::string* release_secondaryoam();
+  void set_allocated_secondaryoam(std::string* secondaryoam);
+  private:
+  const std::string& _internal_secondaryoam() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_secondaryoam(const std::string& value);
+  std::string* _internal_mutable_secondaryoam();
+  public:
+
+  // optional bytes spritePatternLo = 18;
+  bool has_spritepatternlo() const;
+  private:
+  bool _internal_has_spritepatternlo() const;
+  public:
+  void clear_spritepatternlo();
+  const std::string& spritepatternlo() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_spritepatternlo(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_spritepatternlo();
+  PROTOBUF_NODISCARD std::string* release_spritepatternlo();
+  void set_allocated_spritepatternlo(std::string* spritepatternlo);
+  private:
+  const std::string& _internal_spritepatternlo() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_spritepatternlo(const std::string& value);
+  std::string* _internal_mutable_spritepatternlo();
+  public:
+
+  // optional bytes spritePatternHi = 19;
+  bool has_spritepatternhi() const;
+  private:
+  bool _internal_has_spritepatternhi() const;
+  public:
+  void clear_spritepatternhi();
+  const std::string& spritepatternhi() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_spritepatternhi(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_spritepatternhi();
+  PROTOBUF_NODISCARD std::string* release_spritepatternhi();
+  void set_allocated_spritepatternhi(std::string* spritepatternhi);
+  private:
+  const std::string& _internal_spritepatternhi() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_spritepatternhi(const std::string& value);
+  std::string* _internal_mutable_spritepatternhi();
+  public:
+
+  // optional bytes spriteAttr = 20;
+  bool has_spriteattr() const;
+  private:
+  bool _internal_has_spriteattr() const;
+  public:
+  void clear_spriteattr();
+  const std::string& spriteattr() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_spriteattr(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_spriteattr();
+  PROTOBUF_NODISCARD std::string* release_spriteattr();
+  void set_allocated_spriteattr(std::string* spriteattr);
+  private:
+  const std::string& _internal_spriteattr() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_spriteattr(const std::string& value);
+  std::string* _internal_mutable_spriteattr();
+  public:
+
+  // optional bytes spriteX = 21;
+  bool has_spritex() const;
+  private:
+  bool _internal_has_spritex() const;
+  public:
+  void clear_spritex();
+  const std::string& spritex() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_spritex(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_spritex();
+  PROTOBUF_NODISCARD std::string* release_spritex();
+  void set_allocated_spritex(std::string* spritex);
+  private:
+  const std::string& _internal_spritex() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_spritex(const std::string& value);
+  std::string* _internal_mutable_spritex();
+  public:
+
+  // optional uint32 bgPatternShiftLo = 1;
+  bool has_bgpatternshiftlo() const;
+  private:
+  bool _internal_has_bgpatternshiftlo() const;
+  public:
+  void clear_bgpatternshiftlo();
+  uint32_t bgpatternshiftlo() const;
+  void set_bgpatternshiftlo(uint32_t value);
+  private:
+  uint32_t _internal_bgpatternshiftlo() const;
+  void _internal_set_bgpatternshiftlo(uint32_t value);
+  public:
+
+  // optional uint32 bgPatternShiftHi = 2;
+  bool has_bgpatternshifthi() const;
+  private:
+  bool _internal_has_bgpatternshifthi() const;
+  public:
+  void clear_bgpatternshifthi();
+  uint32_t bgpatternshifthi() const;
+  void set_bgpatternshifthi(uint32_t value);
+  private:
+  uint32_t _internal_bgpatternshifthi() const;
+  void _internal_set_bgpatternshifthi(uint32_t value);
+  public:
+
+  // optional uint32 bgAttrShiftLo = 3;
+  bool has_bgattrshiftlo() const;
+  private:
+  bool _internal_has_bgattrshiftlo() const;
+  public:
+  void clear_bgattrshiftlo();
+  uint32_t bgattrshiftlo() const;
+  void set_bgattrshiftlo(uint32_t value);
+  private:
+  uint32_t _internal_bgattrshiftlo() const;
+  void _internal_set_bgattrshiftlo(uint32_t value);
+  public:
+
+  // optional uint32 bgAttrShiftHi = 4;
+  bool has_bgattrshifthi() const;
+  private:
+  bool _internal_has_bgattrshifthi() const;
+  public:
+  void clear_bgattrshifthi();
+  uint32_t bgattrshifthi() const;
+  void set_bgattrshifthi(uint32_t value);
+  private:
+  uint32_t _internal_bgattrshifthi() const;
+  void _internal_set_bgattrshifthi(uint32_t value);
+  public:
+
+  // optional uint32 nameLatch = 5;
+  bool has_namelatch() const;
+  private:
+  bool _internal_has_namelatch() const;
+  public:
+  void clear_namelatch();
+  uint32_t namelatch() const;
+  void set_namelatch(uint32_t value);
+  private:
+  uint32_t _internal_namelatch() const;
+  void _internal_set_namelatch(uint32_t value);
+  public:
+
+  // optional uint32 attrLatch = 6;
+  bool has_attrlatch() const;
+  private:
+  bool _internal_has_attrlatch() const;
+  public:
+  void clear_attrlatch();
+  uint32_t attrlatch() const;
+  void set_attrlatch(uint32_t value);
+  private:
+  uint32_t _internal_attrlatch() const;
+  void _internal_set_attrlatch(uint32_t value);
+  public:
+
+  // optional uint32 patternLatchLo = 7;
+  bool has_patternlatchlo() const;
+  private:
+  bool _internal_has_patternlatchlo() const;
+  public:
+  void clear_patternlatchlo();
+  uint32_t patternlatchlo() const;
+  void set_patternlatchlo(uint32_t value);
+  private:
+  uint32_t _internal_patternlatchlo() const;
+  void _internal_set_patternlatchlo(uint32_t value);
+  public:
+
+  // optional uint32 patternLatchHi = 8;
+  bool has_patternlatchhi() const;
+  private:
+  bool _internal_has_patternlatchhi() const;
+  public:
+  void clear_patternlatchhi();
+  uint32_t patternlatchhi() const;
+  void set_patternlatchhi(uint32_t value);
+  private:
+  uint32_t _internal_patternlatchhi() const;
+  void _internal_set_patternlatchhi(uint32_t value);
+  public:
+
+  // optional uint32 oamLatch = 10;
+  bool has_oamlatch() const;
+  private:
+  bool _internal_has_oamlatch() const;
+  public:
+  void clear_oamlatch();
+  uint32_t oamlatch() const;
+  void set_oamlatch(uint32_t value);
+  private:
+  uint32_t _internal_oamlatch() const;
+  void _internal_set_oamlatch(uint32_t value);
+  public:
+
+  // optional uint32 evalSprite = 11;
+  bool has_evalsprite() const;
+  private:
+  bool _internal_has_evalsprite() const;
+  public:
+  void clear_evalsprite();
+  uint32_t evalsprite() const;
+  void set_evalsprite(uint32_t value);
+  private:
+  uint32_t _internal_evalsprite() const;
+  void _internal_set_evalsprite(uint32_t value);
+  public:
+
+  // optional uint32 evalByte = 12;
+  bool has_evalbyte() const;
+  private:
+  bool _internal_has_evalbyte() const;
+  public:
+  void clear_evalbyte();
+  uint32_t evalbyte() const;
+  void set_evalbyte(uint32_t value);
+  private:
+  uint32_t _internal_evalbyte() const;
+  void _internal_set_evalbyte(uint32_t value);
+  public:
+
+  // optional uint32 secondaryOamAddr = 13;
+  bool has_secondaryoamaddr() const;
+  private:
+  bool _internal_has_secondaryoamaddr() const;
+  public:
+  void clear_secondaryoamaddr();
+  uint32_t secondaryoamaddr() const;
+  void set_secondaryoamaddr(uint32_t value);
+  private:
+  uint32_t _internal_secondaryoamaddr() const;
+  void _internal_set_secondaryoamaddr(uint32_t value);
+  public:
+
+  // optional uint32 lineSpriteCount = 16;
+  bool has_linespritecount() const;
+  private:
+  bool _internal_has_linespritecount() const;
+  public:
+  void clear_linespritecount();
+  uint32_t linespritecount() const;
+  void set_linespritecount(uint32_t value);
+  private:
+  uint32_t _internal_linespritecount() const;
+  void _internal_set_linespritecount(uint32_t value);
+  public:
+
+  // optional bool evalDone = 14;
+  bool has_evaldone() const;
+  private:
+  bool _internal_has_evaldone() const;
+  public:
+  void clear_evaldone();
+  bool evaldone() const;
+  void set_evaldone(bool value);
+  private:
+  bool _internal_evaldone() const;
+  void _internal_set_evaldone(bool value);
+  public:
+
+  // optional bool sprite0Next = 15;
+  bool has_sprite0next() const;
+  private:
+  bool _internal_has_sprite0next() const;
+  public:
+  void clear_sprite0next();
+  bool sprite0next() const;
+  void set_sprite0next(bool value);
+  private:
+  bool _internal_sprite0next() const;
+  void _internal_set_sprite0next(bool value);
+  public:
+
+  // optional bool lineHasSprite0 = 17;
+  bool has_linehassprite0() const;
+  private:
+  bool _internal_has_linehassprite0() const;
+  public:
+  void clear_linehassprite0();
+  bool linehassprite0() const;
+  void set_linehassprite0(bool value);
+  private:
+  bool _internal_linehassprite0() const;
+  void _internal_set_linehassprite0(bool value);
+  public:
+
+  // optional bool a12High = 22;
+  bool has_a12high() const;
+  private:
+  bool _internal_has_a12high() const;
+  public:
+  void clear_a12high();
+  bool a12high() const;
+  void set_a12high(bool value);
+  private:
+  bool _internal_a12high() const;
+  void _internal_set_a12high(bool value);
+  public:
+
+  // optional uint64 a12LowCycle = 23;
+  bool has_a12lowcycle() const;
+  private:
+  bool _internal_has_a12lowcycle() const;
+  public:
+  void clear_a12lowcycle();
+  uint64_t a12lowcycle() const;
+  void set_a12lowcycle(uint64_t value);
+  private:
+  uint64_t _internal_a12lowcycle() const;
+  void _internal_set_a12lowcycle(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.PpuState.DotState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr secondaryoam_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr spritepatternlo_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr spritepatternhi_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr spriteattr_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr spritex_;
+    uint32_t bgpatternshiftlo_;
+    uint32_t bgpatternshifthi_;
+    uint32_t bgattrshiftlo_;
+    uint32_t bgattrshifthi_;
+    uint32_t namelatch_;
+    uint32_t attrlatch_;
+    uint32_t patternlatchlo_;
+    uint32_t patternlatchhi_;
+    uint32_t oamlatch_;
+    uint32_t evalsprite_;
+    uint32_t evalbyte_;
+    uint32_t secondaryoamaddr_;
+    uint32_t linespritecount_;
+    bool evaldone_;
+    bool sprite0next_;
+    bool linehassprite0_;
+    bool a12high_;
+    uint64_t a12lowcycle_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PpuState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.PpuState) */ {
+ public:
+  inline PpuState() : PpuState(nullptr) {}
+  ~PpuState() override;
+  explicit PROTOBUF_CONSTEXPR PpuState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PpuState(const PpuState& from);
+  PpuState(PpuState&& from) noexcept
+    : PpuState() {
+    *this = ::std::move(from);
+  }
+
+  inline PpuState& operator=(const PpuState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PpuState& operator=(PpuState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PpuState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PpuState* internal_default_instance() {
+    return reinterpret_cast<const PpuState*>(
+               &_PpuState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(PpuState& a, PpuState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PpuState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PpuState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PpuState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PpuState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PpuState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PpuState& from) {
+    PpuState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PpuState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.PpuState";
+  }
+  protected:
+  explicit PpuState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef PpuState_SpriteState SpriteState;
+  typedef PpuState_DotState DotState;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRegsFieldNumber = 3,
+    kSpriteRamFieldNumber = 4,
+    kDotFieldNumber = 14,
+    kCycleFieldNumber = 1,
+    kFrameFieldNumber = 2,
+    kVramToggleFieldNumber = 5,
+    kVramFineXScrollFieldNumber = 6,
+    kVramCurrentAddrFieldNumber = 7,
+    kVramTempAddrFieldNumber = 8,
+    kVramMachineAddrFieldNumber = 9,
+    kVramReadLatchFieldNumber = 10,
+    kScrollingMachineStateFieldNumber = 11,
+    kXScrollOriginFieldNumber = 12,
+    kYScrollOriginFieldNumber = 13,
+  };
+  // repeated uint32 regs = 3;
+  int regs_size() const;
+  private:
+  int _internal_regs_size() const;
+  public:
+  void clear_regs();
+  private:
+  uint32_t _internal_regs(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_regs() const;
+  void _internal_add_regs(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_regs();
+  public:
+  uint32_t regs(int index) const;
+  void set_regs(int index, uint32_t value);
+  void add_regs(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      regs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_regs();
+
+  // repeated .Rnes.PpuState.SpriteState spriteRam = 4;
+  int spriteram_size() const;
+  private:
+  int _internal_spriteram_size() const;
+  public:
+  void clear_spriteram();
+  ::Rnes::PpuState_SpriteState* mutable_spriteram(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Rnes::PpuState_SpriteState >*
+      mutable_spriteram();
+  private:
+  const ::Rnes::PpuState_SpriteState& _internal_spriteram(int index) const;
+  ::Rnes::PpuState_SpriteState* _internal_add_spriteram();
+  public:
+  const ::Rnes::PpuState_SpriteState& spriteram(int index) const;
+  ::Rnes::PpuState_SpriteState* add_spriteram();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Rnes::PpuState_SpriteState >&
+      spriteram() const;
+
+  // optional .Rnes.PpuState.DotState dot = 14;
+  bool has_dot() const;
+  private:
+  bool _internal_has_dot() const;
+  public:
+  void clear_dot();
+  const ::Rnes::PpuState_DotState& dot() const;
+  PROTOBUF_NODISCARD ::Rnes::PpuState_DotState* release_dot();
+  ::Rnes::PpuState_DotState* mutable_dot();
+  void set_allocated_dot(::Rnes::PpuState_DotState* dot);
+  private:
+  const ::Rnes::PpuState_DotState& _internal_dot() const;
+  ::Rnes::PpuState_DotState* _internal_mutable_dot();
+  public:
+  void unsafe_arena_set_allocated_dot(
+      ::Rnes::PpuState_DotState* dot);
+  ::Rnes::PpuState_DotState* unsafe_arena_release_dot();
+
+  // optional uint64 cycle = 1;
+  bool has_cycle() const;
+  private:
+  bool _internal_has_cycle() const;
+  public:
+  void clear_cycle();
+  uint64_t cycle() const;
+  void set_cycle(uint64_t value);
+  private:
+  uint64_t _internal_cycle() const;
+  void _internal_set_cycle(uint64_t value);
+  public:
+
+  // optional uint64 frame = 2;
+  bool has_frame() const;
+  private:
+  bool _internal_has_frame() const;
+  public:
+  void clear_frame();
+  uint64_t frame() const;
+  void set_frame(uint64_t value);
+  private:
+  uint64_t _internal_frame() const;
+  void _internal_set_frame(uint64_t value);
+  public:
+
+  // optional uint32 vramToggle = 5;
+  bool has_vramtoggle() const;
+  private:
+  bool _internal_has_vramtoggle() const;
+  public:
+  void clear_vramtoggle();
+  uint32_t vramtoggle() const;
+  void set_vramtoggle(uint32_t value);
+  private:
+  uint32_t _internal_vramtoggle() const;
+  void _internal_set_vramtoggle(uint32_t value);
+  public:
+
+  // optional uint32 vramFineXScroll = 6;
+  bool has_vramfinexscroll() const;
+  private:
+  bool _internal_has_vramfinexscroll() const;
+  public:
+  void clear_vramfinexscroll();
+  uint32_t vramfinexscroll() const;
+  void set_vramfinexscroll(uint32_t value);
+  private:
+  uint32_t _internal_vramfinexscroll() const;
+  void _internal_set_vramfinexscroll(uint32_t value);
+  public:
+
+  // optional uint32 vramCurrentAddr = 7;
+  bool has_vramcurrentaddr() const;
+  private:
+  bool _internal_has_vramcurrentaddr() const;
+  public:
+  void clear_vramcurrentaddr();
+  uint32_t vramcurrentaddr() const;
+  void set_vramcurrentaddr(uint32_t value);
+  private:
+  uint32_t _internal_vramcurrentaddr() const;
+  void _internal_set_vramcurrentaddr(uint32_t value);
+  public:
+
+  // optional uint32 vramTempAddr = 8;
+  bool has_vramtempaddr() const;
+  private:
+  bool _internal_has_vramtempaddr() const;
+  public:
+  void clear_vramtempaddr();
+  uint32_t vramtempaddr() const;
+  void set_vramtempaddr(uint32_t value);
+  private:
+  uint32_t _internal_vramtempaddr() const;
+  void _internal_set_vramtempaddr(uint32_t value);
+  public:
+
+  // optional uint32 vramMachineAddr = 9;
+  bool has_vrammachineaddr() const;
+  private:
+  bool _internal_has_vrammachineaddr() const;
+  public:
+  void clear_vrammachineaddr();
+  uint32_t vrammachineaddr() const;
+  void set_vrammachineaddr(uint32_t value);
+  private:
+  uint32_t _internal_vrammachineaddr() const;
+  void _internal_set_vrammachineaddr(uint32_t value);
+  public:
+
+  // optional uint32 vramReadLatch = 10;
+  bool has_vramreadlatch() const;
+  private:
+  bool _internal_has_vramreadlatch() const;
+  public:
+  void clear_vramreadlatch();
+  uint32_t vramreadlatch() const;
+  void set_vramreadlatch(uint32_t value);
+  private:
+  uint32_t _internal_vramreadlatch() const;
+  void _internal_set_vramreadlatch(uint32_t value);
+  public:
+
+  // optional uint32 scrollingMachineState = 11;
+  bool has_scrollingmachinestate() const;
+  private:
+  bool _internal_has_scrollingmachinestate() const;
+  public:
+  void clear_scrollingmachinestate();
+  uint32_t scrollingmachinestate() const;
+  void set_scrollingmachinestate(uint32_t value);
+  private:
+  uint32_t _internal_scrollingmachinestate() const;
+  void _internal_set_scrollingmachinestate(uint32_t value);
+  public:
+
+  // optional uint32 xScrollOrigin = 12;
+  bool has_xscrollorigin() const;
+  private:
+  bool _internal_has_xscrollorigin() const;
+  public:
+  void clear_xscrollorigin();
+  uint32_t xscrollorigin() const;
+  void set_xscrollorigin(uint32_t value);
+  private:
+  uint32_t _internal_xscrollorigin() const;
+  void _internal_set_xscrollorigin(uint32_t value);
+  public:
+
+  // optional uint32 yScrollOrigin = 13;
+  bool has_yscrollorigin() const;
+  private:
+  bool _internal_has_yscrollorigin() const;
+  public:
+  void clear_yscrollorigin();
+  uint32_t yscrollorigin() const;
+  void set_yscrollorigin(uint32_t value);
+  private:
+  uint32_t _internal_yscrollorigin() const;
+  void _internal_set_yscrollorigin(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.PpuState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > regs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Rnes::PpuState_SpriteState > spriteram_;
+    ::Rnes::PpuState_DotState* dot_;
+    uint64_t cycle_;
+    uint64_t frame_;
+    uint32_t vramtoggle_;
+    uint32_t vramfinexscroll_;
+    uint32_t vramcurrentaddr_;
+    uint32_t vramtempaddr_;
+    uint32_t vrammachineaddr_;
+    uint32_t vramreadlatch_;
+    uint32_t scrollingmachinestate_;
+    uint32_t xscrollorigin_;
+    uint32_t yscrollorigin_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MmcState_MmcNoneState final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:Rnes.MmcState.MmcNoneState) */ {
+ public:
+  inline MmcState_MmcNoneState() : MmcState_MmcNoneState(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR MmcState_MmcNoneState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MmcState_MmcNoneState(const MmcState_MmcNoneState& from);
+  MmcState_MmcNoneState(MmcState_MmcNoneState&& from) noexcept
+    : MmcState_MmcNoneState() {
+    *this = ::std::move(from);
+  }
+
+  inline MmcState_MmcNoneState& operator=(const MmcState_MmcNoneState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MmcState_MmcNoneState& operator=(MmcState_MmcNoneState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MmcState_MmcNoneState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MmcState_MmcNoneState* internal_default_instance() {
+    return reinterpret_cast<const MmcState_MmcNoneState*>(
+               &_MmcState_MmcNoneState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(MmcState_MmcNoneState& a, MmcState_MmcNoneState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MmcState_MmcNoneState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MmcState_MmcNoneState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MmcState_MmcNoneState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MmcState_MmcNoneState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const MmcState_MmcNoneState& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const MmcState_MmcNoneState& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.MmcState.MmcNoneState";
+  }
+  protected:
+  explicit MmcState_MmcNoneState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:Rnes.MmcState.MmcNoneState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MmcState_Mmc1State final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.MmcState.Mmc1State) */ {
+ public:
+  inline MmcState_Mmc1State() : MmcState_Mmc1State(nullptr) {}
+  ~MmcState_Mmc1State() override;
+  explicit PROTOBUF_CONSTEXPR MmcState_Mmc1State(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MmcState_Mmc1State(const MmcState_Mmc1State& from);
+  MmcState_Mmc1State(MmcState_Mmc1State&& from) noexcept
+    : MmcState_Mmc1State() {
+    *this = ::std::move(from);
+  }
+
+  inline MmcState_Mmc1State& operator=(const MmcState_Mmc1State& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MmcState_Mmc1State& operator=(MmcState_Mmc1State&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MmcState_Mmc1State& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MmcState_Mmc1State* internal_default_instance() {
+    return reinterpret_cast<const MmcState_Mmc1State*>(
+               &_MmcState_Mmc1State_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(MmcState_Mmc1State& a, MmcState_Mmc1State& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MmcState_Mmc1State* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MmcState_Mmc1State* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MmcState_Mmc1State* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MmcState_Mmc1State>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MmcState_Mmc1State& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MmcState_Mmc1State& from) {
+    MmcState_Mmc1State::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MmcState_Mmc1State* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.MmcState.Mmc1State";
+  }
+  protected:
+  explicit MmcState_Mmc1State(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kControlRegFieldNumber = 1,
+    kChr0BankFieldNumber = 2,
+    kChr1BankFieldNumber = 3,
+    kPrgBankFieldNumber = 4,
+    kShiftRegisterFieldNumber = 5,
+  };
+  // optional uint32 controlReg = 1;
+  bool has_controlreg() const;
+  private:
+  bool _internal_has_controlreg() const;
+  public:
+  void clear_controlreg();
+  uint32_t controlreg() const;
+  void set_controlreg(uint32_t value);
+  private:
+  uint32_t _internal_controlreg() const;
+  void _internal_set_controlreg(uint32_t value);
+  public:
+
+  // optional uint32 chr0Bank = 2;
+  bool has_chr0bank() const;
+  private:
+  bool _internal_has_chr0bank() const;
+  public:
+  void clear_chr0bank();
+  uint32_t chr0bank() const;
+  void set_chr0bank(uint32_t value);
+  private:
+  uint32_t _internal_chr0bank() const;
+  void _internal_set_chr0bank(uint32_t value);
+  public:
+
+  // optional uint32 chr1Bank = 3;
+  bool has_chr1bank() const;
+  private:
+  bool _internal_has_chr1bank() const;
+  public:
+  void clear_chr1bank();
+  uint32_t chr1bank() const;
+  void set_chr1bank(uint32_t value);
+  private:
+  uint32_t _internal_chr1bank() const;
+  void _internal_set_chr1bank(uint32_t value);
+  public:
+
+  // optional uint32 prgBank = 4;
+  bool has_prgbank() const;
+  private:
+  bool _internal_has_prgbank() const;
+  public:
+  void clear_prgbank();
+  uint32_t prgbank() const;
+  void set_prgbank(uint32_t value);
+  private:
+  uint32_t _internal_prgbank() const;
+  void _internal_set_prgbank(uint32_t value);
+  public:
+
+  // optional uint32 shiftRegister = 5;
+  bool has_shiftregister() const;
+  private:
+  bool _internal_has_shiftregister() const;
+  public:
+  void clear_shiftregister();
+  uint32_t shiftregister() const;
+  void set_shiftregister(uint32_t value);
+  private:
+  uint32_t _internal_shiftregister() const;
+  void _internal_set_shiftregister(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.MmcState.Mmc1State)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t controlreg_;
+    uint32_t chr0bank_;
+    uint32_t chr1bank_;
+    uint32_t prgbank_;
+    uint32_t shiftregister_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MmcState_Mmc3State final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.MmcState.Mmc3State) */ {
+ public:
+  inline MmcState_Mmc3State() : MmcState_Mmc3State(nullptr) {}
+  ~MmcState_Mmc3State() override;
+  explicit PROTOBUF_CONSTEXPR MmcState_Mmc3State(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MmcState_Mmc3State(const MmcState_Mmc3State& from);
+  MmcState_Mmc3State(MmcState_Mmc3State&& from) noexcept
+    : MmcState_Mmc3State() {
+    *this = ::std::move(from);
+  }
+
+  inline MmcState_Mmc3State& operator=(const MmcState_Mmc3State& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MmcState_Mmc3State& operator=(MmcState_Mmc3State&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MmcState_Mmc3State& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MmcState_Mmc3State* internal_default_instance() {
+    return reinterpret_cast<const MmcState_Mmc3State*>(
+               &_MmcState_Mmc3State_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(MmcState_Mmc3State& a, MmcState_Mmc3State& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MmcState_Mmc3State* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MmcState_Mmc3State* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MmcState_Mmc3State* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MmcState_Mmc3State>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MmcState_Mmc3State& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MmcState_Mmc3State& from) {
+    MmcState_Mmc3State::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MmcState_Mmc3State* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.MmcState.Mmc3State";
+  }
+  protected:
+  explicit MmcState_Mmc3State(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBankRegisterFieldNumber = 4,
+    kBankSelectRegFieldNumber = 1,
+    kMirrorRegFieldNumber = 2,
+    kPrgRamRegFieldNumber = 3,
+    kIrqReloadRegFieldNumber = 5,
+    kIrqCounterRegFieldNumber = 6,
+    kIrqEnabledFieldNumber = 7,
+    kIrqPendingFieldNumber = 8,
+  };
+  // optional bytes bankRegister = 4;
+  bool has_bankregister() const;
+  private:
+  bool _internal_has_bankregister() const;
+  public:
+  void clear_bankregister();
+  const std::string& bankregister() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bankregister(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bankregister();
+  PROTOBUF_NODISCARD std::string* release_bankregister();
+  void set_allocated_bankregister(std::string* bankregister);
+  private:
+  const std::string& _internal_bankregister() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bankregister(const std::string& value);
+  std::string* _internal_mutable_bankregister();
+  public:
+
+  // optional uint32 bankSelectReg = 1;
+  bool has_bankselectreg() const;
+  private:
+  bool _internal_has_bankselectreg() const;
+  public:
+  void clear_bankselectreg();
+  uint32_t bankselectreg() const;
+  void set_bankselectreg(uint32_t value);
+  private:
+  uint32_t _internal_bankselectreg() const;
+  void _internal_set_bankselectreg(uint32_t value);
+  public:
+
+  // optional uint32 mirrorReg = 2;
+  bool has_mirrorreg() const;
+  private:
+  bool _internal_has_mirrorreg() const;
+  public:
+  void clear_mirrorreg();
+  uint32_t mirrorreg() const;
+  void set_mirrorreg(uint32_t value);
+  private:
+  uint32_t _internal_mirrorreg() const;
+  void _internal_set_mirrorreg(uint32_t value);
+  public:
+
+  // optional uint32 prgRamReg = 3;
+  bool has_prgramreg() const;
+  private:
+  bool _internal_has_prgramreg() const;
+  public:
+  void clear_prgramreg();
+  uint32_t prgramreg() const;
+  void set_prgramreg(uint32_t value);
+  private:
+  uint32_t _internal_prgramreg() const;
+  void _internal_set_prgramreg(uint32_t value);
+  public:
+
+  // optional uint32 irqReloadReg = 5;
+  bool has_irqreloadreg() const;
+  private:
+  bool _internal_has_irqreloadreg() const;
+  public:
+  void clear_irqreloadreg();
+  uint32_t irqreloadreg() const;
+  void set_irqreloadreg(uint32_t value);
+  private:
+  uint32_t _internal_irqreloadreg() const;
+  void _internal_set_irqreloadreg(uint32_t value);
+  public:
+
+  // optional uint32 irqCounterReg = 6;
+  bool has_irqcounterreg() const;
+  private:
+  bool _internal_has_irqcounterreg() const;
+  public:
+  void clear_irqcounterreg();
+  uint32_t irqcounterreg() const;
+  void set_irqcounterreg(uint32_t value);
+  private:
+  uint32_t _internal_irqcounterreg() const;
+  void _internal_set_irqcounterreg(uint32_t value);
+  public:
+
+  // optional bool irqEnabled = 7;
+  bool has_irqenabled() const;
+  private:
+  bool _internal_has_irqenabled() const;
+  public:
+  void clear_irqenabled();
+  bool irqenabled() const;
+  void set_irqenabled(bool value);
+  private:
+  bool _internal_irqenabled() const;
+  void _internal_set_irqenabled(bool value);
+  public:
+
+  // optional bool irqPending = 8;
+  bool has_irqpending() const;
+  private:
+  bool _internal_has_irqpending() const;
+  public:
+  void clear_irqpending();
+  bool irqpending() const;
+  void set_irqpending(bool value);
+  private:
+  bool _internal_irqpending() const;
+  void _internal_set_irqpending(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.MmcState.Mmc3State)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bankregister_;
+    uint32_t bankselectreg_;
+    uint32_t mirrorreg_;
+    uint32_t prgramreg_;
+    uint32_t irqreloadreg_;
+    uint32_t irqcounterreg_;
+    bool irqenabled_;
+    bool irqpending_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MmcState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.MmcState) */ {
+ public:
+  inline MmcState() : MmcState(nullptr) {}
+  ~MmcState() override;
+  explicit PROTOBUF_CONSTEXPR MmcState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MmcState(const MmcState& from);
+  MmcState(MmcState&& from) noexcept
+    : MmcState() {
+    *this = ::std::move(from);
+  }
+
+  inline MmcState& operator=(const MmcState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MmcState& operator=(MmcState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MmcState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MmcState* internal_default_instance() {
+    return reinterpret_cast<const MmcState*>(
+               &_MmcState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(MmcState& a, MmcState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MmcState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MmcState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MmcState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MmcState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MmcState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MmcState& from) {
+    MmcState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MmcState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.MmcState";
+  }
+  protected:
+  explicit MmcState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MmcState_MmcNoneState MmcNoneState;
+  typedef MmcState_Mmc1State Mmc1State;
+  typedef MmcState_Mmc3State Mmc3State;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMmcNoneFieldNumber = 1,
+    kMmc1FieldNumber = 2,
+    kMmc3FieldNumber = 3,
+  };
+  // optional .Rnes.MmcState.MmcNoneState mmcNone = 1;
+  bool has_mmcnone() const;
+  private:
+  bool _internal_has_mmcnone() const;
+  public:
+  void clear_mmcnone();
+  const ::Rnes::MmcState_MmcNoneState& mmcnone() const;
+  PROTOBUF_NODISCARD ::Rnes::MmcState_MmcNoneState* release_mmcnone();
+  ::Rnes::MmcState_MmcNoneState* mutable_mmcnone();
+  void set_allocated_mmcnone(::Rnes::MmcState_MmcNoneState* mmcnone);
+  private:
+  const ::Rnes::MmcState_MmcNoneState& _internal_mmcnone() const;
+  ::Rnes::MmcState_MmcNoneState* _internal_mutable_mmcnone();
+  public:
+  void unsafe_arena_set_allocated_mmcnone(
+      ::Rnes::MmcState_MmcNoneState* mmcnone);
+  ::Rnes::MmcState_MmcNoneState* unsafe_arena_release_mmcnone();
+
+  // optional .Rnes.MmcState.Mmc1State mmc1 = 2;
+  bool has_mmc1() const;
+  private:
+  bool _internal_has_mmc1() const;
+  public:
+  void clear_mmc1();
+  const ::Rnes::MmcState_Mmc1State& mmc1() const;
+  PROTOBUF_NODISCARD ::Rnes::MmcState_Mmc1State* release_mmc1();
+  ::Rnes::MmcState_Mmc1State* mutable_mmc1();
+  void set_allocated_mmc1(::Rnes::MmcState_Mmc1State* mmc1);
+  private:
+  const ::Rnes::MmcState_Mmc1State& _internal_mmc1() const;
+  ::Rnes::MmcState_Mmc1State* _internal_mutable_mmc1();
+  public:
+  void unsafe_arena_set_allocated_mmc1(
+      ::Rnes::MmcState_Mmc1State* mmc1);
+  ::Rnes::MmcState_Mmc1State* unsafe_arena_release_mmc1();
+
+  // optional .Rnes.MmcState.Mmc3State mmc3 = 3;
+  bool has_mmc3() const;
+  private:
+  bool _internal_has_mmc3() const;
+  public:
+  void clear_mmc3();
+  const ::Rnes::MmcState_Mmc3State& mmc3() const;
+  PROTOBUF_NODISCARD ::Rnes::MmcState_Mmc3State* release_mmc3();
+  ::Rnes::MmcState_Mmc3State* mutable_mmc3();
+  void set_allocated_mmc3(::Rnes::MmcState_Mmc3State* mmc3);
+  private:
+  const ::Rnes::MmcState_Mmc3State& _internal_mmc3() const;
+  ::Rnes::MmcState_Mmc3State* _internal_mutable_mmc3();
+  public:
+  void unsafe_arena_set_allocated_mmc3(
+      ::Rnes::MmcState_Mmc3State* mmc3);
+  ::Rnes::MmcState_Mmc3State* unsafe_arena_release_mmc3();
+
+  // @@protoc_insertion_point(class_scope:Rnes.MmcState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Rnes::MmcState_MmcNoneState* mmcnone_;
+    ::Rnes::MmcState_Mmc1State* mmc1_;
+    ::Rnes::MmcState_Mmc3State* mmc3_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ControllerState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.ControllerState) */ {
+ public:
+  inline ControllerState() : ControllerState(nullptr) {}
+  ~ControllerState() override;
+  explicit PROTOBUF_CONSTEXPR ControllerState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ControllerState(const ControllerState& from);
+  ControllerState(ControllerState&& from) noexcept
+    : ControllerState() {
+    *this = ::std::move(from);
+  }
+
+  inline ControllerState& operator=(const ControllerState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ControllerState& operator=(ControllerState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ControllerState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControllerState* internal_default_instance() {
+    return reinterpret_cast<const ControllerState*>(
+               &_ControllerState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ControllerState& a, ControllerState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ControllerState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControllerState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ControllerState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControllerState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ControllerState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ControllerState& from) {
+    ControllerState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ControllerState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.ControllerState";
+  }
+  protected:
+  explicit ControllerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kControlFieldNumber = 1,
+    kShiftRegFieldNumber = 2,
+  };
+  // optional uint32 control = 1;
+  bool has_control() const;
+  private:
+  bool _internal_has_control() const;
+  public:
+  void clear_control();
+  uint32_t control() const;
+  void set_control(uint32_t value);
+  private:
+  uint32_t _internal_control() const;
+  void _internal_set_control(uint32_t value);
+  public:
+
+  // optional uint32 shiftReg = 2;
+  bool has_shiftreg() const;
+  private:
+  bool _internal_has_shiftreg() const;
+  public:
+  void clear_shiftreg();
+  uint32_t shiftreg() const;
+  void set_shiftreg(uint32_t value);
+  private:
+  uint32_t _internal_shiftreg() const;
+  void _internal_set_shiftreg(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.ControllerState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t control_;
+    uint32_t shiftreg_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CpuMemoryState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.CpuMemoryState) */ {
+ public:
+  inline CpuMemoryState() : CpuMemoryState(nullptr) {}
+  ~CpuMemoryState() override;
+  explicit PROTOBUF_CONSTEXPR CpuMemoryState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CpuMemoryState(const CpuMemoryState& from);
+  CpuMemoryState(CpuMemoryState&& from) noexcept
+    : CpuMemoryState() {
+    *this = ::std::move(from);
+  }
+
+  inline CpuMemoryState& operator=(const CpuMemoryState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CpuMemoryState& operator=(CpuMemoryState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CpuMemoryState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CpuMemoryState* internal_default_instance() {
+    return reinterpret_cast<const CpuMemoryState*>(
+               &_CpuMemoryState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(CpuMemoryState& a, CpuMemoryState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CpuMemoryState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CpuMemoryState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CpuMemoryState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CpuMemoryState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CpuMemoryState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CpuMemoryState& from) {
+    CpuMemoryState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CpuMemoryState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.CpuMemoryState";
+  }
+  protected:
+  explicit CpuMemoryState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCpuSramFieldNumber = 1,
+    kPrgSramFieldNumber = 2,
+  };
+  // optional bytes cpuSram = 1;
+  bool has_cpusram() const;
+  private:
+  bool _internal_has_cpusram() const;
+  public:
+  void clear_cpusram();
+  const std::string& cpusram() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cpusram(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cpusram();
+  PROTOBUF_NODISCARD std::string* release_cpusram();
+  void set_allocated_cpusram(std::string* cpusram);
+  private:
+  const std::string& _internal_cpusram() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cpusram(const std::string& value);
+  std::string* _internal_mutable_cpusram();
+  public:
+
+  // optional bytes prgSram = 2;
+  bool has_prgsram() const;
+  private:
+  bool _internal_has_prgsram() const;
+  public:
+  void clear_prgsram();
+  const std::string& prgsram() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prgsram(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prgsram();
+  PROTOBUF_NODISCARD std::string* release_prgsram();
+  void set_allocated_prgsram(std::string* prgsram);
+  private:
+  const std::string& _internal_prgsram() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prgsram(const std::string& value);
+  std::string* _internal_mutable_prgsram();
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.CpuMemoryState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cpusram_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prgsram_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VideoMemoryState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.VideoMemoryState) */ {
+ public:
+  inline VideoMemoryState() : VideoMemoryState(nullptr) {}
+  ~VideoMemoryState() override;
+  explicit PROTOBUF_CONSTEXPR VideoMemoryState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VideoMemoryState(const VideoMemoryState& from);
+  VideoMemoryState(VideoMemoryState&& from) noexcept
+    : VideoMemoryState() {
+    *this = ::std::move(from);
+  }
+
+  inline VideoMemoryState& operator=(const VideoMemoryState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VideoMemoryState& operator=(VideoMemoryState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VideoMemoryState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VideoMemoryState* internal_default_instance() {
+    return reinterpret_cast<const VideoMemoryState*>(
+               &_VideoMemoryState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(VideoMemoryState& a, VideoMemoryState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VideoMemoryState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VideoMemoryState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VideoMemoryState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VideoMemoryState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VideoMemoryState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VideoMemoryState& from) {
+    VideoMemoryState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VideoMemoryState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.VideoMemoryState";
+  }
+  protected:
+  explicit VideoMemoryState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPatternTableMemoryFieldNumber = 1,
+    kNameTableMemoryFieldNumber = 2,
+    kPaletteMemoryFieldNumber = 3,
+  };
+  // optional bytes patternTableMemory = 1;
+  bool has_patterntablememory() const;
+  private:
+  bool _internal_has_patterntablememory() const;
+  public:
+  void clear_patterntablememory();
+  const std::string& patterntablememory() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_patterntablememory(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_patterntablememory();
+  PROTOBUF_NODISCARD std::string* release_patterntablememory();
+  void set_allocated_patterntablememory(std::string* patterntablememory);
+  private:
+  const std::string& _internal_patterntablememory() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_patterntablememory(const std::string& value);
+  std::string* _internal_mutable_patterntablememory();
+  public:
+
+  // optional bytes nameTableMemory = 2;
+  bool has_nametablememory() const;
+  private:
+  bool _internal_has_nametablememory() const;
+  public:
+  void clear_nametablememory();
+  const std::string& nametablememory() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nametablememory(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nametablememory();
+  PROTOBUF_NODISCARD std::string* release_nametablememory();
+  void set_allocated_nametablememory(std::string* nametablememory);
+  private:
+  const std::string& _internal_nametablememory() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nametablememory(const std::string& value);
+  std::string* _internal_mutable_nametablememory();
+  public:
+
+  // optional bytes paletteMemory = 3;
+  bool has_palettememory() const;
+  private:
+  bool _internal_has_palettememory() const;
+  public:
+  void clear_palettememory();
+  const std::string& palettememory() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_palettememory(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_palettememory();
+  PROTOBUF_NODISCARD std::string* release_palettememory();
+  void set_allocated_palettememory(std::string* palettememory);
+  private:
+  const std::string& _internal_palettememory() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_palettememory(const std::string& value);
+  std::string* _internal_mutable_palettememory();
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.VideoMemoryState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr patterntablememory_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nametablememory_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr palettememory_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DmaState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.DmaState) */ {
+ public:
+  inline DmaState() : DmaState(nullptr) {}
+  ~DmaState() override;
+  explicit PROTOBUF_CONSTEXPR DmaState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DmaState(const DmaState& from);
+  DmaState(DmaState&& from) noexcept
+    : DmaState() {
+    *this = ::std::move(from);
+  }
+
+  inline DmaState& operator=(const DmaState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DmaState& operator=(DmaState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DmaState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DmaState* internal_default_instance() {
+    return reinterpret_cast<const DmaState*>(
+               &_DmaState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(DmaState& a, DmaState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DmaState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DmaState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DmaState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DmaState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DmaState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DmaState& from) {
+    DmaState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DmaState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.DmaState";
+  }
+  protected:
+  explicit DmaState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSpriteDmaModeFieldNumber = 1,
+    kSpriteDmaCycleFieldNumber = 2,
+    kSpriteDmaSourceAddrFieldNumber = 3,
+  };
+  // optional bool spriteDmaMode = 1;
+  bool has_spritedmamode() const;
+  private:
+  bool _internal_has_spritedmamode() const;
+  public:
+  void clear_spritedmamode();
+  bool spritedmamode() const;
+  void set_spritedmamode(bool value);
+  private:
+  bool _internal_spritedmamode() const;
+  void _internal_set_spritedmamode(bool value);
+  public:
+
+  // optional uint32 spriteDmaCycle = 2;
+  bool has_spritedmacycle() const;
+  private:
+  bool _internal_has_spritedmacycle() const;
+  public:
+  void clear_spritedmacycle();
+  uint32_t spritedmacycle() const;
+  void set_spritedmacycle(uint32_t value);
+  private:
+  uint32_t _internal_spritedmacycle() const;
+  void _internal_set_spritedmacycle(uint32_t value);
+  public:
+
+  // optional uint32 spriteDmaSourceAddr = 3;
+  bool has_spritedmasourceaddr() const;
+  private:
+  bool _internal_has_spritedmasourceaddr() const;
+  public:
+  void clear_spritedmasourceaddr();
+  uint32_t spritedmasourceaddr() const;
+  void set_spritedmasourceaddr(uint32_t value);
+  private:
+  uint32_t _internal_spritedmasourceaddr() const;
+  void _internal_set_spritedmasourceaddr(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.DmaState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool spritedmamode_;
+    uint32_t spritedmacycle_;
+    uint32_t spritedmasourceaddr_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SaveState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Rnes.SaveState) */ {
+ public:
+  inline SaveState() : SaveState(nullptr) {}
+  ~SaveState() override;
+  explicit PROTOBUF_CONSTEXPR SaveState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SaveState(const SaveState& from);
+  SaveState(SaveState&& from) noexcept
+    : SaveState() {
+    *this = ::std::move(from);
+  }
+
+  inline SaveState& operator=(const SaveState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SaveState& operator=(SaveState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SaveState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SaveState* internal_default_instance() {
+    return reinterpret_cast<const SaveState*>(
+               &_SaveState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(SaveState& a, SaveState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SaveState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SaveState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SaveState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SaveState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SaveState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SaveState& from) {
+    SaveState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SaveState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Rnes.SaveState";
+  }
+  protected:
+  explicit SaveState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSaveDateFieldNumber = 1,
+    kDmaFieldNumber = 7,
+    kCpuFieldNumber = 8,
+    kApuFieldNumber = 9,
+    kPpuFieldNumber = 10,
+    kControllerFieldNumber = 11,
+    kCpuMemFieldNumber = 12,
+    kVidMemFieldNumber = 13,
+    kGameTimeFieldNumber = 2,
+  };
+  // optional string saveDate = 1;
+  bool has_savedate() const;
+  private:
+  bool _internal_has_savedate() const;
+  public:
+  void clear_savedate();
+  const std::string& savedate() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_savedate(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_savedate();
+  PROTOBUF_NODISCARD std::string* release_savedate();
+  void set_allocated_savedate(std::string* savedate);
+  private:
+  const std::string& _internal_savedate() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_savedate(const std::string& value);
+  std::string* _internal_mutable_savedate();
+  public:
+
+  // optional .Rnes.DmaState dma = 7;
+  bool has_dma() const;
+  private:
+  bool _internal_has_dma() const;
+  public:
+  void clear_dma();
+  const ::Rnes::DmaState& dma() const;
+  PROTOBUF_NODISCARD ::Rnes::DmaState* release_dma();
+  ::Rnes::DmaState* mutable_dma();
+  void set_allocated_dma(::Rnes::DmaState* dma);
+  private:
+  const ::Rnes::DmaState& _internal_dma() const;
+  ::Rnes::DmaState* _internal_mutable_dma();
+  public:
+  void unsafe_arena_set_allocated_dma(
+      ::Rnes::DmaState* dma);
+  ::Rnes::DmaState* unsafe_arena_release_dma();
+
+  // optional .Rnes.CpuState cpu = 8;
+  bool has_cpu() const;
+  private:
+  bool _internal_has_cpu() const;
+  public:
+  void clear_cpu();
+  const ::Rnes::CpuState& cpu() const;
+  PROTOBUF_NODISCARD ::Rnes::CpuState* release_cpu();
+  ::Rnes::CpuState* mutable_cpu();
+  void set_allocated_cpu(::Rnes::CpuState* cpu);
+  private:
+  const ::Rnes::CpuState& _internal_cpu() const;
+  ::Rnes::CpuState* _internal_mutable_cpu();
+  public:
+  void unsafe_arena_set_allocated_cpu(
+      ::Rnes::CpuState* cpu);
+  ::Rnes::CpuState* unsafe_arena_release_cpu();
+
+  // optional .Rnes.ApuState apu = 9;
+  bool has_apu() const;
+  private:
+  bool _internal_has_apu() const;
+  public:
+  void clear_apu();
+  const ::Rnes::ApuState& apu() const;
+  PROTOBUF_NODISCARD ::Rnes::ApuState* release_apu();
+  ::Rnes::ApuState* mutable_apu();
+  void set_allocated_apu(::Rnes::ApuState* apu);
+  private:
+  const ::Rnes::ApuState& _internal_apu() const;
+  ::Rnes::ApuState* _internal_mutable_apu();
+  public:
+  void unsafe_arena_set_allocated_apu(
+      ::Rnes::ApuState* apu);
+  ::Rnes::ApuState* unsafe_arena_release_apu();
+
+  // optional .Rnes.PpuState ppu = 10;
+  bool has_ppu() const;
+  private:
+  bool _internal_has_ppu() const;
+  public:
+  void clear_ppu();
+  const ::Rnes::PpuState& ppu() const;
+  PROTOBUF_NODISCARD ::Rnes::PpuState* release_ppu();
+  ::Rnes::PpuState* mutable_ppu();
+  void set_allocated_ppu(::Rnes::PpuState* ppu);
+  private:
+  const ::Rnes::PpuState& _internal_ppu() const;
+  ::Rnes::PpuState* _internal_mutable_ppu();
+  public:
+  void unsafe_arena_set_allocated_ppu(
+      ::Rnes::PpuState* ppu);
+  ::Rnes::PpuState* unsafe_arena_release_ppu();
+
+  // optional .Rnes.ControllerState controller = 11;
+  bool has_controller() const;
+  private:
+  bool _internal_has_controller() const;
+  public:
+  void clear_controller();
+  const ::Rnes::ControllerState& controller() const;
+  PROTOBUF_NODISCARD ::Rnes::ControllerState* release_controller();
+  ::Rnes::ControllerState* mutable_controller();
+  void set_allocated_controller(::Rnes::ControllerState* controller);
+  private:
+  const ::Rnes::ControllerState& _internal_controller() const;
+  ::Rnes::ControllerState* _internal_mutable_controller();
+  public:
+  void unsafe_arena_set_allocated_controller(
+      ::Rnes::ControllerState* controller);
+  ::Rnes::ControllerState* unsafe_arena_release_controller();
+
+  // optional .Rnes.CpuMemoryState cpuMem = 12;
+  bool has_cpumem() const;
+  private:
+  bool _internal_has_cpumem() const;
+  public:
+  void clear_cpumem();
+  const ::Rnes::CpuMemoryState& cpumem() const;
+  PROTOBUF_NODISCARD ::Rnes::CpuMemoryState* release_cpumem();
+  ::Rnes::CpuMemoryState* mutable_cpumem();
+  void set_allocated_cpumem(::Rnes::CpuMemoryState* cpumem);
+  private:
+  const ::Rnes::CpuMemoryState& _internal_cpumem() const;
+  ::Rnes::CpuMemoryState* _internal_mutable_cpumem();
+  public:
+  void unsafe_arena_set_allocated_cpumem(
+      ::Rnes::CpuMemoryState* cpumem);
+  ::Rnes::CpuMemoryState* unsafe_arena_release_cpumem();
+
+  // optional .Rnes.VideoMemoryState vidMem = 13;
+  bool has_vidmem() const;
+  private:
+  bool _internal_has_vidmem() const;
+  public:
+  void clear_vidmem();
+  const ::Rnes::VideoMemoryState& vidmem() const;
+  PROTOBUF_NODISCARD ::Rnes::VideoMemoryState* release_vidmem();
+  ::Rnes::VideoMemoryState* mutable_vidmem();
+  void set_allocated_vidmem(::Rnes::VideoMemoryState* vidmem);
+  private:
+  const ::Rnes::VideoMemoryState& _internal_vidmem() const;
+  ::Rnes::VideoMemoryState* _internal_mutable_vidmem();
+  public:
+  void unsafe_arena_set_allocated_vidmem(
+      ::Rnes::VideoMemoryState* vidmem);
+  ::Rnes::VideoMemoryState* unsafe_arena_release_vidmem();
+
+  // optional uint64 gameTime = 2;
+  bool has_gametime() const;
+  private:
+  bool _internal_has_gametime() const;
+  public:
+  void clear_gametime();
+  uint64_t gametime() const;
+  void set_gametime(uint64_t value);
+  private:
+  uint64_t _internal_gametime() const;
+  void _internal_set_gametime(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Rnes.SaveState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr savedate_;
+    ::Rnes::DmaState* dma_;
+    ::Rnes::CpuState* cpu_;
+    ::Rnes::ApuState* apu_;
+    ::Rnes::PpuState* ppu_;
+    ::Rnes::ControllerState* controller_;
+    ::Rnes::CpuMemoryState* cpumem_;
+    ::Rnes::VideoMemoryState* vidmem_;
+    uint64_t gametime_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_save_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CpuState
+
+// optional uint32 a = 1;
+inline bool CpuState::_internal_has_a() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CpuState::has_a() const {
+  return _internal_has_a();
+}
+inline void CpuState::clear_a() {
+  _impl_.a_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t CpuState::_internal_a() const {
+  return _impl_.a_;
+}
+inline uint32_t CpuState::a() const {
+  // @@protoc_insertion_point(field_get:Rnes.CpuState.a)
+  return _internal_a();
+}
+inline void CpuState::_internal_set_a(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.a_ = value;
+}
+inline void CpuState::set_a(uint32_t value) {
+  _internal_set_a(value);
+  // @@protoc_insertion_point(field_set:Rnes.CpuState.a)
+}
+
+// optional uint32 x = 2;
+inline bool CpuState::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CpuState::has_x() const {
+  return _internal_has_x();
+}
+inline void CpuState::clear_x() {
+  _impl_.x_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CpuState::_internal_x() const {
+  return _impl_.x_;
+}
+inline uint32_t CpuState::x() const {
+  // @@protoc_insertion_point(field_get:Rnes.CpuState.x)
+  return _internal_x();
+}
+inline void CpuState::_internal_set_x(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.x_ = value;
+}
+inline void CpuState::set_x(uint32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:Rnes.CpuState.x)
+}
+
+// optional uint32 y = 3;
+inline bool CpuState::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CpuState::has_y() const {
+  return _internal_has_y();
+}
+inline void CpuState::clear_y() {
+  _impl_.y_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CpuState::_internal_y() const {
+  return _impl_.y_;
+}
+inline uint32_t CpuState::y() const {
+  // @@protoc_insertion_point(field_get:Rnes.CpuState.y)
+  return _internal_y();
+}
+inline void CpuState::_internal_set_y(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.y_ = value;
+}
+inline void CpuState::set_y(uint32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:Rnes.CpuState.y)
+}
+
+// optional uint32 pc = 4;
+inline bool CpuState::_internal_has_pc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CpuState::has_pc() const {
+  return _internal_has_pc();
+}
+inline void CpuState::clear_pc() {
+  _impl_.pc_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t CpuState::_internal_pc() const {
+  return _impl_.pc_;
+}
+inline uint32_t CpuState::pc() const {
+  // @@protoc_insertion_point(field_get:Rnes.CpuState.pc)
+  return _internal_pc();
+}
+inline void CpuState::_internal_set_pc(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.pc_ = value;
+}
+inline void CpuState::set_pc(uint32_t value) {
+  _internal_set_pc(value);
+  // @@protoc_insertion_point(field_set:Rnes.CpuState.pc)
+}
+
+// optional uint32 sp = 5;
+inline bool CpuState::_internal_has_sp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CpuState::has_sp() const {
+  return _internal_has_sp();
+}
+inline void CpuState::clear_sp() {
+  _impl_.sp_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t CpuState::_internal_sp() const {
+  return _impl_.sp_;
+}
+inline uint32_t CpuState::sp() const {
+  // @@protoc_insertion_point(field_get:Rnes.CpuState.sp)
+  return _internal_sp();
+}
+inline void CpuState::_internal_set_sp(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.sp_ = value;
+}
+inline void CpuState::set_sp(uint32_t value) {
+  _internal_set_sp(value);
+  // @@protoc_insertion_point(field_set:Rnes.CpuState.sp)
+}
+
+// optional uint32 status = 6;
+inline bool CpuState::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool CpuState::has_status() const {
+  return _internal_has_status();
+}
+inline void CpuState::clear_status() {
+  _impl_.status_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t CpuState::_internal_status() const {
+  return _impl_.status_;
+}
+inline uint32_t CpuState::status() const {
+  // @@protoc_insertion_point(field_get:Rnes.CpuState.status)
+  return _internal_status();
+}
+inline void CpuState::_internal_set_status(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.status_ = value;
+}
+inline void CpuState::set_status(uint32_t value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:Rnes.CpuState.status)
+}
+
+// optional uint64 cycle = 7;
+inline bool CpuState::_internal_has_cycle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool CpuState::has_cycle() const {
+  return _internal_has_cycle();
+}
+inline void CpuState::clear_cycle() {
+  _impl_.cycle_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t CpuState::_internal_cycle() const {
+  return _impl_.cycle_;
+}
+inline uint64_t CpuState::cycle() const {
+  // @@protoc_insertion_point(field_get:Rnes.CpuState.cycle)
+  return _internal_cycle();
+}
+inline void CpuState::_internal_set_cycle(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.cycle_ = value;
+}
+inline void CpuState::set_cycle(uint64_t value) {
+  _internal_set_cycle(value);
+  // @@protoc_insertion_point(field_set:Rnes.CpuState.cycle)
+}
+
+// -------------------------------------------------------------------
+
+// PulseState
+
+// optional bool primary = 1;
+inline bool PulseState::_internal_has_primary() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PulseState::has_primary() const {
+  return _internal_has_primary();
+}
+inline void PulseState::clear_primary() {
+  _impl_.primary_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool PulseState::_internal_primary() const {
+  return _impl_.primary_;
+}
+inline bool PulseState::primary() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.primary)
+  return _internal_primary();
+}
+inline void PulseState::_internal_set_primary(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.primary_ = value;
+}
+inline void PulseState::set_primary(bool value) {
+  _internal_set_primary(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.primary)
+}
+
+// optional uint32 lengthCounter = 2;
+inline bool PulseState::_internal_has_lengthcounter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PulseState::has_lengthcounter() const {
+  return _internal_has_lengthcounter();
+}
+inline void PulseState::clear_lengthcounter() {
+  _impl_.lengthcounter_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t PulseState::_internal_lengthcounter() const {
+  return _impl_.lengthcounter_;
+}
+inline uint32_t PulseState::lengthcounter() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.lengthCounter)
+  return _internal_lengthcounter();
+}
+inline void PulseState::_internal_set_lengthcounter(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.lengthcounter_ = value;
+}
+inline void PulseState::set_lengthcounter(uint32_t value) {
+  _internal_set_lengthcounter(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.lengthCounter)
+}
+
+// optional uint32 envelope = 3;
+inline bool PulseState::_internal_has_envelope() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PulseState::has_envelope() const {
+  return _internal_has_envelope();
+}
+inline void PulseState::clear_envelope() {
+  _impl_.envelope_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PulseState::_internal_envelope() const {
+  return _impl_.envelope_;
+}
+inline uint32_t PulseState::envelope() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.envelope)
+  return _internal_envelope();
+}
+inline void PulseState::_internal_set_envelope(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.envelope_ = value;
+}
+inline void PulseState::set_envelope(uint32_t value) {
+  _internal_set_envelope(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.envelope)
+}
+
+// optional uint32 envelopeDivider = 4;
+inline bool PulseState::_internal_has_envelopedivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PulseState::has_envelopedivider() const {
+  return _internal_has_envelopedivider();
+}
+inline void PulseState::clear_envelopedivider() {
+  _impl_.envelopedivider_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t PulseState::_internal_envelopedivider() const {
+  return _impl_.envelopedivider_;
+}
+inline uint32_t PulseState::envelopedivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.envelopeDivider)
+  return _internal_envelopedivider();
+}
+inline void PulseState::_internal_set_envelopedivider(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.envelopedivider_ = value;
+}
+inline void PulseState::set_envelopedivider(uint32_t value) {
+  _internal_set_envelopedivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.envelopeDivider)
+}
+
+// optional bool resetEnvelopeAndDivider = 5;
+inline bool PulseState::_internal_has_resetenvelopeanddivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PulseState::has_resetenvelopeanddivider() const {
+  return _internal_has_resetenvelopeanddivider();
+}
+inline void PulseState::clear_resetenvelopeanddivider() {
+  _impl_.resetenvelopeanddivider_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool PulseState::_internal_resetenvelopeanddivider() const {
+  return _impl_.resetenvelopeanddivider_;
+}
+inline bool PulseState::resetenvelopeanddivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.resetEnvelopeAndDivider)
+  return _internal_resetenvelopeanddivider();
+}
+inline void PulseState::_internal_set_resetenvelopeanddivider(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.resetenvelopeanddivider_ = value;
+}
+inline void PulseState::set_resetenvelopeanddivider(bool value) {
+  _internal_set_resetenvelopeanddivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.resetEnvelopeAndDivider)
+}
+
+// optional bool resetSweepDivider = 6;
+inline bool PulseState::_internal_has_resetsweepdivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool PulseState::has_resetsweepdivider() const {
+  return _internal_has_resetsweepdivider();
+}
+inline void PulseState::clear_resetsweepdivider() {
+  _impl_.resetsweepdivider_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool PulseState::_internal_resetsweepdivider() const {
+  return _impl_.resetsweepdivider_;
+}
+inline bool PulseState::resetsweepdivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.resetSweepDivider)
+  return _internal_resetsweepdivider();
+}
+inline void PulseState::_internal_set_resetsweepdivider(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.resetsweepdivider_ = value;
+}
+inline void PulseState::set_resetsweepdivider(bool value) {
+  _internal_set_resetsweepdivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.resetSweepDivider)
+}
+
+// optional uint32 sweepDivider = 7;
+inline bool PulseState::_internal_has_sweepdivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool PulseState::has_sweepdivider() const {
+  return _internal_has_sweepdivider();
+}
+inline void PulseState::clear_sweepdivider() {
+  _impl_.sweepdivider_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t PulseState::_internal_sweepdivider() const {
+  return _impl_.sweepdivider_;
+}
+inline uint32_t PulseState::sweepdivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.sweepDivider)
+  return _internal_sweepdivider();
+}
+inline void PulseState::_internal_set_sweepdivider(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.sweepdivider_ = value;
+}
+inline void PulseState::set_sweepdivider(uint32_t value) {
+  _internal_set_sweepdivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.sweepDivider)
+}
+
+// optional uint32 currentSample = 8;
+inline bool PulseState::_internal_has_currentsample() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool PulseState::has_currentsample() const {
+  return _internal_has_currentsample();
+}
+inline void PulseState::clear_currentsample() {
+  _impl_.currentsample_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t PulseState::_internal_currentsample() const {
+  return _impl_.currentsample_;
+}
+inline uint32_t PulseState::currentsample() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.currentSample)
+  return _internal_currentsample();
+}
+inline void PulseState::_internal_set_currentsample(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.currentsample_ = value;
+}
+inline void PulseState::set_currentsample(uint32_t value) {
+  _internal_set_currentsample(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.currentSample)
+}
+
+// optional uint32 timerDivider = 9;
+inline bool PulseState::_internal_has_timerdivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool PulseState::has_timerdivider() const {
+  return _internal_has_timerdivider();
+}
+inline void PulseState::clear_timerdivider() {
+  _impl_.timerdivider_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t PulseState::_internal_timerdivider() const {
+  return _impl_.timerdivider_;
+}
+inline uint32_t PulseState::timerdivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.timerDivider)
+  return _internal_timerdivider();
+}
+inline void PulseState::_internal_set_timerdivider(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.timerdivider_ = value;
+}
+inline void PulseState::set_timerdivider(uint32_t value) {
+  _internal_set_timerdivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.timerDivider)
+}
+
+// optional uint32 sequencerOffset = 10;
+inline bool PulseState::_internal_has_sequenceroffset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool PulseState::has_sequenceroffset() const {
+  return _internal_has_sequenceroffset();
+}
+inline void PulseState::clear_sequenceroffset() {
+  _impl_.sequenceroffset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t PulseState::_internal_sequenceroffset() const {
+  return _impl_.sequenceroffset_;
+}
+inline uint32_t PulseState::sequenceroffset() const {
+  // @@protoc_insertion_point(field_get:Rnes.PulseState.sequencerOffset)
+  return _internal_sequenceroffset();
+}
+inline void PulseState::_internal_set_sequenceroffset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.sequenceroffset_ = value;
+}
+inline void PulseState::set_sequenceroffset(uint32_t value) {
+  _internal_set_sequenceroffset(value);
+  // @@protoc_insertion_point(field_set:Rnes.PulseState.sequencerOffset)
+}
+
+// -------------------------------------------------------------------
+
+// TriangleState
+
+// optional uint32 lengthCounter = 1;
+inline bool TriangleState::_internal_has_lengthcounter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TriangleState::has_lengthcounter() const {
+  return _internal_has_lengthcounter();
+}
+inline void TriangleState::clear_lengthcounter() {
+  _impl_.lengthcounter_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t TriangleState::_internal_lengthcounter() const {
+  return _impl_.lengthcounter_;
+}
+inline uint32_t TriangleState::lengthcounter() const {
+  // @@protoc_insertion_point(field_get:Rnes.TriangleState.lengthCounter)
+  return _internal_lengthcounter();
+}
+inline void TriangleState::_internal_set_lengthcounter(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.lengthcounter_ = value;
+}
+inline void TriangleState::set_lengthcounter(uint32_t value) {
+  _internal_set_lengthcounter(value);
+  // @@protoc_insertion_point(field_set:Rnes.TriangleState.lengthCounter)
+}
+
+// optional bool linearCounterHalt = 2;
+inline bool TriangleState::_internal_has_linearcounterhalt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TriangleState::has_linearcounterhalt() const {
+  return _internal_has_linearcounterhalt();
+}
+inline void TriangleState::clear_linearcounterhalt() {
+  _impl_.linearcounterhalt_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool TriangleState::_internal_linearcounterhalt() const {
+  return _impl_.linearcounterhalt_;
+}
+inline bool TriangleState::linearcounterhalt() const {
+  // @@protoc_insertion_point(field_get:Rnes.TriangleState.linearCounterHalt)
+  return _internal_linearcounterhalt();
+}
+inline void TriangleState::_internal_set_linearcounterhalt(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.linearcounterhalt_ = value;
+}
+inline void TriangleState::set_linearcounterhalt(bool value) {
+  _internal_set_linearcounterhalt(value);
+  // @@protoc_insertion_point(field_set:Rnes.TriangleState.linearCounterHalt)
+}
+
+// optional uint32 linearCounter = 3;
+inline bool TriangleState::_internal_has_linearcounter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TriangleState::has_linearcounter() const {
+  return _internal_has_linearcounter();
+}
+inline void TriangleState::clear_linearcounter() {
+  _impl_.linearcounter_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t TriangleState::_internal_linearcounter() const {
+  return _impl_.linearcounter_;
+}
+inline uint32_t TriangleState::linearcounter() const {
+  // @@protoc_insertion_point(field_get:Rnes.TriangleState.linearCounter)
+  return _internal_linearcounter();
+}
+inline void TriangleState::_internal_set_linearcounter(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.linearcounter_ = value;
+}
+inline void TriangleState::set_linearcounter(uint32_t value) {
+  _internal_set_linearcounter(value);
+  // @@protoc_insertion_point(field_set:Rnes.TriangleState.linearCounter)
+}
+
+// optional uint32 currentSample = 4;
+inline bool TriangleState::_internal_has_currentsample() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TriangleState::has_currentsample() const {
+  return _internal_has_currentsample();
+}
+inline void TriangleState::clear_currentsample() {
+  _impl_.currentsample_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t TriangleState::_internal_currentsample() const {
+  return _impl_.currentsample_;
+}
+inline uint32_t TriangleState::currentsample() const {
+  // @@protoc_insertion_point(field_get:Rnes.TriangleState.currentSample)
+  return _internal_currentsample();
+}
+inline void TriangleState::_internal_set_currentsample(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.currentsample_ = value;
+}
+inline void TriangleState::set_currentsample(uint32_t value) {
+  _internal_set_currentsample(value);
+  // @@protoc_insertion_point(field_set:Rnes.TriangleState.currentSample)
+}
+
+// optional uint32 timerDivider = 5;
+inline bool TriangleState::_internal_has_timerdivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool TriangleState::has_timerdivider() const {
+  return _internal_has_timerdivider();
+}
+inline void TriangleState::clear_timerdivider() {
+  _impl_.timerdivider_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t TriangleState::_internal_timerdivider() const {
+  return _impl_.timerdivider_;
+}
+inline uint32_t TriangleState::timerdivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.TriangleState.timerDivider)
+  return _internal_timerdivider();
+}
+inline void TriangleState::_internal_set_timerdivider(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.timerdivider_ = value;
+}
+inline void TriangleState::set_timerdivider(uint32_t value) {
+  _internal_set_timerdivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.TriangleState.timerDivider)
+}
+
+// optional uint32 sequencerOffset = 6;
+inline bool TriangleState::_internal_has_sequenceroffset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool TriangleState::has_sequenceroffset() const {
+  return _internal_has_sequenceroffset();
+}
+inline void TriangleState::clear_sequenceroffset() {
+  _impl_.sequenceroffset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t TriangleState::_internal_sequenceroffset() const {
+  return _impl_.sequenceroffset_;
+}
+inline uint32_t TriangleState::sequenceroffset() const {
+  // @@protoc_insertion_point(field_get:Rnes.TriangleState.sequencerOffset)
+  return _internal_sequenceroffset();
+}
+inline void TriangleState::_internal_set_sequenceroffset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.sequenceroffset_ = value;
+}
+inline void TriangleState::set_sequenceroffset(uint32_t value) {
+  _internal_set_sequenceroffset(value);
+  // @@protoc_insertion_point(field_set:Rnes.TriangleState.sequencerOffset)
+}
+
+// -------------------------------------------------------------------
+
+// NoiseState
+
+// optional uint32 lengthCounter = 1;
+inline bool NoiseState::_internal_has_lengthcounter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool NoiseState::has_lengthcounter() const {
+  return _internal_has_lengthcounter();
+}
+inline void NoiseState::clear_lengthcounter() {
+  _impl_.lengthcounter_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t NoiseState::_internal_lengthcounter() const {
+  return _impl_.lengthcounter_;
+}
+inline uint32_t NoiseState::lengthcounter() const {
+  // @@protoc_insertion_point(field_get:Rnes.NoiseState.lengthCounter)
+  return _internal_lengthcounter();
+}
+inline void NoiseState::_internal_set_lengthcounter(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.lengthcounter_ = value;
+}
+inline void NoiseState::set_lengthcounter(uint32_t value) {
+  _internal_set_lengthcounter(value);
+  // @@protoc_insertion_point(field_set:Rnes.NoiseState.lengthCounter)
+}
+
+// optional uint32 shiftRegister = 2;
+inline bool NoiseState::_internal_has_shiftregister() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool NoiseState::has_shiftregister() const {
+  return _internal_has_shiftregister();
+}
+inline void NoiseState::clear_shiftregister() {
+  _impl_.shiftregister_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t NoiseState::_internal_shiftregister() const {
+  return _impl_.shiftregister_;
+}
+inline uint32_t NoiseState::shiftregister() const {
+  // @@protoc_insertion_point(field_get:Rnes.NoiseState.shiftRegister)
+  return _internal_shiftregister();
+}
+inline void NoiseState::_internal_set_shiftregister(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shiftregister_ = value;
+}
+inline void NoiseState::set_shiftregister(uint32_t value) {
+  _internal_set_shiftregister(value);
+  // @@protoc_insertion_point(field_set:Rnes.NoiseState.shiftRegister)
+}
+
+// optional uint32 envelope = 3;
+inline bool NoiseState::_internal_has_envelope() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool NoiseState::has_envelope() const {
+  return _internal_has_envelope();
+}
+inline void NoiseState::clear_envelope() {
+  _impl_.envelope_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t NoiseState::_internal_envelope() const {
+  return _impl_.envelope_;
+}
+inline uint32_t NoiseState::envelope() const {
+  // @@protoc_insertion_point(field_get:Rnes.NoiseState.envelope)
+  return _internal_envelope();
+}
+inline void NoiseState::_internal_set_envelope(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.envelope_ = value;
+}
+inline void NoiseState::set_envelope(uint32_t value) {
+  _internal_set_envelope(value);
+  // @@protoc_insertion_point(field_set:Rnes.NoiseState.envelope)
+}
+
+// optional uint32 envelopeDivider = 4;
+inline bool NoiseState::_internal_has_envelopedivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool NoiseState::has_envelopedivider() const {
+  return _internal_has_envelopedivider();
+}
+inline void NoiseState::clear_envelopedivider() {
+  _impl_.envelopedivider_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t NoiseState::_internal_envelopedivider() const {
+  return _impl_.envelopedivider_;
+}
+inline uint32_t NoiseState::envelopedivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.NoiseState.envelopeDivider)
+  return _internal_envelopedivider();
+}
+inline void NoiseState::_internal_set_envelopedivider(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.envelopedivider_ = value;
+}
+inline void NoiseState::set_envelopedivider(uint32_t value) {
+  _internal_set_envelopedivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.NoiseState.envelopeDivider)
+}
+
+// optional bool resetEnvelopeAndDivider = 5;
+inline bool NoiseState::_internal_has_resetenvelopeanddivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool NoiseState::has_resetenvelopeanddivider() const {
+  return _internal_has_resetenvelopeanddivider();
+}
+inline void NoiseState::clear_resetenvelopeanddivider() {
+  _impl_.resetenvelopeanddivider_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool NoiseState::_internal_resetenvelopeanddivider() const {
+  return _impl_.resetenvelopeanddivider_;
+}
+inline bool NoiseState::resetenvelopeanddivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.NoiseState.resetEnvelopeAndDivider)
+  return _internal_resetenvelopeanddivider();
+}
+inline void NoiseState::_internal_set_resetenvelopeanddivider(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.resetenvelopeanddivider_ = value;
+}
+inline void NoiseState::set_resetenvelopeanddivider(bool value) {
+  _internal_set_resetenvelopeanddivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.NoiseState.resetEnvelopeAndDivider)
+}
+
+// optional uint32 currentSample = 6;
+inline bool NoiseState::_internal_has_currentsample() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool NoiseState::has_currentsample() const {
+  return _internal_has_currentsample();
+}
+inline void NoiseState::clear_currentsample() {
+  _impl_.currentsample_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t NoiseState::_internal_currentsample() const {
+  return _impl_.currentsample_;
+}
+inline uint32_t NoiseState::currentsample() const {
+  // @@protoc_insertion_point(field_get:Rnes.NoiseState.currentSample)
+  return _internal_currentsample();
+}
+inline void NoiseState::_internal_set_currentsample(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.currentsample_ = value;
+}
+inline void NoiseState::set_currentsample(uint32_t value) {
+  _internal_set_currentsample(value);
+  // @@protoc_insertion_point(field_set:Rnes.NoiseState.currentSample)
+}
+
+// optional uint32 timerDivider = 7;
+inline bool NoiseState::_internal_has_timerdivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool NoiseState::has_timerdivider() const {
+  return _internal_has_timerdivider();
+}
+inline void NoiseState::clear_timerdivider() {
+  _impl_.timerdivider_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t NoiseState::_internal_timerdivider() const {
+  return _impl_.timerdivider_;
+}
+inline uint32_t NoiseState::timerdivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.NoiseState.timerDivider)
+  return _internal_timerdivider();
+}
+inline void NoiseState::_internal_set_timerdivider(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.timerdivider_ = value;
+}
+inline void NoiseState::set_timerdivider(uint32_t value) {
+  _internal_set_timerdivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.NoiseState.timerDivider)
+}
+
+// -------------------------------------------------------------------
+
+// DmcState
+
+// optional uint32 outputLevel = 1;
+inline bool DmcState::_internal_has_outputlevel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool DmcState::has_outputlevel() const {
+  return _internal_has_outputlevel();
+}
+inline void DmcState::clear_outputlevel() {
+  _impl_.outputlevel_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t DmcState::_internal_outputlevel() const {
+  return _impl_.outputlevel_;
+}
+inline uint32_t DmcState::outputlevel() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmcState.outputLevel)
+  return _internal_outputlevel();
+}
+inline void DmcState::_internal_set_outputlevel(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.outputlevel_ = value;
+}
+inline void DmcState::set_outputlevel(uint32_t value) {
+  _internal_set_outputlevel(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmcState.outputLevel)
+}
+
+// optional uint32 shiftRegister = 2;
+inline bool DmcState::_internal_has_shiftregister() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool DmcState::has_shiftregister() const {
+  return _internal_has_shiftregister();
+}
+inline void DmcState::clear_shiftregister() {
+  _impl_.shiftregister_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t DmcState::_internal_shiftregister() const {
+  return _impl_.shiftregister_;
+}
+inline uint32_t DmcState::shiftregister() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmcState.shiftRegister)
+  return _internal_shiftregister();
+}
+inline void DmcState::_internal_set_shiftregister(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shiftregister_ = value;
+}
+inline void DmcState::set_shiftregister(uint32_t value) {
+  _internal_set_shiftregister(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmcState.shiftRegister)
+}
+
+// optional uint32 bitsRemaining = 3 [default = 8];
+inline bool DmcState::_internal_has_bitsremaining() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool DmcState::has_bitsremaining() const {
+  return _internal_has_bitsremaining();
+}
+inline void DmcState::clear_bitsremaining() {
+  _impl_.bitsremaining_ = 8u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t DmcState::_internal_bitsremaining() const {
+  return _impl_.bitsremaining_;
+}
+inline uint32_t DmcState::bitsremaining() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmcState.bitsRemaining)
+  return _internal_bitsremaining();
+}
+inline void DmcState::_internal_set_bitsremaining(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.bitsremaining_ = value;
+}
+inline void DmcState::set_bitsremaining(uint32_t value) {
+  _internal_set_bitsremaining(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmcState.bitsRemaining)
+}
+
+// optional bool silence = 4 [default = true];
+inline bool DmcState::_internal_has_silence() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool DmcState::has_silence() const {
+  return _internal_has_silence();
+}
+inline void DmcState::clear_silence() {
+  _impl_.silence_ = true;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool DmcState::_internal_silence() const {
+  return _impl_.silence_;
+}
+inline bool DmcState::silence() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmcState.silence)
+  return _internal_silence();
+}
+inline void DmcState::_internal_set_silence(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.silence_ = value;
+}
+inline void DmcState::set_silence(bool value) {
+  _internal_set_silence(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmcState.silence)
+}
+
+// optional uint32 sampleBuffer = 5;
+inline bool DmcState::_internal_has_samplebuffer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool DmcState::has_samplebuffer() const {
+  return _internal_has_samplebuffer();
+}
+inline void DmcState::clear_samplebuffer() {
+  _impl_.samplebuffer_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t DmcState::_internal_samplebuffer() const {
+  return _impl_.samplebuffer_;
+}
+inline uint32_t DmcState::samplebuffer() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmcState.sampleBuffer)
+  return _internal_samplebuffer();
+}
+inline void DmcState::_internal_set_samplebuffer(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.samplebuffer_ = value;
+}
+inline void DmcState::set_samplebuffer(uint32_t value) {
+  _internal_set_samplebuffer(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmcState.sampleBuffer)
+}
+
+// optional bool sampleBufferFull = 6;
+inline bool DmcState::_internal_has_samplebufferfull() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool DmcState::has_samplebufferfull() const {
+  return _internal_has_samplebufferfull();
+}
+inline void DmcState::clear_samplebufferfull() {
+  _impl_.samplebufferfull_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool DmcState::_internal_samplebufferfull() const {
+  return _impl_.samplebufferfull_;
+}
+inline bool DmcState::samplebufferfull() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmcState.sampleBufferFull)
+  return _internal_samplebufferfull();
+}
+inline void DmcState::_internal_set_samplebufferfull(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.samplebufferfull_ = value;
+}
+inline void DmcState::set_samplebufferfull(bool value) {
+  _internal_set_samplebufferfull(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmcState.sampleBufferFull)
+}
+
+// optional uint32 currentAddr = 7;
+inline bool DmcState::_internal_has_currentaddr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool DmcState::has_currentaddr() const {
+  return _internal_has_currentaddr();
+}
+inline void DmcState::clear_currentaddr() {
+  _impl_.currentaddr_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t DmcState::_internal_currentaddr() const {
+  return _impl_.currentaddr_;
+}
+inline uint32_t DmcState::currentaddr() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmcState.currentAddr)
+  return _internal_currentaddr();
+}
+inline void DmcState::_internal_set_currentaddr(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.currentaddr_ = value;
+}
+inline void DmcState::set_currentaddr(uint32_t value) {
+  _internal_set_currentaddr(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmcState.currentAddr)
+}
+
+// optional uint32 bytesRemaining = 8;
+inline bool DmcState::_internal_has_bytesremaining() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool DmcState::has_bytesremaining() const {
+  return _internal_has_bytesremaining();
+}
+inline void DmcState::clear_bytesremaining() {
+  _impl_.bytesremaining_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t DmcState::_internal_bytesremaining() const {
+  return _impl_.bytesremaining_;
+}
+inline uint32_t DmcState::bytesremaining() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmcState.bytesRemaining)
+  return _internal_bytesremaining();
+}
+inline void DmcState::_internal_set_bytesremaining(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.bytesremaining_ = value;
+}
+inline void DmcState::set_bytesremaining(uint32_t value) {
+  _internal_set_bytesremaining(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmcState.bytesRemaining)
+}
+
+// optional uint32 timerCounter = 9;
+inline bool DmcState::_internal_has_timercounter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool DmcState::has_timercounter() const {
+  return _internal_has_timercounter();
+}
+inline void DmcState::clear_timercounter() {
+  _impl_.timercounter_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t DmcState::_internal_timercounter() const {
+  return _impl_.timercounter_;
+}
+inline uint32_t DmcState::timercounter() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmcState.timerCounter)
+  return _internal_timercounter();
+}
+inline void DmcState::_internal_set_timercounter(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.timercounter_ = value;
+}
+inline void DmcState::set_timercounter(uint32_t value) {
+  _internal_set_timercounter(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmcState.timerCounter)
+}
+
+// -------------------------------------------------------------------
+
+// ApuState
+
+// repeated uint32 reg = 1;
+inline int ApuState::_internal_reg_size() const {
+  return _impl_.reg_.size();
+}
+inline int ApuState::reg_size() const {
+  return _internal_reg_size();
+}
+inline void ApuState::clear_reg() {
+  _impl_.reg_.Clear();
+}
+inline uint32_t ApuState::_internal_reg(int index) const {
+  return _impl_.reg_.Get(index);
+}
+inline uint32_t ApuState::reg(int index) const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.reg)
+  return _internal_reg(index);
+}
+inline void ApuState::set_reg(int index, uint32_t value) {
+  _impl_.reg_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.reg)
+}
+inline void ApuState::_internal_add_reg(uint32_t value) {
+  _impl_.reg_.Add(value);
+}
+inline void ApuState::add_reg(uint32_t value) {
+  _internal_add_reg(value);
+  // @@protoc_insertion_point(field_add:Rnes.ApuState.reg)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ApuState::_internal_reg() const {
+  return _impl_.reg_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ApuState::reg() const {
+  // @@protoc_insertion_point(field_list:Rnes.ApuState.reg)
+  return _internal_reg();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ApuState::_internal_mutable_reg() {
+  return &_impl_.reg_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ApuState::mutable_reg() {
+  // @@protoc_insertion_point(field_mutable_list:Rnes.ApuState.reg)
+  return _internal_mutable_reg();
+}
+
+// optional uint32 sampleRate = 2;
+inline bool ApuState::_internal_has_samplerate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ApuState::has_samplerate() const {
+  return _internal_has_samplerate();
+}
+inline void ApuState::clear_samplerate() {
+  _impl_.samplerate_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t ApuState::_internal_samplerate() const {
+  return _impl_.samplerate_;
+}
+inline uint32_t ApuState::samplerate() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.sampleRate)
+  return _internal_samplerate();
+}
+inline void ApuState::_internal_set_samplerate(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.samplerate_ = value;
+}
+inline void ApuState::set_samplerate(uint32_t value) {
+  _internal_set_samplerate(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.sampleRate)
+}
+
+// optional uint32 fourFrameCount = 3;
+inline bool ApuState::_internal_has_fourframecount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ApuState::has_fourframecount() const {
+  return _internal_has_fourframecount();
+}
+inline void ApuState::clear_fourframecount() {
+  _impl_.fourframecount_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t ApuState::_internal_fourframecount() const {
+  return _impl_.fourframecount_;
+}
+inline uint32_t ApuState::fourframecount() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.fourFrameCount)
+  return _internal_fourframecount();
+}
+inline void ApuState::_internal_set_fourframecount(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.fourframecount_ = value;
+}
+inline void ApuState::set_fourframecount(uint32_t value) {
+  _internal_set_fourframecount(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.fourFrameCount)
+}
+
+// optional uint32 fiveFrameCount = 4;
+inline bool ApuState::_internal_has_fiveframecount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool ApuState::has_fiveframecount() const {
+  return _internal_has_fiveframecount();
+}
+inline void ApuState::clear_fiveframecount() {
+  _impl_.fiveframecount_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t ApuState::_internal_fiveframecount() const {
+  return _impl_.fiveframecount_;
+}
+inline uint32_t ApuState::fiveframecount() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.fiveFrameCount)
+  return _internal_fiveframecount();
+}
+inline void ApuState::_internal_set_fiveframecount(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.fiveframecount_ = value;
+}
+inline void ApuState::set_fiveframecount(uint32_t value) {
+  _internal_set_fiveframecount(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.fiveFrameCount)
+}
+
+// optional uint32 frameDivider = 5;
+inline bool ApuState::_internal_has_framedivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool ApuState::has_framedivider() const {
+  return _internal_has_framedivider();
+}
+inline void ApuState::clear_framedivider() {
+  _impl_.framedivider_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t ApuState::_internal_framedivider() const {
+  return _impl_.framedivider_;
+}
+inline uint32_t ApuState::framedivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.frameDivider)
+  return _internal_framedivider();
+}
+inline void ApuState::_internal_set_framedivider(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.framedivider_ = value;
+}
+inline void ApuState::set_framedivider(uint32_t value) {
+  _internal_set_framedivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.frameDivider)
+}
+
+// optional uint32 step = 6;
+inline bool ApuState::_internal_has_step() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool ApuState::has_step() const {
+  return _internal_has_step();
+}
+inline void ApuState::clear_step() {
+  _impl_.step_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t ApuState::_internal_step() const {
+  return _impl_.step_;
+}
+inline uint32_t ApuState::step() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.step)
+  return _internal_step();
+}
+inline void ApuState::_internal_set_step(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.step_ = value;
+}
+inline void ApuState::set_step(uint32_t value) {
+  _internal_set_step(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.step)
+}
+
+// optional uint32 halfTimerDivider = 7;
+inline bool ApuState::_internal_has_halftimerdivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool ApuState::has_halftimerdivider() const {
+  return _internal_has_halftimerdivider();
+}
+inline void ApuState::clear_halftimerdivider() {
+  _impl_.halftimerdivider_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t ApuState::_internal_halftimerdivider() const {
+  return _impl_.halftimerdivider_;
+}
+inline uint32_t ApuState::halftimerdivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.halfTimerDivider)
+  return _internal_halftimerdivider();
+}
+inline void ApuState::_internal_set_halftimerdivider(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.halftimerdivider_ = value;
+}
+inline void ApuState::set_halftimerdivider(uint32_t value) {
+  _internal_set_halftimerdivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.halfTimerDivider)
+}
+
+// optional uint32 samplerDivider = 8;
+inline bool ApuState::_internal_has_samplerdivider() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool ApuState::has_samplerdivider() const {
+  return _internal_has_samplerdivider();
+}
+inline void ApuState::clear_samplerdivider() {
+  _impl_.samplerdivider_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint32_t ApuState::_internal_samplerdivider() const {
+  return _impl_.samplerdivider_;
+}
+inline uint32_t ApuState::samplerdivider() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.samplerDivider)
+  return _internal_samplerdivider();
+}
+inline void ApuState::_internal_set_samplerdivider(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.samplerdivider_ = value;
+}
+inline void ApuState::set_samplerdivider(uint32_t value) {
+  _internal_set_samplerdivider(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.samplerDivider)
+}
+
+// optional float clksPerSample = 9;
+inline bool ApuState::_internal_has_clkspersample() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool ApuState::has_clkspersample() const {
+  return _internal_has_clkspersample();
+}
+inline void ApuState::clear_clkspersample() {
+  _impl_.clkspersample_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline float ApuState::_internal_clkspersample() const {
+  return _impl_.clkspersample_;
+}
+inline float ApuState::clkspersample() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.clksPerSample)
+  return _internal_clkspersample();
+}
+inline void ApuState::_internal_set_clkspersample(float value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.clkspersample_ = value;
+}
+inline void ApuState::set_clkspersample(float value) {
+  _internal_set_clkspersample(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.clksPerSample)
+}
+
+// optional float currentSampleClk = 10;
+inline bool ApuState::_internal_has_currentsampleclk() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool ApuState::has_currentsampleclk() const {
+  return _internal_has_currentsampleclk();
+}
+inline void ApuState::clear_currentsampleclk() {
+  _impl_.currentsampleclk_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline float ApuState::_internal_currentsampleclk() const {
+  return _impl_.currentsampleclk_;
+}
+inline float ApuState::currentsampleclk() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.currentSampleClk)
+  return _internal_currentsampleclk();
+}
+inline void ApuState::_internal_set_currentsampleclk(float value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.currentsampleclk_ = value;
+}
+inline void ApuState::set_currentsampleclk(float value) {
+  _internal_set_currentsampleclk(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.currentSampleClk)
+}
+
+// optional uint32 nextSampleCountdown = 11;
+inline bool ApuState::_internal_has_nextsamplecountdown() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool ApuState::has_nextsamplecountdown() const {
+  return _internal_has_nextsamplecountdown();
+}
+inline void ApuState::clear_nextsamplecountdown() {
+  _impl_.nextsamplecountdown_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint32_t ApuState::_internal_nextsamplecountdown() const {
+  return _impl_.nextsamplecountdown_;
+}
+inline uint32_t ApuState::nextsamplecountdown() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.nextSampleCountdown)
+  return _internal_nextsamplecountdown();
+}
+inline void ApuState::_internal_set_nextsamplecountdown(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.nextsamplecountdown_ = value;
+}
+inline void ApuState::set_nextsamplecountdown(uint32_t value) {
+  _internal_set_nextsamplecountdown(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.nextSampleCountdown)
+}
+
+// optional uint32 audioFrameCycle = 12;
+inline bool ApuState::_internal_has_audioframecycle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool ApuState::has_audioframecycle() const {
+  return _internal_has_audioframecycle();
+}
+inline void ApuState::clear_audioframecycle() {
+  _impl_.audioframecycle_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline uint32_t ApuState::_internal_audioframecycle() const {
+  return _impl_.audioframecycle_;
+}
+inline uint32_t ApuState::audioframecycle() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.audioFrameCycle)
+  return _internal_audioframecycle();
+}
+inline void ApuState::_internal_set_audioframecycle(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.audioframecycle_ = value;
+}
+inline void ApuState::set_audioframecycle(uint32_t value) {
+  _internal_set_audioframecycle(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.audioFrameCycle)
+}
+
+// optional uint64 sampleClock = 13;
+inline bool ApuState::_internal_has_sampleclock() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool ApuState::has_sampleclock() const {
+  return _internal_has_sampleclock();
+}
+inline void ApuState::clear_sampleclock() {
+  _impl_.sampleclock_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline uint64_t ApuState::_internal_sampleclock() const {
+  return _impl_.sampleclock_;
+}
+inline uint64_t ApuState::sampleclock() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.sampleClock)
+  return _internal_sampleclock();
+}
+inline void ApuState::_internal_set_sampleclock(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.sampleclock_ = value;
+}
+inline void ApuState::set_sampleclock(uint64_t value) {
+  _internal_set_sampleclock(value);
+  // @@protoc_insertion_point(field_set:Rnes.ApuState.sampleClock)
+}
+
+// optional .Rnes.PulseState pulseA = 20;
+inline bool ApuState::_internal_has_pulsea() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pulsea_ != nullptr);
+  return value;
+}
+inline bool ApuState::has_pulsea() const {
+  return _internal_has_pulsea();
+}
+inline void ApuState::clear_pulsea() {
+  if (_impl_.pulsea_ != nullptr) _impl_.pulsea_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Rnes::PulseState& ApuState::_internal_pulsea() const {
+  const ::Rnes::PulseState* p = _impl_.pulsea_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::PulseState&>(
+      ::Rnes::_PulseState_default_instance_);
+}
+inline const ::Rnes::PulseState& ApuState::pulsea() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.pulseA)
+  return _internal_pulsea();
+}
+inline void ApuState::unsafe_arena_set_allocated_pulsea(
+    ::Rnes::PulseState* pulsea) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pulsea_);
+  }
+  _impl_.pulsea_ = pulsea;
+  if (pulsea) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.ApuState.pulseA)
+}
+inline ::Rnes::PulseState* ApuState::release_pulsea() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Rnes::PulseState* temp = _impl_.pulsea_;
+  _impl_.pulsea_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::PulseState* ApuState::unsafe_arena_release_pulsea() {
+  // @@protoc_insertion_point(field_release:Rnes.ApuState.pulseA)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Rnes::PulseState* temp = _impl_.pulsea_;
+  _impl_.pulsea_ = nullptr;
+  return temp;
+}
+inline ::Rnes::PulseState* ApuState::_internal_mutable_pulsea() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.pulsea_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::PulseState>(GetArenaForAllocation());
+    _impl_.pulsea_ = p;
+  }
+  return _impl_.pulsea_;
+}
+inline ::Rnes::PulseState* ApuState::mutable_pulsea() {
+  ::Rnes::PulseState* _msg = _internal_mutable_pulsea();
+  // @@protoc_insertion_point(field_mutable:Rnes.ApuState.pulseA)
+  return _msg;
+}
+inline void ApuState::set_allocated_pulsea(::Rnes::PulseState* pulsea) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pulsea_;
+  }
+  if (pulsea) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pulsea);
+    if (message_arena != submessage_arena) {
+      pulsea = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pulsea, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.pulsea_ = pulsea;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.ApuState.pulseA)
+}
+
+// optional .Rnes.PulseState pulseB = 21;
+inline bool ApuState::_internal_has_pulseb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pulseb_ != nullptr);
+  return value;
+}
+inline bool ApuState::has_pulseb() const {
+  return _internal_has_pulseb();
+}
+inline void ApuState::clear_pulseb() {
+  if (_impl_.pulseb_ != nullptr) _impl_.pulseb_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Rnes::PulseState& ApuState::_internal_pulseb() const {
+  const ::Rnes::PulseState* p = _impl_.pulseb_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::PulseState&>(
+      ::Rnes::_PulseState_default_instance_);
+}
+inline const ::Rnes::PulseState& ApuState::pulseb() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.pulseB)
+  return _internal_pulseb();
+}
+inline void ApuState::unsafe_arena_set_allocated_pulseb(
+    ::Rnes::PulseState* pulseb) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pulseb_);
+  }
+  _impl_.pulseb_ = pulseb;
+  if (pulseb) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.ApuState.pulseB)
+}
+inline ::Rnes::PulseState* ApuState::release_pulseb() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Rnes::PulseState* temp = _impl_.pulseb_;
+  _impl_.pulseb_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::PulseState* ApuState::unsafe_arena_release_pulseb() {
+  // @@protoc_insertion_point(field_release:Rnes.ApuState.pulseB)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Rnes::PulseState* temp = _impl_.pulseb_;
+  _impl_.pulseb_ = nullptr;
+  return temp;
+}
+inline ::Rnes::PulseState* ApuState::_internal_mutable_pulseb() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.pulseb_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::PulseState>(GetArenaForAllocation());
+    _impl_.pulseb_ = p;
+  }
+  return _impl_.pulseb_;
+}
+inline ::Rnes::PulseState* ApuState::mutable_pulseb() {
+  ::Rnes::PulseState* _msg = _internal_mutable_pulseb();
+  // @@protoc_insertion_point(field_mutable:Rnes.ApuState.pulseB)
+  return _msg;
+}
+inline void ApuState::set_allocated_pulseb(::Rnes::PulseState* pulseb) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pulseb_;
+  }
+  if (pulseb) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pulseb);
+    if (message_arena != submessage_arena) {
+      pulseb = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pulseb, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.pulseb_ = pulseb;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.ApuState.pulseB)
+}
+
+// optional .Rnes.TriangleState triangle = 22;
+inline bool ApuState::_internal_has_triangle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.triangle_ != nullptr);
+  return value;
+}
+inline bool ApuState::has_triangle() const {
+  return _internal_has_triangle();
+}
+inline void ApuState::clear_triangle() {
+  if (_impl_.triangle_ != nullptr) _impl_.triangle_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Rnes::TriangleState& ApuState::_internal_triangle() const {
+  const ::Rnes::TriangleState* p = _impl_.triangle_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::TriangleState&>(
+      ::Rnes::_TriangleState_default_instance_);
+}
+inline const ::Rnes::TriangleState& ApuState::triangle() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.triangle)
+  return _internal_triangle();
+}
+inline void ApuState::unsafe_arena_set_allocated_triangle(
+    ::Rnes::TriangleState* triangle) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.triangle_);
+  }
+  _impl_.triangle_ = triangle;
+  if (triangle) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.ApuState.triangle)
+}
+inline ::Rnes::TriangleState* ApuState::release_triangle() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Rnes::TriangleState* temp = _impl_.triangle_;
+  _impl_.triangle_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::TriangleState* ApuState::unsafe_arena_release_triangle() {
+  // @@protoc_insertion_point(field_release:Rnes.ApuState.triangle)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Rnes::TriangleState* temp = _impl_.triangle_;
+  _impl_.triangle_ = nullptr;
+  return temp;
+}
+inline ::Rnes::TriangleState* ApuState::_internal_mutable_triangle() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.triangle_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::TriangleState>(GetArenaForAllocation());
+    _impl_.triangle_ = p;
+  }
+  return _impl_.triangle_;
+}
+inline ::Rnes::TriangleState* ApuState::mutable_triangle() {
+  ::Rnes::TriangleState* _msg = _internal_mutable_triangle();
+  // @@protoc_insertion_point(field_mutable:Rnes.ApuState.triangle)
+  return _msg;
+}
+inline void ApuState::set_allocated_triangle(::Rnes::TriangleState* triangle) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.triangle_;
+  }
+  if (triangle) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(triangle);
+    if (message_arena != submessage_arena) {
+      triangle = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, triangle, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.triangle_ = triangle;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.ApuState.triangle)
+}
+
+// optional .Rnes.NoiseState noise = 23;
+inline bool ApuState::_internal_has_noise() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.noise_ != nullptr);
+  return value;
+}
+inline bool ApuState::has_noise() const {
+  return _internal_has_noise();
+}
+inline void ApuState::clear_noise() {
+  if (_impl_.noise_ != nullptr) _impl_.noise_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::Rnes::NoiseState& ApuState::_internal_noise() const {
+  const ::Rnes::NoiseState* p = _impl_.noise_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::NoiseState&>(
+      ::Rnes::_NoiseState_default_instance_);
+}
+inline const ::Rnes::NoiseState& ApuState::noise() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.noise)
+  return _internal_noise();
+}
+inline void ApuState::unsafe_arena_set_allocated_noise(
+    ::Rnes::NoiseState* noise) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.noise_);
+  }
+  _impl_.noise_ = noise;
+  if (noise) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.ApuState.noise)
+}
+inline ::Rnes::NoiseState* ApuState::release_noise() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Rnes::NoiseState* temp = _impl_.noise_;
+  _impl_.noise_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::NoiseState* ApuState::unsafe_arena_release_noise() {
+  // @@protoc_insertion_point(field_release:Rnes.ApuState.noise)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Rnes::NoiseState* temp = _impl_.noise_;
+  _impl_.noise_ = nullptr;
+  return temp;
+}
+inline ::Rnes::NoiseState* ApuState::_internal_mutable_noise() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.noise_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::NoiseState>(GetArenaForAllocation());
+    _impl_.noise_ = p;
+  }
+  return _impl_.noise_;
+}
+inline ::Rnes::NoiseState* ApuState::mutable_noise() {
+  ::Rnes::NoiseState* _msg = _internal_mutable_noise();
+  // @@protoc_insertion_point(field_mutable:Rnes.ApuState.noise)
+  return _msg;
+}
+inline void ApuState::set_allocated_noise(::Rnes::NoiseState* noise) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.noise_;
+  }
+  if (noise) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(noise);
+    if (message_arena != submessage_arena) {
+      noise = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, noise, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.noise_ = noise;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.ApuState.noise)
+}
+
+// optional .Rnes.DmcState dmc = 24;
+inline bool ApuState::_internal_has_dmc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dmc_ != nullptr);
+  return value;
+}
+inline bool ApuState::has_dmc() const {
+  return _internal_has_dmc();
+}
+inline void ApuState::clear_dmc() {
+  if (_impl_.dmc_ != nullptr) _impl_.dmc_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::Rnes::DmcState& ApuState::_internal_dmc() const {
+  const ::Rnes::DmcState* p = _impl_.dmc_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::DmcState&>(
+      ::Rnes::_DmcState_default_instance_);
+}
+inline const ::Rnes::DmcState& ApuState::dmc() const {
+  // @@protoc_insertion_point(field_get:Rnes.ApuState.dmc)
+  return _internal_dmc();
+}
+inline void ApuState::unsafe_arena_set_allocated_dmc(
+    ::Rnes::DmcState* dmc) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dmc_);
+  }
+  _impl_.dmc_ = dmc;
+  if (dmc) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.ApuState.dmc)
+}
+inline ::Rnes::DmcState* ApuState::release_dmc() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::Rnes::DmcState* temp = _impl_.dmc_;
+  _impl_.dmc_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::DmcState* ApuState::unsafe_arena_release_dmc() {
+  // @@protoc_insertion_point(field_release:Rnes.ApuState.dmc)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::Rnes::DmcState* temp = _impl_.dmc_;
+  _impl_.dmc_ = nullptr;
+  return temp;
+}
+inline ::Rnes::DmcState* ApuState::_internal_mutable_dmc() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.dmc_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::DmcState>(GetArenaForAllocation());
+    _impl_.dmc_ = p;
+  }
+  return _impl_.dmc_;
+}
+inline ::Rnes::DmcState* ApuState::mutable_dmc() {
+  ::Rnes::DmcState* _msg = _internal_mutable_dmc();
+  // @@protoc_insertion_point(field_mutable:Rnes.ApuState.dmc)
+  return _msg;
+}
+inline void ApuState::set_allocated_dmc(::Rnes::DmcState* dmc) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dmc_;
+  }
+  if (dmc) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dmc);
+    if (message_arena != submessage_arena) {
+      dmc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dmc, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.dmc_ = dmc;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.ApuState.dmc)
+}
+
+// -------------------------------------------------------------------
+
+// PpuState_SpriteState
+
+// optional uint32 yCoordMinus1 = 1;
+inline bool PpuState_SpriteState::_internal_has_ycoordminus1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PpuState_SpriteState::has_ycoordminus1() const {
+  return _internal_has_ycoordminus1();
+}
+inline void PpuState_SpriteState::clear_ycoordminus1() {
+  _impl_.ycoordminus1_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t PpuState_SpriteState::_internal_ycoordminus1() const {
+  return _impl_.ycoordminus1_;
+}
+inline uint32_t PpuState_SpriteState::ycoordminus1() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.SpriteState.yCoordMinus1)
+  return _internal_ycoordminus1();
+}
+inline void PpuState_SpriteState::_internal_set_ycoordminus1(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ycoordminus1_ = value;
+}
+inline void PpuState_SpriteState::set_ycoordminus1(uint32_t value) {
+  _internal_set_ycoordminus1(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.SpriteState.yCoordMinus1)
+}
+
+// optional uint32 tileIndex = 2;
+inline bool PpuState_SpriteState::_internal_has_tileindex() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PpuState_SpriteState::has_tileindex() const {
+  return _internal_has_tileindex();
+}
+inline void PpuState_SpriteState::clear_tileindex() {
+  _impl_.tileindex_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PpuState_SpriteState::_internal_tileindex() const {
+  return _impl_.tileindex_;
+}
+inline uint32_t PpuState_SpriteState::tileindex() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.SpriteState.tileIndex)
+  return _internal_tileindex();
+}
+inline void PpuState_SpriteState::_internal_set_tileindex(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tileindex_ = value;
+}
+inline void PpuState_SpriteState::set_tileindex(uint32_t value) {
+  _internal_set_tileindex(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.SpriteState.tileIndex)
+}
+
+// optional uint32 attr = 3;
+inline bool PpuState_SpriteState::_internal_has_attr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PpuState_SpriteState::has_attr() const {
+  return _internal_has_attr();
+}
+inline void PpuState_SpriteState::clear_attr() {
+  _impl_.attr_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t PpuState_SpriteState::_internal_attr() const {
+  return _impl_.attr_;
+}
+inline uint32_t PpuState_SpriteState::attr() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.SpriteState.attr)
+  return _internal_attr();
+}
+inline void PpuState_SpriteState::_internal_set_attr(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.attr_ = value;
+}
+inline void PpuState_SpriteState::set_attr(uint32_t value) {
+  _internal_set_attr(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.SpriteState.attr)
+}
+
+// optional uint32 xCoord = 4;
+inline bool PpuState_SpriteState::_internal_has_xcoord() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PpuState_SpriteState::has_xcoord() const {
+  return _internal_has_xcoord();
+}
+inline void PpuState_SpriteState::clear_xcoord() {
+  _impl_.xcoord_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t PpuState_SpriteState::_internal_xcoord() const {
+  return _impl_.xcoord_;
+}
+inline uint32_t PpuState_SpriteState::xcoord() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.SpriteState.xCoord)
+  return _internal_xcoord();
+}
+inline void PpuState_SpriteState::_internal_set_xcoord(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.xcoord_ = value;
+}
+inline void PpuState_SpriteState::set_xcoord(uint32_t value) {
+  _internal_set_xcoord(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.SpriteState.xCoord)
+}
+
+// -------------------------------------------------------------------
+
+// PpuState_DotState
+
+// optional uint32 bgPatternShiftLo = 1;
+inline bool PpuState_DotState::_internal_has_bgpatternshiftlo() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_bgpatternshiftlo() const {
+  return _internal_has_bgpatternshiftlo();
+}
+inline void PpuState_DotState::clear_bgpatternshiftlo() {
+  _impl_.bgpatternshiftlo_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t PpuState_DotState::_internal_bgpatternshiftlo() const {
+  return _impl_.bgpatternshiftlo_;
+}
+inline uint32_t PpuState_DotState::bgpatternshiftlo() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.bgPatternShiftLo)
+  return _internal_bgpatternshiftlo();
+}
+inline void PpuState_DotState::_internal_set_bgpatternshiftlo(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.bgpatternshiftlo_ = value;
+}
+inline void PpuState_DotState::set_bgpatternshiftlo(uint32_t value) {
+  _internal_set_bgpatternshiftlo(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.bgPatternShiftLo)
+}
+
+// optional uint32 bgPatternShiftHi = 2;
+inline bool PpuState_DotState::_internal_has_bgpatternshifthi() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_bgpatternshifthi() const {
+  return _internal_has_bgpatternshifthi();
+}
+inline void PpuState_DotState::clear_bgpatternshifthi() {
+  _impl_.bgpatternshifthi_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t PpuState_DotState::_internal_bgpatternshifthi() const {
+  return _impl_.bgpatternshifthi_;
+}
+inline uint32_t PpuState_DotState::bgpatternshifthi() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.bgPatternShiftHi)
+  return _internal_bgpatternshifthi();
+}
+inline void PpuState_DotState::_internal_set_bgpatternshifthi(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.bgpatternshifthi_ = value;
+}
+inline void PpuState_DotState::set_bgpatternshifthi(uint32_t value) {
+  _internal_set_bgpatternshifthi(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.bgPatternShiftHi)
+}
+
+// optional uint32 bgAttrShiftLo = 3;
+inline bool PpuState_DotState::_internal_has_bgattrshiftlo() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_bgattrshiftlo() const {
+  return _internal_has_bgattrshiftlo();
+}
+inline void PpuState_DotState::clear_bgattrshiftlo() {
+  _impl_.bgattrshiftlo_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t PpuState_DotState::_internal_bgattrshiftlo() const {
+  return _impl_.bgattrshiftlo_;
+}
+inline uint32_t PpuState_DotState::bgattrshiftlo() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.bgAttrShiftLo)
+  return _internal_bgattrshiftlo();
+}
+inline void PpuState_DotState::_internal_set_bgattrshiftlo(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.bgattrshiftlo_ = value;
+}
+inline void PpuState_DotState::set_bgattrshiftlo(uint32_t value) {
+  _internal_set_bgattrshiftlo(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.bgAttrShiftLo)
+}
+
+// optional uint32 bgAttrShiftHi = 4;
+inline bool PpuState_DotState::_internal_has_bgattrshifthi() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_bgattrshifthi() const {
+  return _internal_has_bgattrshifthi();
+}
+inline void PpuState_DotState::clear_bgattrshifthi() {
+  _impl_.bgattrshifthi_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t PpuState_DotState::_internal_bgattrshifthi() const {
+  return _impl_.bgattrshifthi_;
+}
+inline uint32_t PpuState_DotState::bgattrshifthi() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.bgAttrShiftHi)
+  return _internal_bgattrshifthi();
+}
+inline void PpuState_DotState::_internal_set_bgattrshifthi(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.bgattrshifthi_ = value;
+}
+inline void PpuState_DotState::set_bgattrshifthi(uint32_t value) {
+  _internal_set_bgattrshifthi(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.bgAttrShiftHi)
+}
+
+// optional uint32 nameLatch = 5;
+inline bool PpuState_DotState::_internal_has_namelatch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_namelatch() const {
+  return _internal_has_namelatch();
+}
+inline void PpuState_DotState::clear_namelatch() {
+  _impl_.namelatch_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t PpuState_DotState::_internal_namelatch() const {
+  return _impl_.namelatch_;
+}
+inline uint32_t PpuState_DotState::namelatch() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.nameLatch)
+  return _internal_namelatch();
+}
+inline void PpuState_DotState::_internal_set_namelatch(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.namelatch_ = value;
+}
+inline void PpuState_DotState::set_namelatch(uint32_t value) {
+  _internal_set_namelatch(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.nameLatch)
+}
+
+// optional uint32 attrLatch = 6;
+inline bool PpuState_DotState::_internal_has_attrlatch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_attrlatch() const {
+  return _internal_has_attrlatch();
+}
+inline void PpuState_DotState::clear_attrlatch() {
+  _impl_.attrlatch_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t PpuState_DotState::_internal_attrlatch() const {
+  return _impl_.attrlatch_;
+}
+inline uint32_t PpuState_DotState::attrlatch() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.attrLatch)
+  return _internal_attrlatch();
+}
+inline void PpuState_DotState::_internal_set_attrlatch(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.attrlatch_ = value;
+}
+inline void PpuState_DotState::set_attrlatch(uint32_t value) {
+  _internal_set_attrlatch(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.attrLatch)
+}
+
+// optional uint32 patternLatchLo = 7;
+inline bool PpuState_DotState::_internal_has_patternlatchlo() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_patternlatchlo() const {
+  return _internal_has_patternlatchlo();
+}
+inline void PpuState_DotState::clear_patternlatchlo() {
+  _impl_.patternlatchlo_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint32_t PpuState_DotState::_internal_patternlatchlo() const {
+  return _impl_.patternlatchlo_;
+}
+inline uint32_t PpuState_DotState::patternlatchlo() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.patternLatchLo)
+  return _internal_patternlatchlo();
+}
+inline void PpuState_DotState::_internal_set_patternlatchlo(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.patternlatchlo_ = value;
+}
+inline void PpuState_DotState::set_patternlatchlo(uint32_t value) {
+  _internal_set_patternlatchlo(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.patternLatchLo)
+}
+
+// optional uint32 patternLatchHi = 8;
+inline bool PpuState_DotState::_internal_has_patternlatchhi() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_patternlatchhi() const {
+  return _internal_has_patternlatchhi();
+}
+inline void PpuState_DotState::clear_patternlatchhi() {
+  _impl_.patternlatchhi_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint32_t PpuState_DotState::_internal_patternlatchhi() const {
+  return _impl_.patternlatchhi_;
+}
+inline uint32_t PpuState_DotState::patternlatchhi() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.patternLatchHi)
+  return _internal_patternlatchhi();
+}
+inline void PpuState_DotState::_internal_set_patternlatchhi(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.patternlatchhi_ = value;
+}
+inline void PpuState_DotState::set_patternlatchhi(uint32_t value) {
+  _internal_set_patternlatchhi(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.patternLatchHi)
+}
+
+// optional bytes secondaryOam = 9;
+inline bool PpuState_DotState::_internal_has_secondaryoam() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_secondaryoam() const {
+  return _internal_has_secondaryoam();
+}
+inline void PpuState_DotState::clear_secondaryoam() {
+  _impl_.secondaryoam_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PpuState_DotState::secondaryoam() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.secondaryOam)
+  return _internal_secondaryoam();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PpuState_DotState::set_secondaryoam(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.secondaryoam_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.secondaryOam)
+}
+inline std::string* PpuState_DotState::mutable_secondaryoam() {
+  std::string* _s = _internal_mutable_secondaryoam();
+  // @@protoc_insertion_point(field_mutable:Rnes.PpuState.DotState.secondaryOam)
+  return _s;
+}
+inline const std::string& PpuState_DotState::_internal_secondaryoam() const {
+  return _impl_.secondaryoam_.Get();
+}
+inline void PpuState_DotState::_internal_set_secondaryoam(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.secondaryoam_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::_internal_mutable_secondaryoam() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.secondaryoam_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::release_secondaryoam() {
+  // @@protoc_insertion_point(field_release:Rnes.PpuState.DotState.secondaryOam)
+  if (!_internal_has_secondaryoam()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.secondaryoam_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.secondaryoam_.IsDefault()) {
+    _impl_.secondaryoam_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PpuState_DotState::set_allocated_secondaryoam(std::string* secondaryoam) {
+  if (secondaryoam != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.secondaryoam_.SetAllocated(secondaryoam, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.secondaryoam_.IsDefault()) {
+    _impl_.secondaryoam_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.PpuState.DotState.secondaryOam)
+}
+
+// optional uint32 oamLatch = 10;
+inline bool PpuState_DotState::_internal_has_oamlatch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_oamlatch() const {
+  return _internal_has_oamlatch();
+}
+inline void PpuState_DotState::clear_oamlatch() {
+  _impl_.oamlatch_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline uint32_t PpuState_DotState::_internal_oamlatch() const {
+  return _impl_.oamlatch_;
+}
+inline uint32_t PpuState_DotState::oamlatch() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.oamLatch)
+  return _internal_oamlatch();
+}
+inline void PpuState_DotState::_internal_set_oamlatch(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.oamlatch_ = value;
+}
+inline void PpuState_DotState::set_oamlatch(uint32_t value) {
+  _internal_set_oamlatch(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.oamLatch)
+}
+
+// optional uint32 evalSprite = 11;
+inline bool PpuState_DotState::_internal_has_evalsprite() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_evalsprite() const {
+  return _internal_has_evalsprite();
+}
+inline void PpuState_DotState::clear_evalsprite() {
+  _impl_.evalsprite_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint32_t PpuState_DotState::_internal_evalsprite() const {
+  return _impl_.evalsprite_;
+}
+inline uint32_t PpuState_DotState::evalsprite() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.evalSprite)
+  return _internal_evalsprite();
+}
+inline void PpuState_DotState::_internal_set_evalsprite(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.evalsprite_ = value;
+}
+inline void PpuState_DotState::set_evalsprite(uint32_t value) {
+  _internal_set_evalsprite(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.evalSprite)
+}
+
+// optional uint32 evalByte = 12;
+inline bool PpuState_DotState::_internal_has_evalbyte() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_evalbyte() const {
+  return _internal_has_evalbyte();
+}
+inline void PpuState_DotState::clear_evalbyte() {
+  _impl_.evalbyte_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline uint32_t PpuState_DotState::_internal_evalbyte() const {
+  return _impl_.evalbyte_;
+}
+inline uint32_t PpuState_DotState::evalbyte() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.evalByte)
+  return _internal_evalbyte();
+}
+inline void PpuState_DotState::_internal_set_evalbyte(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.evalbyte_ = value;
+}
+inline void PpuState_DotState::set_evalbyte(uint32_t value) {
+  _internal_set_evalbyte(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.evalByte)
+}
+
+// optional uint32 secondaryOamAddr = 13;
+inline bool PpuState_DotState::_internal_has_secondaryoamaddr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_secondaryoamaddr() const {
+  return _internal_has_secondaryoamaddr();
+}
+inline void PpuState_DotState::clear_secondaryoamaddr() {
+  _impl_.secondaryoamaddr_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline uint32_t PpuState_DotState::_internal_secondaryoamaddr() const {
+  return _impl_.secondaryoamaddr_;
+}
+inline uint32_t PpuState_DotState::secondaryoamaddr() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.secondaryOamAddr)
+  return _internal_secondaryoamaddr();
+}
+inline void PpuState_DotState::_internal_set_secondaryoamaddr(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.secondaryoamaddr_ = value;
+}
+inline void PpuState_DotState::set_secondaryoamaddr(uint32_t value) {
+  _internal_set_secondaryoamaddr(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.secondaryOamAddr)
+}
+
+// optional bool evalDone = 14;
+inline bool PpuState_DotState::_internal_has_evaldone() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_evaldone() const {
+  return _internal_has_evaldone();
+}
+inline void PpuState_DotState::clear_evaldone() {
+  _impl_.evaldone_ = false;
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline bool PpuState_DotState::_internal_evaldone() const {
+  return _impl_.evaldone_;
+}
+inline bool PpuState_DotState::evaldone() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.evalDone)
+  return _internal_evaldone();
+}
+inline void PpuState_DotState::_internal_set_evaldone(bool value) {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  _impl_.evaldone_ = value;
+}
+inline void PpuState_DotState::set_evaldone(bool value) {
+  _internal_set_evaldone(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.evalDone)
+}
+
+// optional bool sprite0Next = 15;
+inline bool PpuState_DotState::_internal_has_sprite0next() const {
+  bool value = (_impl_._has_bits_[0] & 0x00080000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_sprite0next() const {
+  return _internal_has_sprite0next();
+}
+inline void PpuState_DotState::clear_sprite0next() {
+  _impl_.sprite0next_ = false;
+  _impl_._has_bits_[0] &= ~0x00080000u;
+}
+inline bool PpuState_DotState::_internal_sprite0next() const {
+  return _impl_.sprite0next_;
+}
+inline bool PpuState_DotState::sprite0next() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.sprite0Next)
+  return _internal_sprite0next();
+}
+inline void PpuState_DotState::_internal_set_sprite0next(bool value) {
+  _impl_._has_bits_[0] |= 0x00080000u;
+  _impl_.sprite0next_ = value;
+}
+inline void PpuState_DotState::set_sprite0next(bool value) {
+  _internal_set_sprite0next(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.sprite0Next)
+}
+
+// optional uint32 lineSpriteCount = 16;
+inline bool PpuState_DotState::_internal_has_linespritecount() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_linespritecount() const {
+  return _internal_has_linespritecount();
+}
+inline void PpuState_DotState::clear_linespritecount() {
+  _impl_.linespritecount_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline uint32_t PpuState_DotState::_internal_linespritecount() const {
+  return _impl_.linespritecount_;
+}
+inline uint32_t PpuState_DotState::linespritecount() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.lineSpriteCount)
+  return _internal_linespritecount();
+}
+inline void PpuState_DotState::_internal_set_linespritecount(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  _impl_.linespritecount_ = value;
+}
+inline void PpuState_DotState::set_linespritecount(uint32_t value) {
+  _internal_set_linespritecount(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.lineSpriteCount)
+}
+
+// optional bool lineHasSprite0 = 17;
+inline bool PpuState_DotState::_internal_has_linehassprite0() const {
+  bool value = (_impl_._has_bits_[0] & 0x00100000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_linehassprite0() const {
+  return _internal_has_linehassprite0();
+}
+inline void PpuState_DotState::clear_linehassprite0() {
+  _impl_.linehassprite0_ = false;
+  _impl_._has_bits_[0] &= ~0x00100000u;
+}
+inline bool PpuState_DotState::_internal_linehassprite0() const {
+  return _impl_.linehassprite0_;
+}
+inline bool PpuState_DotState::linehassprite0() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.lineHasSprite0)
+  return _internal_linehassprite0();
+}
+inline void PpuState_DotState::_internal_set_linehassprite0(bool value) {
+  _impl_._has_bits_[0] |= 0x00100000u;
+  _impl_.linehassprite0_ = value;
+}
+inline void PpuState_DotState::set_linehassprite0(bool value) {
+  _internal_set_linehassprite0(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.lineHasSprite0)
+}
+
+// optional bytes spritePatternLo = 18;
+inline bool PpuState_DotState::_internal_has_spritepatternlo() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_spritepatternlo() const {
+  return _internal_has_spritepatternlo();
+}
+inline void PpuState_DotState::clear_spritepatternlo() {
+  _impl_.spritepatternlo_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& PpuState_DotState::spritepatternlo() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.spritePatternLo)
+  return _internal_spritepatternlo();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PpuState_DotState::set_spritepatternlo(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.spritepatternlo_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.spritePatternLo)
+}
+inline std::string* PpuState_DotState::mutable_spritepatternlo() {
+  std::string* _s = _internal_mutable_spritepatternlo();
+  // @@protoc_insertion_point(field_mutable:Rnes.PpuState.DotState.spritePatternLo)
+  return _s;
+}
+inline const std::string& PpuState_DotState::_internal_spritepatternlo() const {
+  return _impl_.spritepatternlo_.Get();
+}
+inline void PpuState_DotState::_internal_set_spritepatternlo(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.spritepatternlo_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::_internal_mutable_spritepatternlo() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.spritepatternlo_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::release_spritepatternlo() {
+  // @@protoc_insertion_point(field_release:Rnes.PpuState.DotState.spritePatternLo)
+  if (!_internal_has_spritepatternlo()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.spritepatternlo_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.spritepatternlo_.IsDefault()) {
+    _impl_.spritepatternlo_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PpuState_DotState::set_allocated_spritepatternlo(std::string* spritepatternlo) {
+  if (spritepatternlo != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.spritepatternlo_.SetAllocated(spritepatternlo, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.spritepatternlo_.IsDefault()) {
+    _impl_.spritepatternlo_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.PpuState.DotState.spritePatternLo)
+}
+
+// optional bytes spritePatternHi = 19;
+inline bool PpuState_DotState::_internal_has_spritepatternhi() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_spritepatternhi() const {
+  return _internal_has_spritepatternhi();
+}
+inline void PpuState_DotState::clear_spritepatternhi() {
+  _impl_.spritepatternhi_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& PpuState_DotState::spritepatternhi() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.spritePatternHi)
+  return _internal_spritepatternhi();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PpuState_DotState::set_spritepatternhi(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.spritepatternhi_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.spritePatternHi)
+}
+inline std::string* PpuState_DotState::mutable_spritepatternhi() {
+  std::string* _s = _internal_mutable_spritepatternhi();
+  // @@protoc_insertion_point(field_mutable:Rnes.PpuState.DotState.spritePatternHi)
+  return _s;
+}
+inline const std::string& PpuState_DotState::_internal_spritepatternhi() const {
+  return _impl_.spritepatternhi_.Get();
+}
+inline void PpuState_DotState::_internal_set_spritepatternhi(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.spritepatternhi_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::_internal_mutable_spritepatternhi() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.spritepatternhi_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::release_spritepatternhi() {
+  // @@protoc_insertion_point(field_release:Rnes.PpuState.DotState.spritePatternHi)
+  if (!_internal_has_spritepatternhi()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.spritepatternhi_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.spritepatternhi_.IsDefault()) {
+    _impl_.spritepatternhi_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PpuState_DotState::set_allocated_spritepatternhi(std::string* spritepatternhi) {
+  if (spritepatternhi != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.spritepatternhi_.SetAllocated(spritepatternhi, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.spritepatternhi_.IsDefault()) {
+    _impl_.spritepatternhi_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.PpuState.DotState.spritePatternHi)
+}
+
+// optional bytes spriteAttr = 20;
+inline bool PpuState_DotState::_internal_has_spriteattr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_spriteattr() const {
+  return _internal_has_spriteattr();
+}
+inline void PpuState_DotState::clear_spriteattr() {
+  _impl_.spriteattr_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& PpuState_DotState::spriteattr() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.spriteAttr)
+  return _internal_spriteattr();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PpuState_DotState::set_spriteattr(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.spriteattr_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.spriteAttr)
+}
+inline std::string* PpuState_DotState::mutable_spriteattr() {
+  std::string* _s = _internal_mutable_spriteattr();
+  // @@protoc_insertion_point(field_mutable:Rnes.PpuState.DotState.spriteAttr)
+  return _s;
+}
+inline const std::string& PpuState_DotState::_internal_spriteattr() const {
+  return _impl_.spriteattr_.Get();
+}
+inline void PpuState_DotState::_internal_set_spriteattr(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.spriteattr_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::_internal_mutable_spriteattr() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.spriteattr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::release_spriteattr() {
+  // @@protoc_insertion_point(field_release:Rnes.PpuState.DotState.spriteAttr)
+  if (!_internal_has_spriteattr()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.spriteattr_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.spriteattr_.IsDefault()) {
+    _impl_.spriteattr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PpuState_DotState::set_allocated_spriteattr(std::string* spriteattr) {
+  if (spriteattr != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.spriteattr_.SetAllocated(spriteattr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.spriteattr_.IsDefault()) {
+    _impl_.spriteattr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.PpuState.DotState.spriteAttr)
+}
+
+// optional bytes spriteX = 21;
+inline bool PpuState_DotState::_internal_has_spritex() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_spritex() const {
+  return _internal_has_spritex();
+}
+inline void PpuState_DotState::clear_spritex() {
+  _impl_.spritex_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& PpuState_DotState::spritex() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.spriteX)
+  return _internal_spritex();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PpuState_DotState::set_spritex(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.spritex_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.spriteX)
+}
+inline std::string* PpuState_DotState::mutable_spritex() {
+  std::string* _s = _internal_mutable_spritex();
+  // @@protoc_insertion_point(field_mutable:Rnes.PpuState.DotState.spriteX)
+  return _s;
+}
+inline const std::string& PpuState_DotState::_internal_spritex() const {
+  return _impl_.spritex_.Get();
+}
+inline void PpuState_DotState::_internal_set_spritex(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.spritex_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::_internal_mutable_spritex() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.spritex_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PpuState_DotState::release_spritex() {
+  // @@protoc_insertion_point(field_release:Rnes.PpuState.DotState.spriteX)
+  if (!_internal_has_spritex()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.spritex_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.spritex_.IsDefault()) {
+    _impl_.spritex_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PpuState_DotState::set_allocated_spritex(std::string* spritex) {
+  if (spritex != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.spritex_.SetAllocated(spritex, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.spritex_.IsDefault()) {
+    _impl_.spritex_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.PpuState.DotState.spriteX)
+}
+
+// optional bool a12High = 22;
+inline bool PpuState_DotState::_internal_has_a12high() const {
+  bool value = (_impl_._has_bits_[0] & 0x00200000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_a12high() const {
+  return _internal_has_a12high();
+}
+inline void PpuState_DotState::clear_a12high() {
+  _impl_.a12high_ = false;
+  _impl_._has_bits_[0] &= ~0x00200000u;
+}
+inline bool PpuState_DotState::_internal_a12high() const {
+  return _impl_.a12high_;
+}
+inline bool PpuState_DotState::a12high() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.a12High)
+  return _internal_a12high();
+}
+inline void PpuState_DotState::_internal_set_a12high(bool value) {
+  _impl_._has_bits_[0] |= 0x00200000u;
+  _impl_.a12high_ = value;
+}
+inline void PpuState_DotState::set_a12high(bool value) {
+  _internal_set_a12high(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.a12High)
+}
+
+// optional uint64 a12LowCycle = 23;
+inline bool PpuState_DotState::_internal_has_a12lowcycle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00400000u) != 0;
+  return value;
+}
+inline bool PpuState_DotState::has_a12lowcycle() const {
+  return _internal_has_a12lowcycle();
+}
+inline void PpuState_DotState::clear_a12lowcycle() {
+  _impl_.a12lowcycle_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00400000u;
+}
+inline uint64_t PpuState_DotState::_internal_a12lowcycle() const {
+  return _impl_.a12lowcycle_;
+}
+inline uint64_t PpuState_DotState::a12lowcycle() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.DotState.a12LowCycle)
+  return _internal_a12lowcycle();
+}
+inline void PpuState_DotState::_internal_set_a12lowcycle(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00400000u;
+  _impl_.a12lowcycle_ = value;
+}
+inline void PpuState_DotState::set_a12lowcycle(uint64_t value) {
+  _internal_set_a12lowcycle(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.DotState.a12LowCycle)
+}
+
+// -------------------------------------------------------------------
+
+// PpuState
+
+// optional uint64 cycle = 1;
+inline bool PpuState::_internal_has_cycle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PpuState::has_cycle() const {
+  return _internal_has_cycle();
+}
+inline void PpuState::clear_cycle() {
+  _impl_.cycle_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PpuState::_internal_cycle() const {
+  return _impl_.cycle_;
+}
+inline uint64_t PpuState::cycle() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.cycle)
+  return _internal_cycle();
+}
+inline void PpuState::_internal_set_cycle(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.cycle_ = value;
+}
+inline void PpuState::set_cycle(uint64_t value) {
+  _internal_set_cycle(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.cycle)
+}
+
+// optional uint64 frame = 2;
+inline bool PpuState::_internal_has_frame() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PpuState::has_frame() const {
+  return _internal_has_frame();
+}
+inline void PpuState::clear_frame() {
+  _impl_.frame_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t PpuState::_internal_frame() const {
+  return _impl_.frame_;
+}
+inline uint64_t PpuState::frame() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.frame)
+  return _internal_frame();
+}
+inline void PpuState::_internal_set_frame(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.frame_ = value;
+}
+inline void PpuState::set_frame(uint64_t value) {
+  _internal_set_frame(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.frame)
+}
+
+// repeated uint32 regs = 3;
+inline int PpuState::_internal_regs_size() const {
+  return _impl_.regs_.size();
+}
+inline int PpuState::regs_size() const {
+  return _internal_regs_size();
+}
+inline void PpuState::clear_regs() {
+  _impl_.regs_.Clear();
+}
+inline uint32_t PpuState::_internal_regs(int index) const {
+  return _impl_.regs_.Get(index);
+}
+inline uint32_t PpuState::regs(int index) const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.regs)
+  return _internal_regs(index);
+}
+inline void PpuState::set_regs(int index, uint32_t value) {
+  _impl_.regs_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.regs)
+}
+inline void PpuState::_internal_add_regs(uint32_t value) {
+  _impl_.regs_.Add(value);
+}
+inline void PpuState::add_regs(uint32_t value) {
+  _internal_add_regs(value);
+  // @@protoc_insertion_point(field_add:Rnes.PpuState.regs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PpuState::_internal_regs() const {
+  return _impl_.regs_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PpuState::regs() const {
+  // @@protoc_insertion_point(field_list:Rnes.PpuState.regs)
+  return _internal_regs();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PpuState::_internal_mutable_regs() {
+  return &_impl_.regs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PpuState::mutable_regs() {
+  // @@protoc_insertion_point(field_mutable_list:Rnes.PpuState.regs)
+  return _internal_mutable_regs();
+}
+
+// repeated .Rnes.PpuState.SpriteState spriteRam = 4;
+inline int PpuState::_internal_spriteram_size() const {
+  return _impl_.spriteram_.size();
+}
+inline int PpuState::spriteram_size() const {
+  return _internal_spriteram_size();
+}
+inline void PpuState::clear_spriteram() {
+  _impl_.spriteram_.Clear();
+}
+inline ::Rnes::PpuState_SpriteState* PpuState::mutable_spriteram(int index) {
+  // @@protoc_insertion_point(field_mutable:Rnes.PpuState.spriteRam)
+  return _impl_.spriteram_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Rnes::PpuState_SpriteState >*
+PpuState::mutable_spriteram() {
+  // @@protoc_insertion_point(field_mutable_list:Rnes.PpuState.spriteRam)
+  return &_impl_.spriteram_;
+}
+inline const ::Rnes::PpuState_SpriteState& PpuState::_internal_spriteram(int index) const {
+  return _impl_.spriteram_.Get(index);
+}
+inline const ::Rnes::PpuState_SpriteState& PpuState::spriteram(int index) const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.spriteRam)
+  return _internal_spriteram(index);
+}
+inline ::Rnes::PpuState_SpriteState* PpuState::_internal_add_spriteram() {
+  return _impl_.spriteram_.Add();
+}
+inline ::Rnes::PpuState_SpriteState* PpuState::add_spriteram() {
+  ::Rnes::PpuState_SpriteState* _add = _internal_add_spriteram();
+  // @@protoc_insertion_point(field_add:Rnes.PpuState.spriteRam)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Rnes::PpuState_SpriteState >&
+PpuState::spriteram() const {
+  // @@protoc_insertion_point(field_list:Rnes.PpuState.spriteRam)
+  return _impl_.spriteram_;
+}
+
+// optional uint32 vramToggle = 5;
+inline bool PpuState::_internal_has_vramtoggle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PpuState::has_vramtoggle() const {
+  return _internal_has_vramtoggle();
+}
+inline void PpuState::clear_vramtoggle() {
+  _impl_.vramtoggle_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t PpuState::_internal_vramtoggle() const {
+  return _impl_.vramtoggle_;
+}
+inline uint32_t PpuState::vramtoggle() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.vramToggle)
+  return _internal_vramtoggle();
+}
+inline void PpuState::_internal_set_vramtoggle(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.vramtoggle_ = value;
+}
+inline void PpuState::set_vramtoggle(uint32_t value) {
+  _internal_set_vramtoggle(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.vramToggle)
+}
+
+// optional uint32 vramFineXScroll = 6;
+inline bool PpuState::_internal_has_vramfinexscroll() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PpuState::has_vramfinexscroll() const {
+  return _internal_has_vramfinexscroll();
+}
+inline void PpuState::clear_vramfinexscroll() {
+  _impl_.vramfinexscroll_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t PpuState::_internal_vramfinexscroll() const {
+  return _impl_.vramfinexscroll_;
+}
+inline uint32_t PpuState::vramfinexscroll() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.vramFineXScroll)
+  return _internal_vramfinexscroll();
+}
+inline void PpuState::_internal_set_vramfinexscroll(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.vramfinexscroll_ = value;
+}
+inline void PpuState::set_vramfinexscroll(uint32_t value) {
+  _internal_set_vramfinexscroll(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.vramFineXScroll)
+}
+
+// optional uint32 vramCurrentAddr = 7;
+inline bool PpuState::_internal_has_vramcurrentaddr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool PpuState::has_vramcurrentaddr() const {
+  return _internal_has_vramcurrentaddr();
+}
+inline void PpuState::clear_vramcurrentaddr() {
+  _impl_.vramcurrentaddr_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t PpuState::_internal_vramcurrentaddr() const {
+  return _impl_.vramcurrentaddr_;
+}
+inline uint32_t PpuState::vramcurrentaddr() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.vramCurrentAddr)
+  return _internal_vramcurrentaddr();
+}
+inline void PpuState::_internal_set_vramcurrentaddr(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.vramcurrentaddr_ = value;
+}
+inline void PpuState::set_vramcurrentaddr(uint32_t value) {
+  _internal_set_vramcurrentaddr(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.vramCurrentAddr)
+}
+
+// optional uint32 vramTempAddr = 8;
+inline bool PpuState::_internal_has_vramtempaddr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool PpuState::has_vramtempaddr() const {
+  return _internal_has_vramtempaddr();
+}
+inline void PpuState::clear_vramtempaddr() {
+  _impl_.vramtempaddr_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t PpuState::_internal_vramtempaddr() const {
+  return _impl_.vramtempaddr_;
+}
+inline uint32_t PpuState::vramtempaddr() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.vramTempAddr)
+  return _internal_vramtempaddr();
+}
+inline void PpuState::_internal_set_vramtempaddr(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.vramtempaddr_ = value;
+}
+inline void PpuState::set_vramtempaddr(uint32_t value) {
+  _internal_set_vramtempaddr(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.vramTempAddr)
+}
+
+// optional uint32 vramMachineAddr = 9;
+inline bool PpuState::_internal_has_vrammachineaddr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool PpuState::has_vrammachineaddr() const {
+  return _internal_has_vrammachineaddr();
+}
+inline void PpuState::clear_vrammachineaddr() {
+  _impl_.vrammachineaddr_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t PpuState::_internal_vrammachineaddr() const {
+  return _impl_.vrammachineaddr_;
+}
+inline uint32_t PpuState::vrammachineaddr() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.vramMachineAddr)
+  return _internal_vrammachineaddr();
+}
+inline void PpuState::_internal_set_vrammachineaddr(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.vrammachineaddr_ = value;
+}
+inline void PpuState::set_vrammachineaddr(uint32_t value) {
+  _internal_set_vrammachineaddr(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.vramMachineAddr)
+}
+
+// optional uint32 vramReadLatch = 10;
+inline bool PpuState::_internal_has_vramreadlatch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool PpuState::has_vramreadlatch() const {
+  return _internal_has_vramreadlatch();
+}
+inline void PpuState::clear_vramreadlatch() {
+  _impl_.vramreadlatch_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t PpuState::_internal_vramreadlatch() const {
+  return _impl_.vramreadlatch_;
+}
+inline uint32_t PpuState::vramreadlatch() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.vramReadLatch)
+  return _internal_vramreadlatch();
+}
+inline void PpuState::_internal_set_vramreadlatch(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.vramreadlatch_ = value;
+}
+inline void PpuState::set_vramreadlatch(uint32_t value) {
+  _internal_set_vramreadlatch(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.vramReadLatch)
+}
+
+// optional uint32 scrollingMachineState = 11;
+inline bool PpuState::_internal_has_scrollingmachinestate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool PpuState::has_scrollingmachinestate() const {
+  return _internal_has_scrollingmachinestate();
+}
+inline void PpuState::clear_scrollingmachinestate() {
+  _impl_.scrollingmachinestate_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint32_t PpuState::_internal_scrollingmachinestate() const {
+  return _impl_.scrollingmachinestate_;
+}
+inline uint32_t PpuState::scrollingmachinestate() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.scrollingMachineState)
+  return _internal_scrollingmachinestate();
+}
+inline void PpuState::_internal_set_scrollingmachinestate(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.scrollingmachinestate_ = value;
+}
+inline void PpuState::set_scrollingmachinestate(uint32_t value) {
+  _internal_set_scrollingmachinestate(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.scrollingMachineState)
+}
+
+// optional uint32 xScrollOrigin = 12;
+inline bool PpuState::_internal_has_xscrollorigin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool PpuState::has_xscrollorigin() const {
+  return _internal_has_xscrollorigin();
+}
+inline void PpuState::clear_xscrollorigin() {
+  _impl_.xscrollorigin_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t PpuState::_internal_xscrollorigin() const {
+  return _impl_.xscrollorigin_;
+}
+inline uint32_t PpuState::xscrollorigin() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.xScrollOrigin)
+  return _internal_xscrollorigin();
+}
+inline void PpuState::_internal_set_xscrollorigin(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.xscrollorigin_ = value;
+}
+inline void PpuState::set_xscrollorigin(uint32_t value) {
+  _internal_set_xscrollorigin(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.xScrollOrigin)
+}
+
+// optional uint32 yScrollOrigin = 13;
+inline bool PpuState::_internal_has_yscrollorigin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool PpuState::has_yscrollorigin() const {
+  return _internal_has_yscrollorigin();
+}
+inline void PpuState::clear_yscrollorigin() {
+  _impl_.yscrollorigin_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint32_t PpuState::_internal_yscrollorigin() const {
+  return _impl_.yscrollorigin_;
+}
+inline uint32_t PpuState::yscrollorigin() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.yScrollOrigin)
+  return _internal_yscrollorigin();
+}
+inline void PpuState::_internal_set_yscrollorigin(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.yscrollorigin_ = value;
+}
+inline void PpuState::set_yscrollorigin(uint32_t value) {
+  _internal_set_yscrollorigin(value);
+  // @@protoc_insertion_point(field_set:Rnes.PpuState.yScrollOrigin)
+}
+
+// optional .Rnes.PpuState.DotState dot = 14;
+inline bool PpuState::_internal_has_dot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dot_ != nullptr);
+  return value;
+}
+inline bool PpuState::has_dot() const {
+  return _internal_has_dot();
+}
+inline void PpuState::clear_dot() {
+  if (_impl_.dot_ != nullptr) _impl_.dot_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Rnes::PpuState_DotState& PpuState::_internal_dot() const {
+  const ::Rnes::PpuState_DotState* p = _impl_.dot_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::PpuState_DotState&>(
+      ::Rnes::_PpuState_DotState_default_instance_);
+}
+inline const ::Rnes::PpuState_DotState& PpuState::dot() const {
+  // @@protoc_insertion_point(field_get:Rnes.PpuState.dot)
+  return _internal_dot();
+}
+inline void PpuState::unsafe_arena_set_allocated_dot(
+    ::Rnes::PpuState_DotState* dot) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dot_);
+  }
+  _impl_.dot_ = dot;
+  if (dot) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.PpuState.dot)
+}
+inline ::Rnes::PpuState_DotState* PpuState::release_dot() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Rnes::PpuState_DotState* temp = _impl_.dot_;
+  _impl_.dot_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::PpuState_DotState* PpuState::unsafe_arena_release_dot() {
+  // @@protoc_insertion_point(field_release:Rnes.PpuState.dot)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Rnes::PpuState_DotState* temp = _impl_.dot_;
+  _impl_.dot_ = nullptr;
+  return temp;
+}
+inline ::Rnes::PpuState_DotState* PpuState::_internal_mutable_dot() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.dot_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::PpuState_DotState>(GetArenaForAllocation());
+    _impl_.dot_ = p;
+  }
+  return _impl_.dot_;
+}
+inline ::Rnes::PpuState_DotState* PpuState::mutable_dot() {
+  ::Rnes::PpuState_DotState* _msg = _internal_mutable_dot();
+  // @@protoc_insertion_point(field_mutable:Rnes.PpuState.dot)
+  return _msg;
+}
+inline void PpuState::set_allocated_dot(::Rnes::PpuState_DotState* dot) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dot_;
+  }
+  if (dot) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dot);
+    if (message_arena != submessage_arena) {
+      dot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dot, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.dot_ = dot;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.PpuState.dot)
+}
+
+// -------------------------------------------------------------------
+
+// MmcState_MmcNoneState
+
+// -------------------------------------------------------------------
+
+// MmcState_Mmc1State
+
+// optional uint32 controlReg = 1;
+inline bool MmcState_Mmc1State::_internal_has_controlreg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc1State::has_controlreg() const {
+  return _internal_has_controlreg();
+}
+inline void MmcState_Mmc1State::clear_controlreg() {
+  _impl_.controlreg_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t MmcState_Mmc1State::_internal_controlreg() const {
+  return _impl_.controlreg_;
+}
+inline uint32_t MmcState_Mmc1State::controlreg() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc1State.controlReg)
+  return _internal_controlreg();
+}
+inline void MmcState_Mmc1State::_internal_set_controlreg(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.controlreg_ = value;
+}
+inline void MmcState_Mmc1State::set_controlreg(uint32_t value) {
+  _internal_set_controlreg(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc1State.controlReg)
+}
+
+// optional uint32 chr0Bank = 2;
+inline bool MmcState_Mmc1State::_internal_has_chr0bank() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc1State::has_chr0bank() const {
+  return _internal_has_chr0bank();
+}
+inline void MmcState_Mmc1State::clear_chr0bank() {
+  _impl_.chr0bank_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t MmcState_Mmc1State::_internal_chr0bank() const {
+  return _impl_.chr0bank_;
+}
+inline uint32_t MmcState_Mmc1State::chr0bank() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc1State.chr0Bank)
+  return _internal_chr0bank();
+}
+inline void MmcState_Mmc1State::_internal_set_chr0bank(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.chr0bank_ = value;
+}
+inline void MmcState_Mmc1State::set_chr0bank(uint32_t value) {
+  _internal_set_chr0bank(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc1State.chr0Bank)
+}
+
+// optional uint32 chr1Bank = 3;
+inline bool MmcState_Mmc1State::_internal_has_chr1bank() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc1State::has_chr1bank() const {
+  return _internal_has_chr1bank();
+}
+inline void MmcState_Mmc1State::clear_chr1bank() {
+  _impl_.chr1bank_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t MmcState_Mmc1State::_internal_chr1bank() const {
+  return _impl_.chr1bank_;
+}
+inline uint32_t MmcState_Mmc1State::chr1bank() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc1State.chr1Bank)
+  return _internal_chr1bank();
+}
+inline void MmcState_Mmc1State::_internal_set_chr1bank(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.chr1bank_ = value;
+}
+inline void MmcState_Mmc1State::set_chr1bank(uint32_t value) {
+  _internal_set_chr1bank(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc1State.chr1Bank)
+}
+
+// optional uint32 prgBank = 4;
+inline bool MmcState_Mmc1State::_internal_has_prgbank() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc1State::has_prgbank() const {
+  return _internal_has_prgbank();
+}
+inline void MmcState_Mmc1State::clear_prgbank() {
+  _impl_.prgbank_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t MmcState_Mmc1State::_internal_prgbank() const {
+  return _impl_.prgbank_;
+}
+inline uint32_t MmcState_Mmc1State::prgbank() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc1State.prgBank)
+  return _internal_prgbank();
+}
+inline void MmcState_Mmc1State::_internal_set_prgbank(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.prgbank_ = value;
+}
+inline void MmcState_Mmc1State::set_prgbank(uint32_t value) {
+  _internal_set_prgbank(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc1State.prgBank)
+}
+
+// optional uint32 shiftRegister = 5;
+inline bool MmcState_Mmc1State::_internal_has_shiftregister() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc1State::has_shiftregister() const {
+  return _internal_has_shiftregister();
+}
+inline void MmcState_Mmc1State::clear_shiftregister() {
+  _impl_.shiftregister_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t MmcState_Mmc1State::_internal_shiftregister() const {
+  return _impl_.shiftregister_;
+}
+inline uint32_t MmcState_Mmc1State::shiftregister() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc1State.shiftRegister)
+  return _internal_shiftregister();
+}
+inline void MmcState_Mmc1State::_internal_set_shiftregister(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.shiftregister_ = value;
+}
+inline void MmcState_Mmc1State::set_shiftregister(uint32_t value) {
+  _internal_set_shiftregister(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc1State.shiftRegister)
+}
+
+// -------------------------------------------------------------------
+
+// MmcState_Mmc3State
+
+// optional uint32 bankSelectReg = 1;
+inline bool MmcState_Mmc3State::_internal_has_bankselectreg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc3State::has_bankselectreg() const {
+  return _internal_has_bankselectreg();
+}
+inline void MmcState_Mmc3State::clear_bankselectreg() {
+  _impl_.bankselectreg_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t MmcState_Mmc3State::_internal_bankselectreg() const {
+  return _impl_.bankselectreg_;
+}
+inline uint32_t MmcState_Mmc3State::bankselectreg() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc3State.bankSelectReg)
+  return _internal_bankselectreg();
+}
+inline void MmcState_Mmc3State::_internal_set_bankselectreg(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.bankselectreg_ = value;
+}
+inline void MmcState_Mmc3State::set_bankselectreg(uint32_t value) {
+  _internal_set_bankselectreg(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc3State.bankSelectReg)
+}
+
+// optional uint32 mirrorReg = 2;
+inline bool MmcState_Mmc3State::_internal_has_mirrorreg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc3State::has_mirrorreg() const {
+  return _internal_has_mirrorreg();
+}
+inline void MmcState_Mmc3State::clear_mirrorreg() {
+  _impl_.mirrorreg_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t MmcState_Mmc3State::_internal_mirrorreg() const {
+  return _impl_.mirrorreg_;
+}
+inline uint32_t MmcState_Mmc3State::mirrorreg() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc3State.mirrorReg)
+  return _internal_mirrorreg();
+}
+inline void MmcState_Mmc3State::_internal_set_mirrorreg(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.mirrorreg_ = value;
+}
+inline void MmcState_Mmc3State::set_mirrorreg(uint32_t value) {
+  _internal_set_mirrorreg(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc3State.mirrorReg)
+}
+
+// optional uint32 prgRamReg = 3;
+inline bool MmcState_Mmc3State::_internal_has_prgramreg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc3State::has_prgramreg() const {
+  return _internal_has_prgramreg();
+}
+inline void MmcState_Mmc3State::clear_prgramreg() {
+  _impl_.prgramreg_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t MmcState_Mmc3State::_internal_prgramreg() const {
+  return _impl_.prgramreg_;
+}
+inline uint32_t MmcState_Mmc3State::prgramreg() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc3State.prgRamReg)
+  return _internal_prgramreg();
+}
+inline void MmcState_Mmc3State::_internal_set_prgramreg(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.prgramreg_ = value;
+}
+inline void MmcState_Mmc3State::set_prgramreg(uint32_t value) {
+  _internal_set_prgramreg(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc3State.prgRamReg)
+}
+
+// optional bytes bankRegister = 4;
+inline bool MmcState_Mmc3State::_internal_has_bankregister() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc3State::has_bankregister() const {
+  return _internal_has_bankregister();
+}
+inline void MmcState_Mmc3State::clear_bankregister() {
+  _impl_.bankregister_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MmcState_Mmc3State::bankregister() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc3State.bankRegister)
+  return _internal_bankregister();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MmcState_Mmc3State::set_bankregister(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.bankregister_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc3State.bankRegister)
+}
+inline std::string* MmcState_Mmc3State::mutable_bankregister() {
+  std::string* _s = _internal_mutable_bankregister();
+  // @@protoc_insertion_point(field_mutable:Rnes.MmcState.Mmc3State.bankRegister)
+  return _s;
+}
+inline const std::string& MmcState_Mmc3State::_internal_bankregister() const {
+  return _impl_.bankregister_.Get();
+}
+inline void MmcState_Mmc3State::_internal_set_bankregister(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.bankregister_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MmcState_Mmc3State::_internal_mutable_bankregister() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.bankregister_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MmcState_Mmc3State::release_bankregister() {
+  // @@protoc_insertion_point(field_release:Rnes.MmcState.Mmc3State.bankRegister)
+  if (!_internal_has_bankregister()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.bankregister_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bankregister_.IsDefault()) {
+    _impl_.bankregister_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MmcState_Mmc3State::set_allocated_bankregister(std::string* bankregister) {
+  if (bankregister != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.bankregister_.SetAllocated(bankregister, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bankregister_.IsDefault()) {
+    _impl_.bankregister_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.MmcState.Mmc3State.bankRegister)
+}
+
+// optional uint32 irqReloadReg = 5;
+inline bool MmcState_Mmc3State::_internal_has_irqreloadreg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc3State::has_irqreloadreg() const {
+  return _internal_has_irqreloadreg();
+}
+inline void MmcState_Mmc3State::clear_irqreloadreg() {
+  _impl_.irqreloadreg_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t MmcState_Mmc3State::_internal_irqreloadreg() const {
+  return _impl_.irqreloadreg_;
+}
+inline uint32_t MmcState_Mmc3State::irqreloadreg() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc3State.irqReloadReg)
+  return _internal_irqreloadreg();
+}
+inline void MmcState_Mmc3State::_internal_set_irqreloadreg(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.irqreloadreg_ = value;
+}
+inline void MmcState_Mmc3State::set_irqreloadreg(uint32_t value) {
+  _internal_set_irqreloadreg(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc3State.irqReloadReg)
+}
+
+// optional uint32 irqCounterReg = 6;
+inline bool MmcState_Mmc3State::_internal_has_irqcounterreg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc3State::has_irqcounterreg() const {
+  return _internal_has_irqcounterreg();
+}
+inline void MmcState_Mmc3State::clear_irqcounterreg() {
+  _impl_.irqcounterreg_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t MmcState_Mmc3State::_internal_irqcounterreg() const {
+  return _impl_.irqcounterreg_;
+}
+inline uint32_t MmcState_Mmc3State::irqcounterreg() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc3State.irqCounterReg)
+  return _internal_irqcounterreg();
+}
+inline void MmcState_Mmc3State::_internal_set_irqcounterreg(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.irqcounterreg_ = value;
+}
+inline void MmcState_Mmc3State::set_irqcounterreg(uint32_t value) {
+  _internal_set_irqcounterreg(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc3State.irqCounterReg)
+}
+
+// optional bool irqEnabled = 7;
+inline bool MmcState_Mmc3State::_internal_has_irqenabled() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc3State::has_irqenabled() const {
+  return _internal_has_irqenabled();
+}
+inline void MmcState_Mmc3State::clear_irqenabled() {
+  _impl_.irqenabled_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool MmcState_Mmc3State::_internal_irqenabled() const {
+  return _impl_.irqenabled_;
+}
+inline bool MmcState_Mmc3State::irqenabled() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc3State.irqEnabled)
+  return _internal_irqenabled();
+}
+inline void MmcState_Mmc3State::_internal_set_irqenabled(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.irqenabled_ = value;
+}
+inline void MmcState_Mmc3State::set_irqenabled(bool value) {
+  _internal_set_irqenabled(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc3State.irqEnabled)
+}
+
+// optional bool irqPending = 8;
+inline bool MmcState_Mmc3State::_internal_has_irqpending() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool MmcState_Mmc3State::has_irqpending() const {
+  return _internal_has_irqpending();
+}
+inline void MmcState_Mmc3State::clear_irqpending() {
+  _impl_.irqpending_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool MmcState_Mmc3State::_internal_irqpending() const {
+  return _impl_.irqpending_;
+}
+inline bool MmcState_Mmc3State::irqpending() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.Mmc3State.irqPending)
+  return _internal_irqpending();
+}
+inline void MmcState_Mmc3State::_internal_set_irqpending(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.irqpending_ = value;
+}
+inline void MmcState_Mmc3State::set_irqpending(bool value) {
+  _internal_set_irqpending(value);
+  // @@protoc_insertion_point(field_set:Rnes.MmcState.Mmc3State.irqPending)
+}
+
+// -------------------------------------------------------------------
+
+// MmcState
+
+// optional .Rnes.MmcState.MmcNoneState mmcNone = 1;
+inline bool MmcState::_internal_has_mmcnone() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mmcnone_ != nullptr);
+  return value;
+}
+inline bool MmcState::has_mmcnone() const {
+  return _internal_has_mmcnone();
+}
+inline void MmcState::clear_mmcnone() {
+  if (_impl_.mmcnone_ != nullptr) _impl_.mmcnone_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Rnes::MmcState_MmcNoneState& MmcState::_internal_mmcnone() const {
+  const ::Rnes::MmcState_MmcNoneState* p = _impl_.mmcnone_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::MmcState_MmcNoneState&>(
+      ::Rnes::_MmcState_MmcNoneState_default_instance_);
+}
+inline const ::Rnes::MmcState_MmcNoneState& MmcState::mmcnone() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.mmcNone)
+  return _internal_mmcnone();
+}
+inline void MmcState::unsafe_arena_set_allocated_mmcnone(
+    ::Rnes::MmcState_MmcNoneState* mmcnone) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mmcnone_);
+  }
+  _impl_.mmcnone_ = mmcnone;
+  if (mmcnone) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.MmcState.mmcNone)
+}
+inline ::Rnes::MmcState_MmcNoneState* MmcState::release_mmcnone() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Rnes::MmcState_MmcNoneState* temp = _impl_.mmcnone_;
+  _impl_.mmcnone_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::MmcState_MmcNoneState* MmcState::unsafe_arena_release_mmcnone() {
+  // @@protoc_insertion_point(field_release:Rnes.MmcState.mmcNone)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Rnes::MmcState_MmcNoneState* temp = _impl_.mmcnone_;
+  _impl_.mmcnone_ = nullptr;
+  return temp;
+}
+inline ::Rnes::MmcState_MmcNoneState* MmcState::_internal_mutable_mmcnone() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.mmcnone_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::MmcState_MmcNoneState>(GetArenaForAllocation());
+    _impl_.mmcnone_ = p;
+  }
+  return _impl_.mmcnone_;
+}
+inline ::Rnes::MmcState_MmcNoneState* MmcState::mutable_mmcnone() {
+  ::Rnes::MmcState_MmcNoneState* _msg = _internal_mutable_mmcnone();
+  // @@protoc_insertion_point(field_mutable:Rnes.MmcState.mmcNone)
+  return _msg;
+}
+inline void MmcState::set_allocated_mmcnone(::Rnes::MmcState_MmcNoneState* mmcnone) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mmcnone_;
+  }
+  if (mmcnone) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mmcnone);
+    if (message_arena != submessage_arena) {
+      mmcnone = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mmcnone, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.mmcnone_ = mmcnone;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.MmcState.mmcNone)
+}
+
+// optional .Rnes.MmcState.Mmc1State mmc1 = 2;
+inline bool MmcState::_internal_has_mmc1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mmc1_ != nullptr);
+  return value;
+}
+inline bool MmcState::has_mmc1() const {
+  return _internal_has_mmc1();
+}
+inline void MmcState::clear_mmc1() {
+  if (_impl_.mmc1_ != nullptr) _impl_.mmc1_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Rnes::MmcState_Mmc1State& MmcState::_internal_mmc1() const {
+  const ::Rnes::MmcState_Mmc1State* p = _impl_.mmc1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::MmcState_Mmc1State&>(
+      ::Rnes::_MmcState_Mmc1State_default_instance_);
+}
+inline const ::Rnes::MmcState_Mmc1State& MmcState::mmc1() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.mmc1)
+  return _internal_mmc1();
+}
+inline void MmcState::unsafe_arena_set_allocated_mmc1(
+    ::Rnes::MmcState_Mmc1State* mmc1) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mmc1_);
+  }
+  _impl_.mmc1_ = mmc1;
+  if (mmc1) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.MmcState.mmc1)
+}
+inline ::Rnes::MmcState_Mmc1State* MmcState::release_mmc1() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Rnes::MmcState_Mmc1State* temp = _impl_.mmc1_;
+  _impl_.mmc1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::MmcState_Mmc1State* MmcState::unsafe_arena_release_mmc1() {
+  // @@protoc_insertion_point(field_release:Rnes.MmcState.mmc1)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Rnes::MmcState_Mmc1State* temp = _impl_.mmc1_;
+  _impl_.mmc1_ = nullptr;
+  return temp;
+}
+inline ::Rnes::MmcState_Mmc1State* MmcState::_internal_mutable_mmc1() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.mmc1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::MmcState_Mmc1State>(GetArenaForAllocation());
+    _impl_.mmc1_ = p;
+  }
+  return _impl_.mmc1_;
+}
+inline ::Rnes::MmcState_Mmc1State* MmcState::mutable_mmc1() {
+  ::Rnes::MmcState_Mmc1State* _msg = _internal_mutable_mmc1();
+  // @@protoc_insertion_point(field_mutable:Rnes.MmcState.mmc1)
+  return _msg;
+}
+inline void MmcState::set_allocated_mmc1(::Rnes::MmcState_Mmc1State* mmc1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mmc1_;
+  }
+  if (mmc1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mmc1);
+    if (message_arena != submessage_arena) {
+      mmc1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mmc1, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.mmc1_ = mmc1;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.MmcState.mmc1)
+}
+
+// optional .Rnes.MmcState.Mmc3State mmc3 = 3;
+inline bool MmcState::_internal_has_mmc3() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mmc3_ != nullptr);
+  return value;
+}
+inline bool MmcState::has_mmc3() const {
+  return _internal_has_mmc3();
+}
+inline void MmcState::clear_mmc3() {
+  if (_impl_.mmc3_ != nullptr) _impl_.mmc3_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Rnes::MmcState_Mmc3State& MmcState::_internal_mmc3() const {
+  const ::Rnes::MmcState_Mmc3State* p = _impl_.mmc3_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::MmcState_Mmc3State&>(
+      ::Rnes::_MmcState_Mmc3State_default_instance_);
+}
+inline const ::Rnes::MmcState_Mmc3State& MmcState::mmc3() const {
+  // @@protoc_insertion_point(field_get:Rnes.MmcState.mmc3)
+  return _internal_mmc3();
+}
+inline void MmcState::unsafe_arena_set_allocated_mmc3(
+    ::Rnes::MmcState_Mmc3State* mmc3) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mmc3_);
+  }
+  _impl_.mmc3_ = mmc3;
+  if (mmc3) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.MmcState.mmc3)
+}
+inline ::Rnes::MmcState_Mmc3State* MmcState::release_mmc3() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Rnes::MmcState_Mmc3State* temp = _impl_.mmc3_;
+  _impl_.mmc3_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::MmcState_Mmc3State* MmcState::unsafe_arena_release_mmc3() {
+  // @@protoc_insertion_point(field_release:Rnes.MmcState.mmc3)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Rnes::MmcState_Mmc3State* temp = _impl_.mmc3_;
+  _impl_.mmc3_ = nullptr;
+  return temp;
+}
+inline ::Rnes::MmcState_Mmc3State* MmcState::_internal_mutable_mmc3() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.mmc3_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::MmcState_Mmc3State>(GetArenaForAllocation());
+    _impl_.mmc3_ = p;
+  }
+  return _impl_.mmc3_;
+}
+inline ::Rnes::MmcState_Mmc3State* MmcState::mutable_mmc3() {
+  ::Rnes::MmcState_Mmc3State* _msg = _internal_mutable_mmc3();
+  // @@protoc_insertion_point(field_mutable:Rnes.MmcState.mmc3)
+  return _msg;
+}
+inline void MmcState::set_allocated_mmc3(::Rnes::MmcState_Mmc3State* mmc3) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mmc3_;
+  }
+  if (mmc3) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mmc3);
+    if (message_arena != submessage_arena) {
+      mmc3 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mmc3, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.mmc3_ = mmc3;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.MmcState.mmc3)
+}
+
+// -------------------------------------------------------------------
+
+// ControllerState
+
+// optional uint32 control = 1;
+inline bool ControllerState::_internal_has_control() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ControllerState::has_control() const {
+  return _internal_has_control();
+}
+inline void ControllerState::clear_control() {
+  _impl_.control_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t ControllerState::_internal_control() const {
+  return _impl_.control_;
+}
+inline uint32_t ControllerState::control() const {
+  // @@protoc_insertion_point(field_get:Rnes.ControllerState.control)
+  return _internal_control();
+}
+inline void ControllerState::_internal_set_control(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.control_ = value;
+}
+inline void ControllerState::set_control(uint32_t value) {
+  _internal_set_control(value);
+  // @@protoc_insertion_point(field_set:Rnes.ControllerState.control)
+}
+
+// optional uint32 shiftReg = 2;
+inline bool ControllerState::_internal_has_shiftreg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ControllerState::has_shiftreg() const {
+  return _internal_has_shiftreg();
+}
+inline void ControllerState::clear_shiftreg() {
+  _impl_.shiftreg_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ControllerState::_internal_shiftreg() const {
+  return _impl_.shiftreg_;
+}
+inline uint32_t ControllerState::shiftreg() const {
+  // @@protoc_insertion_point(field_get:Rnes.ControllerState.shiftReg)
+  return _internal_shiftreg();
+}
+inline void ControllerState::_internal_set_shiftreg(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shiftreg_ = value;
+}
+inline void ControllerState::set_shiftreg(uint32_t value) {
+  _internal_set_shiftreg(value);
+  // @@protoc_insertion_point(field_set:Rnes.ControllerState.shiftReg)
+}
+
+// -------------------------------------------------------------------
+
+// CpuMemoryState
+
+// optional bytes cpuSram = 1;
+inline bool CpuMemoryState::_internal_has_cpusram() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CpuMemoryState::has_cpusram() const {
+  return _internal_has_cpusram();
+}
+inline void CpuMemoryState::clear_cpusram() {
+  _impl_.cpusram_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CpuMemoryState::cpusram() const {
+  // @@protoc_insertion_point(field_get:Rnes.CpuMemoryState.cpuSram)
+  return _internal_cpusram();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CpuMemoryState::set_cpusram(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.cpusram_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.CpuMemoryState.cpuSram)
+}
+inline std::string* CpuMemoryState::mutable_cpusram() {
+  std::string* _s = _internal_mutable_cpusram();
+  // @@protoc_insertion_point(field_mutable:Rnes.CpuMemoryState.cpuSram)
+  return _s;
+}
+inline const std::string& CpuMemoryState::_internal_cpusram() const {
+  return _impl_.cpusram_.Get();
+}
+inline void CpuMemoryState::_internal_set_cpusram(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cpusram_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CpuMemoryState::_internal_mutable_cpusram() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.cpusram_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CpuMemoryState::release_cpusram() {
+  // @@protoc_insertion_point(field_release:Rnes.CpuMemoryState.cpuSram)
+  if (!_internal_has_cpusram()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.cpusram_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cpusram_.IsDefault()) {
+    _impl_.cpusram_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CpuMemoryState::set_allocated_cpusram(std::string* cpusram) {
+  if (cpusram != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.cpusram_.SetAllocated(cpusram, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cpusram_.IsDefault()) {
+    _impl_.cpusram_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.CpuMemoryState.cpuSram)
+}
+
+// optional bytes prgSram = 2;
+inline bool CpuMemoryState::_internal_has_prgsram() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CpuMemoryState::has_prgsram() const {
+  return _internal_has_prgsram();
+}
+inline void CpuMemoryState::clear_prgsram() {
+  _impl_.prgsram_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CpuMemoryState::prgsram() const {
+  // @@protoc_insertion_point(field_get:Rnes.CpuMemoryState.prgSram)
+  return _internal_prgsram();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CpuMemoryState::set_prgsram(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.prgsram_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.CpuMemoryState.prgSram)
+}
+inline std::string* CpuMemoryState::mutable_prgsram() {
+  std::string* _s = _internal_mutable_prgsram();
+  // @@protoc_insertion_point(field_mutable:Rnes.CpuMemoryState.prgSram)
+  return _s;
+}
+inline const std::string& CpuMemoryState::_internal_prgsram() const {
+  return _impl_.prgsram_.Get();
+}
+inline void CpuMemoryState::_internal_set_prgsram(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.prgsram_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CpuMemoryState::_internal_mutable_prgsram() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.prgsram_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CpuMemoryState::release_prgsram() {
+  // @@protoc_insertion_point(field_release:Rnes.CpuMemoryState.prgSram)
+  if (!_internal_has_prgsram()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.prgsram_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prgsram_.IsDefault()) {
+    _impl_.prgsram_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CpuMemoryState::set_allocated_prgsram(std::string* prgsram) {
+  if (prgsram != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.prgsram_.SetAllocated(prgsram, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prgsram_.IsDefault()) {
+    _impl_.prgsram_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.CpuMemoryState.prgSram)
+}
+
+// -------------------------------------------------------------------
+
+// VideoMemoryState
+
+// optional bytes patternTableMemory = 1;
+inline bool VideoMemoryState::_internal_has_patterntablememory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool VideoMemoryState::has_patterntablememory() const {
+  return _internal_has_patterntablememory();
+}
+inline void VideoMemoryState::clear_patterntablememory() {
+  _impl_.patterntablememory_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& VideoMemoryState::patterntablememory() const {
+  // @@protoc_insertion_point(field_get:Rnes.VideoMemoryState.patternTableMemory)
+  return _internal_patterntablememory();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VideoMemoryState::set_patterntablememory(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.patterntablememory_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.VideoMemoryState.patternTableMemory)
+}
+inline std::string* VideoMemoryState::mutable_patterntablememory() {
+  std::string* _s = _internal_mutable_patterntablememory();
+  // @@protoc_insertion_point(field_mutable:Rnes.VideoMemoryState.patternTableMemory)
+  return _s;
+}
+inline const std::string& VideoMemoryState::_internal_patterntablememory() const {
+  return _impl_.patterntablememory_.Get();
+}
+inline void VideoMemoryState::_internal_set_patterntablememory(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.patterntablememory_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VideoMemoryState::_internal_mutable_patterntablememory() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.patterntablememory_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VideoMemoryState::release_patterntablememory() {
+  // @@protoc_insertion_point(field_release:Rnes.VideoMemoryState.patternTableMemory)
+  if (!_internal_has_patterntablememory()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.patterntablememory_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.patterntablememory_.IsDefault()) {
+    _impl_.patterntablememory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void VideoMemoryState::set_allocated_patterntablememory(std::string* patterntablememory) {
+  if (patterntablememory != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.patterntablememory_.SetAllocated(patterntablememory, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.patterntablememory_.IsDefault()) {
+    _impl_.patterntablememory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.VideoMemoryState.patternTableMemory)
+}
+
+// optional bytes nameTableMemory = 2;
+inline bool VideoMemoryState::_internal_has_nametablememory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool VideoMemoryState::has_nametablememory() const {
+  return _internal_has_nametablememory();
+}
+inline void VideoMemoryState::clear_nametablememory() {
+  _impl_.nametablememory_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& VideoMemoryState::nametablememory() const {
+  // @@protoc_insertion_point(field_get:Rnes.VideoMemoryState.nameTableMemory)
+  return _internal_nametablememory();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VideoMemoryState::set_nametablememory(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.nametablememory_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.VideoMemoryState.nameTableMemory)
+}
+inline std::string* VideoMemoryState::mutable_nametablememory() {
+  std::string* _s = _internal_mutable_nametablememory();
+  // @@protoc_insertion_point(field_mutable:Rnes.VideoMemoryState.nameTableMemory)
+  return _s;
+}
+inline const std::string& VideoMemoryState::_internal_nametablememory() const {
+  return _impl_.nametablememory_.Get();
+}
+inline void VideoMemoryState::_internal_set_nametablememory(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.nametablememory_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VideoMemoryState::_internal_mutable_nametablememory() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.nametablememory_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VideoMemoryState::release_nametablememory() {
+  // @@protoc_insertion_point(field_release:Rnes.VideoMemoryState.nameTableMemory)
+  if (!_internal_has_nametablememory()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.nametablememory_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nametablememory_.IsDefault()) {
+    _impl_.nametablememory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void VideoMemoryState::set_allocated_nametablememory(std::string* nametablememory) {
+  if (nametablememory != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.nametablememory_.SetAllocated(nametablememory, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nametablememory_.IsDefault()) {
+    _impl_.nametablememory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.VideoMemoryState.nameTableMemory)
+}
+
+// optional bytes paletteMemory = 3;
+inline bool VideoMemoryState::_internal_has_palettememory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool VideoMemoryState::has_palettememory() const {
+  return _internal_has_palettememory();
+}
+inline void VideoMemoryState::clear_palettememory() {
+  _impl_.palettememory_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& VideoMemoryState::palettememory() const {
+  // @@protoc_insertion_point(field_get:Rnes.VideoMemoryState.paletteMemory)
+  return _internal_palettememory();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VideoMemoryState::set_palettememory(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.palettememory_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.VideoMemoryState.paletteMemory)
+}
+inline std::string* VideoMemoryState::mutable_palettememory() {
+  std::string* _s = _internal_mutable_palettememory();
+  // @@protoc_insertion_point(field_mutable:Rnes.VideoMemoryState.paletteMemory)
+  return _s;
+}
+inline const std::string& VideoMemoryState::_internal_palettememory() const {
+  return _impl_.palettememory_.Get();
+}
+inline void VideoMemoryState::_internal_set_palettememory(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.palettememory_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VideoMemoryState::_internal_mutable_palettememory() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.palettememory_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VideoMemoryState::release_palettememory() {
+  // @@protoc_insertion_point(field_release:Rnes.VideoMemoryState.paletteMemory)
+  if (!_internal_has_palettememory()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.palettememory_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.palettememory_.IsDefault()) {
+    _impl_.palettememory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void VideoMemoryState::set_allocated_palettememory(std::string* palettememory) {
+  if (palettememory != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.palettememory_.SetAllocated(palettememory, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.palettememory_.IsDefault()) {
+    _impl_.palettememory_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.VideoMemoryState.paletteMemory)
+}
+
+// -------------------------------------------------------------------
+
+// DmaState
+
+// optional bool spriteDmaMode = 1;
+inline bool DmaState::_internal_has_spritedmamode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool DmaState::has_spritedmamode() const {
+  return _internal_has_spritedmamode();
+}
+inline void DmaState::clear_spritedmamode() {
+  _impl_.spritedmamode_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool DmaState::_internal_spritedmamode() const {
+  return _impl_.spritedmamode_;
+}
+inline bool DmaState::spritedmamode() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmaState.spriteDmaMode)
+  return _internal_spritedmamode();
+}
+inline void DmaState::_internal_set_spritedmamode(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.spritedmamode_ = value;
+}
+inline void DmaState::set_spritedmamode(bool value) {
+  _internal_set_spritedmamode(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmaState.spriteDmaMode)
+}
+
+// optional uint32 spriteDmaCycle = 2;
+inline bool DmaState::_internal_has_spritedmacycle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool DmaState::has_spritedmacycle() const {
+  return _internal_has_spritedmacycle();
+}
+inline void DmaState::clear_spritedmacycle() {
+  _impl_.spritedmacycle_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t DmaState::_internal_spritedmacycle() const {
+  return _impl_.spritedmacycle_;
+}
+inline uint32_t DmaState::spritedmacycle() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmaState.spriteDmaCycle)
+  return _internal_spritedmacycle();
+}
+inline void DmaState::_internal_set_spritedmacycle(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.spritedmacycle_ = value;
+}
+inline void DmaState::set_spritedmacycle(uint32_t value) {
+  _internal_set_spritedmacycle(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmaState.spriteDmaCycle)
+}
+
+// optional uint32 spriteDmaSourceAddr = 3;
+inline bool DmaState::_internal_has_spritedmasourceaddr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool DmaState::has_spritedmasourceaddr() const {
+  return _internal_has_spritedmasourceaddr();
+}
+inline void DmaState::clear_spritedmasourceaddr() {
+  _impl_.spritedmasourceaddr_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t DmaState::_internal_spritedmasourceaddr() const {
+  return _impl_.spritedmasourceaddr_;
+}
+inline uint32_t DmaState::spritedmasourceaddr() const {
+  // @@protoc_insertion_point(field_get:Rnes.DmaState.spriteDmaSourceAddr)
+  return _internal_spritedmasourceaddr();
+}
+inline void DmaState::_internal_set_spritedmasourceaddr(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.spritedmasourceaddr_ = value;
+}
+inline void DmaState::set_spritedmasourceaddr(uint32_t value) {
+  _internal_set_spritedmasourceaddr(value);
+  // @@protoc_insertion_point(field_set:Rnes.DmaState.spriteDmaSourceAddr)
+}
+
+// -------------------------------------------------------------------
+
+// SaveState
+
+// optional string saveDate = 1;
+inline bool SaveState::_internal_has_savedate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SaveState::has_savedate() const {
+  return _internal_has_savedate();
+}
+inline void SaveState::clear_savedate() {
+  _impl_.savedate_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SaveState::savedate() const {
+  // @@protoc_insertion_point(field_get:Rnes.SaveState.saveDate)
+  return _internal_savedate();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SaveState::set_savedate(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.savedate_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Rnes.SaveState.saveDate)
+}
+inline std::string* SaveState::mutable_savedate() {
+  std::string* _s = _internal_mutable_savedate();
+  // @@protoc_insertion_point(field_mutable:Rnes.SaveState.saveDate)
+  return _s;
+}
+inline const std::string& SaveState::_internal_savedate() const {
+  return _impl_.savedate_.Get();
+}
+inline void SaveState::_internal_set_savedate(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.savedate_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SaveState::_internal_mutable_savedate() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.savedate_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SaveState::release_savedate() {
+  // @@protoc_insertion_point(field_release:Rnes.SaveState.saveDate)
+  if (!_internal_has_savedate()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.savedate_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.savedate_.IsDefault()) {
+    _impl_.savedate_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SaveState::set_allocated_savedate(std::string* savedate) {
+  if (savedate != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.savedate_.SetAllocated(savedate, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.savedate_.IsDefault()) {
+    _impl_.savedate_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Rnes.SaveState.saveDate)
+}
+
+// optional uint64 gameTime = 2;
+inline bool SaveState::_internal_has_gametime() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SaveState::has_gametime() const {
+  return _internal_has_gametime();
+}
+inline void SaveState::clear_gametime() {
+  _impl_.gametime_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t SaveState::_internal_gametime() const {
+  return _impl_.gametime_;
+}
+inline uint64_t SaveState::gametime() const {
+  // @@protoc_insertion_point(field_get:Rnes.SaveState.gameTime)
+  return _internal_gametime();
+}
+inline void SaveState::_internal_set_gametime(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.gametime_ = value;
+}
+inline void SaveState::set_gametime(uint64_t value) {
+  _internal_set_gametime(value);
+  // @@protoc_insertion_point(field_set:Rnes.SaveState.gameTime)
+}
+
+// optional .Rnes.DmaState dma = 7;
+inline bool SaveState::_internal_has_dma() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dma_ != nullptr);
+  return value;
+}
+inline bool SaveState::has_dma() const {
+  return _internal_has_dma();
+}
+inline void SaveState::clear_dma() {
+  if (_impl_.dma_ != nullptr) _impl_.dma_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Rnes::DmaState& SaveState::_internal_dma() const {
+  const ::Rnes::DmaState* p = _impl_.dma_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::DmaState&>(
+      ::Rnes::_DmaState_default_instance_);
+}
+inline const ::Rnes::DmaState& SaveState::dma() const {
+  // @@protoc_insertion_point(field_get:Rnes.SaveState.dma)
+  return _internal_dma();
+}
+inline void SaveState::unsafe_arena_set_allocated_dma(
+    ::Rnes::DmaState* dma) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dma_);
+  }
+  _impl_.dma_ = dma;
+  if (dma) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.SaveState.dma)
+}
+inline ::Rnes::DmaState* SaveState::release_dma() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Rnes::DmaState* temp = _impl_.dma_;
+  _impl_.dma_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::DmaState* SaveState::unsafe_arena_release_dma() {
+  // @@protoc_insertion_point(field_release:Rnes.SaveState.dma)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Rnes::DmaState* temp = _impl_.dma_;
+  _impl_.dma_ = nullptr;
+  return temp;
+}
+inline ::Rnes::DmaState* SaveState::_internal_mutable_dma() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.dma_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::DmaState>(GetArenaForAllocation());
+    _impl_.dma_ = p;
+  }
+  return _impl_.dma_;
+}
+inline ::Rnes::DmaState* SaveState::mutable_dma() {
+  ::Rnes::DmaState* _msg = _internal_mutable_dma();
+  // @@protoc_insertion_point(field_mutable:Rnes.SaveState.dma)
+  return _msg;
+}
+inline void SaveState::set_allocated_dma(::Rnes::DmaState* dma) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dma_;
+  }
+  if (dma) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dma);
+    if (message_arena != submessage_arena) {
+      dma = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dma, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.dma_ = dma;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.SaveState.dma)
+}
+
+// optional .Rnes.CpuState cpu = 8;
+inline bool SaveState::_internal_has_cpu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.cpu_ != nullptr);
+  return value;
+}
+inline bool SaveState::has_cpu() const {
+  return _internal_has_cpu();
+}
+inline void SaveState::clear_cpu() {
+  if (_impl_.cpu_ != nullptr) _impl_.cpu_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Rnes::CpuState& SaveState::_internal_cpu() const {
+  const ::Rnes::CpuState* p = _impl_.cpu_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::CpuState&>(
+      ::Rnes::_CpuState_default_instance_);
+}
+inline const ::Rnes::CpuState& SaveState::cpu() const {
+  // @@protoc_insertion_point(field_get:Rnes.SaveState.cpu)
+  return _internal_cpu();
+}
+inline void SaveState::unsafe_arena_set_allocated_cpu(
+    ::Rnes::CpuState* cpu) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cpu_);
+  }
+  _impl_.cpu_ = cpu;
+  if (cpu) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.SaveState.cpu)
+}
+inline ::Rnes::CpuState* SaveState::release_cpu() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Rnes::CpuState* temp = _impl_.cpu_;
+  _impl_.cpu_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::CpuState* SaveState::unsafe_arena_release_cpu() {
+  // @@protoc_insertion_point(field_release:Rnes.SaveState.cpu)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Rnes::CpuState* temp = _impl_.cpu_;
+  _impl_.cpu_ = nullptr;
+  return temp;
+}
+inline ::Rnes::CpuState* SaveState::_internal_mutable_cpu() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.cpu_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::CpuState>(GetArenaForAllocation());
+    _impl_.cpu_ = p;
+  }
+  return _impl_.cpu_;
+}
+inline ::Rnes::CpuState* SaveState::mutable_cpu() {
+  ::Rnes::CpuState* _msg = _internal_mutable_cpu();
+  // @@protoc_insertion_point(field_mutable:Rnes.SaveState.cpu)
+  return _msg;
+}
+inline void SaveState::set_allocated_cpu(::Rnes::CpuState* cpu) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cpu_;
+  }
+  if (cpu) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cpu);
+    if (message_arena != submessage_arena) {
+      cpu = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cpu, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.cpu_ = cpu;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.SaveState.cpu)
+}
+
+// optional .Rnes.ApuState apu = 9;
+inline bool SaveState::_internal_has_apu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.apu_ != nullptr);
+  return value;
+}
+inline bool SaveState::has_apu() const {
+  return _internal_has_apu();
+}
+inline void SaveState::clear_apu() {
+  if (_impl_.apu_ != nullptr) _impl_.apu_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::Rnes::ApuState& SaveState::_internal_apu() const {
+  const ::Rnes::ApuState* p = _impl_.apu_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::ApuState&>(
+      ::Rnes::_ApuState_default_instance_);
+}
+inline const ::Rnes::ApuState& SaveState::apu() const {
+  // @@protoc_insertion_point(field_get:Rnes.SaveState.apu)
+  return _internal_apu();
+}
+inline void SaveState::unsafe_arena_set_allocated_apu(
+    ::Rnes::ApuState* apu) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.apu_);
+  }
+  _impl_.apu_ = apu;
+  if (apu) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.SaveState.apu)
+}
+inline ::Rnes::ApuState* SaveState::release_apu() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Rnes::ApuState* temp = _impl_.apu_;
+  _impl_.apu_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::ApuState* SaveState::unsafe_arena_release_apu() {
+  // @@protoc_insertion_point(field_release:Rnes.SaveState.apu)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Rnes::ApuState* temp = _impl_.apu_;
+  _impl_.apu_ = nullptr;
+  return temp;
+}
+inline ::Rnes::ApuState* SaveState::_internal_mutable_apu() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.apu_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::ApuState>(GetArenaForAllocation());
+    _impl_.apu_ = p;
+  }
+  return _impl_.apu_;
+}
+inline ::Rnes::ApuState* SaveState::mutable_apu() {
+  ::Rnes::ApuState* _msg = _internal_mutable_apu();
+  // @@protoc_insertion_point(field_mutable:Rnes.SaveState.apu)
+  return _msg;
+}
+inline void SaveState::set_allocated_apu(::Rnes::ApuState* apu) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.apu_;
+  }
+  if (apu) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(apu);
+    if (message_arena != submessage_arena) {
+      apu = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, apu, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.apu_ = apu;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.SaveState.apu)
+}
+
+// optional .Rnes.PpuState ppu = 10;
+inline bool SaveState::_internal_has_ppu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.ppu_ != nullptr);
+  return value;
+}
+inline bool SaveState::has_ppu() const {
+  return _internal_has_ppu();
+}
+inline void SaveState::clear_ppu() {
+  if (_impl_.ppu_ != nullptr) _impl_.ppu_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::Rnes::PpuState& SaveState::_internal_ppu() const {
+  const ::Rnes::PpuState* p = _impl_.ppu_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::PpuState&>(
+      ::Rnes::_PpuState_default_instance_);
+}
+inline const ::Rnes::PpuState& SaveState::ppu() const {
+  // @@protoc_insertion_point(field_get:Rnes.SaveState.ppu)
+  return _internal_ppu();
+}
+inline void SaveState::unsafe_arena_set_allocated_ppu(
+    ::Rnes::PpuState* ppu) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ppu_);
+  }
+  _impl_.ppu_ = ppu;
+  if (ppu) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.SaveState.ppu)
+}
+inline ::Rnes::PpuState* SaveState::release_ppu() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::Rnes::PpuState* temp = _impl_.ppu_;
+  _impl_.ppu_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::PpuState* SaveState::unsafe_arena_release_ppu() {
+  // @@protoc_insertion_point(field_release:Rnes.SaveState.ppu)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::Rnes::PpuState* temp = _impl_.ppu_;
+  _impl_.ppu_ = nullptr;
+  return temp;
+}
+inline ::Rnes::PpuState* SaveState::_internal_mutable_ppu() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.ppu_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::PpuState>(GetArenaForAllocation());
+    _impl_.ppu_ = p;
+  }
+  return _impl_.ppu_;
+}
+inline ::Rnes::PpuState* SaveState::mutable_ppu() {
+  ::Rnes::PpuState* _msg = _internal_mutable_ppu();
+  // @@protoc_insertion_point(field_mutable:Rnes.SaveState.ppu)
+  return _msg;
+}
+inline void SaveState::set_allocated_ppu(::Rnes::PpuState* ppu) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ppu_;
+  }
+  if (ppu) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ppu);
+    if (message_arena != submessage_arena) {
+      ppu = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ppu, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.ppu_ = ppu;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.SaveState.ppu)
+}
+
+// optional .Rnes.ControllerState controller = 11;
+inline bool SaveState::_internal_has_controller() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.controller_ != nullptr);
+  return value;
+}
+inline bool SaveState::has_controller() const {
+  return _internal_has_controller();
+}
+inline void SaveState::clear_controller() {
+  if (_impl_.controller_ != nullptr) _impl_.controller_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::Rnes::ControllerState& SaveState::_internal_controller() const {
+  const ::Rnes::ControllerState* p = _impl_.controller_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::ControllerState&>(
+      ::Rnes::_ControllerState_default_instance_);
+}
+inline const ::Rnes::ControllerState& SaveState::controller() const {
+  // @@protoc_insertion_point(field_get:Rnes.SaveState.controller)
+  return _internal_controller();
+}
+inline void SaveState::unsafe_arena_set_allocated_controller(
+    ::Rnes::ControllerState* controller) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.controller_);
+  }
+  _impl_.controller_ = controller;
+  if (controller) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.SaveState.controller)
+}
+inline ::Rnes::ControllerState* SaveState::release_controller() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::Rnes::ControllerState* temp = _impl_.controller_;
+  _impl_.controller_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::ControllerState* SaveState::unsafe_arena_release_controller() {
+  // @@protoc_insertion_point(field_release:Rnes.SaveState.controller)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::Rnes::ControllerState* temp = _impl_.controller_;
+  _impl_.controller_ = nullptr;
+  return temp;
+}
+inline ::Rnes::ControllerState* SaveState::_internal_mutable_controller() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.controller_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::ControllerState>(GetArenaForAllocation());
+    _impl_.controller_ = p;
+  }
+  return _impl_.controller_;
+}
+inline ::Rnes::ControllerState* SaveState::mutable_controller() {
+  ::Rnes::ControllerState* _msg = _internal_mutable_controller();
+  // @@protoc_insertion_point(field_mutable:Rnes.SaveState.controller)
+  return _msg;
+}
+inline void SaveState::set_allocated_controller(::Rnes::ControllerState* controller) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.controller_;
+  }
+  if (controller) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(controller);
+    if (message_arena != submessage_arena) {
+      controller = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, controller, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.controller_ = controller;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.SaveState.controller)
+}
+
+// optional .Rnes.CpuMemoryState cpuMem = 12;
+inline bool SaveState::_internal_has_cpumem() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.cpumem_ != nullptr);
+  return value;
+}
+inline bool SaveState::has_cpumem() const {
+  return _internal_has_cpumem();
+}
+inline void SaveState::clear_cpumem() {
+  if (_impl_.cpumem_ != nullptr) _impl_.cpumem_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::Rnes::CpuMemoryState& SaveState::_internal_cpumem() const {
+  const ::Rnes::CpuMemoryState* p = _impl_.cpumem_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::CpuMemoryState&>(
+      ::Rnes::_CpuMemoryState_default_instance_);
+}
+inline const ::Rnes::CpuMemoryState& SaveState::cpumem() const {
+  // @@protoc_insertion_point(field_get:Rnes.SaveState.cpuMem)
+  return _internal_cpumem();
+}
+inline void SaveState::unsafe_arena_set_allocated_cpumem(
+    ::Rnes::CpuMemoryState* cpumem) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cpumem_);
+  }
+  _impl_.cpumem_ = cpumem;
+  if (cpumem) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.SaveState.cpuMem)
+}
+inline ::Rnes::CpuMemoryState* SaveState::release_cpumem() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::Rnes::CpuMemoryState* temp = _impl_.cpumem_;
+  _impl_.cpumem_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::CpuMemoryState* SaveState::unsafe_arena_release_cpumem() {
+  // @@protoc_insertion_point(field_release:Rnes.SaveState.cpuMem)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::Rnes::CpuMemoryState* temp = _impl_.cpumem_;
+  _impl_.cpumem_ = nullptr;
+  return temp;
+}
+inline ::Rnes::CpuMemoryState* SaveState::_internal_mutable_cpumem() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.cpumem_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::CpuMemoryState>(GetArenaForAllocation());
+    _impl_.cpumem_ = p;
+  }
+  return _impl_.cpumem_;
+}
+inline ::Rnes::CpuMemoryState* SaveState::mutable_cpumem() {
+  ::Rnes::CpuMemoryState* _msg = _internal_mutable_cpumem();
+  // @@protoc_insertion_point(field_mutable:Rnes.SaveState.cpuMem)
+  return _msg;
+}
+inline void SaveState::set_allocated_cpumem(::Rnes::CpuMemoryState* cpumem) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cpumem_;
+  }
+  if (cpumem) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cpumem);
+    if (message_arena != submessage_arena) {
+      cpumem = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cpumem, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.cpumem_ = cpumem;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.SaveState.cpuMem)
+}
+
+// optional .Rnes.VideoMemoryState vidMem = 13;
+inline bool SaveState::_internal_has_vidmem() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.vidmem_ != nullptr);
+  return value;
+}
+inline bool SaveState::has_vidmem() const {
+  return _internal_has_vidmem();
+}
+inline void SaveState::clear_vidmem() {
+  if (_impl_.vidmem_ != nullptr) _impl_.vidmem_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::Rnes::VideoMemoryState& SaveState::_internal_vidmem() const {
+  const ::Rnes::VideoMemoryState* p = _impl_.vidmem_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Rnes::VideoMemoryState&>(
+      ::Rnes::_VideoMemoryState_default_instance_);
+}
+inline const ::Rnes::VideoMemoryState& SaveState::vidmem() const {
+  // @@protoc_insertion_point(field_get:Rnes.SaveState.vidMem)
+  return _internal_vidmem();
+}
+inline void SaveState::unsafe_arena_set_allocated_vidmem(
+    ::Rnes::VideoMemoryState* vidmem) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.vidmem_);
+  }
+  _impl_.vidmem_ = vidmem;
+  if (vidmem) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Rnes.SaveState.vidMem)
+}
+inline ::Rnes::VideoMemoryState* SaveState::release_vidmem() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::Rnes::VideoMemoryState* temp = _impl_.vidmem_;
+  _impl_.vidmem_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Rnes::VideoMemoryState* SaveState::unsafe_arena_release_vidmem() {
+  // @@protoc_insertion_point(field_release:Rnes.SaveState.vidMem)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::Rnes::VideoMemoryState* temp = _impl_.vidmem_;
+  _impl_.vidmem_ = nullptr;
+  return temp;
+}
+inline ::Rnes::VideoMemoryState* SaveState::_internal_mutable_vidmem() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.vidmem_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Rnes::VideoMemoryState>(GetArenaForAllocation());
+    _impl_.vidmem_ = p;
+  }
+  return _impl_.vidmem_;
+}
+inline ::Rnes::VideoMemoryState* SaveState::mutable_vidmem() {
+  ::Rnes::VideoMemoryState* _msg = _internal_mutable_vidmem();
+  // @@protoc_insertion_point(field_mutable:Rnes.SaveState.vidMem)
+  return _msg;
+}
+inline void SaveState::set_allocated_vidmem(::Rnes::VideoMemoryState* vidmem) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.vidmem_;
+  }
+  if (vidmem) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(vidmem);
+    if (message_arena != submessage_arena) {
+      vidmem = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vidmem, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.vidmem_ = vidmem;
+  // @@protoc_insertion_point(field_set_allocated:Rnes.SaveState.vidMem)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace Rnes
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_save_2eproto
@@ -0,0 +1,159 @@
+//
+//  blipbuffer.cpp
+//  rnes
+//
+//
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "blipbuffer.h"
+
+namespace Rnes {
+
+// Windowed sinc impulses, one per sub-sample phase. Phase p puts the center of the impulse p /
+// phaseCount of a sample after tap kernelWidth / 2 - 1. The cutoff sits a little below nyquist so
+// the transition band of the short kernel stays mostly below it.
+struct BlipKernel {
+  static constexpr double cutoff = 0.45;
+
+  static const int32_t width = BlipBuffer::kernelWidth;
+  static const int32_t phases = BlipBuffer::phaseCount;
+  static const int32_t unity = 1 << BlipBuffer::deltaBits;
+
+  int16_t taps[phases][width];
+
+  BlipKernel() {
+    const double halfWidth = width / 2;
+    for (int32_t p = 0; p < phases; p++) {
+      double impulse[width];
+      double sum = 0.0;
+      for (int32_t i = 0; i < width; i++) {
+        double d = i - (halfWidth - 1) - double(p) / phases;
+        double x = M_PI * 2 * cutoff * d;
+        double sinc = x == 0.0 ? 1.0 : std::sin(x) / x;
+        double window = 0.42 + 0.5 * std::cos(M_PI * d / halfWidth) +
+                        0.08 * std::cos(2 * M_PI * d / halfWidth);
+        impulse[i] = sinc * window;
+        sum += impulse[i];
+      }
+
+      // Normalize to exactly unit gain, whatever rounding leaves goes to the center tap, so
+      // integrating a step never drifts.
+      int32_t total = 0;
+      for (int32_t i = 0; i < width; i++) {
+        taps[p][i] = (int16_t)std::lround(impulse[i] / sum * unity);
+        total += taps[p][i];
+      }
+      taps[p][width / 2 - 1] += unity - total;
+    }
+  }
+};
+
+static const BlipKernel blipKernel;
+
+void BlipBuffer::addDelta(uint32_t clock, int32_t delta) {
+  uint64_t time = frameOffset + clock * unitsPerClock;
+  uint32_t sample = uint32_t(time / sampleUnits);
+  uint32_t phase = uint32_t(time % sampleUnits * phaseCount / sampleUnits);
+  assert(sample + kernelWidth <= deltas.size());
+
+  const int16_t *taps = blipKernel.taps[phase];
+  int32_t *out = &deltas[sample];
+  for (uint32_t i = 0; i < kernelWidth; i++) {
+    out[i] += taps[i] * delta;
+  }
+}
+
+uint32_t BlipBuffer::getSampleAt(uint32_t clock) const {
+  return uint32_t((frameOffset + clock * unitsPerClock + sampleUnits - 1) / sampleUnits);
+}
+
+uint32_t BlipBuffer::getCompleteSamples(uint32_t clock) const {
+  return uint32_t((frameOffset + clock * unitsPerClock) / sampleUnits);
+}
+
+void BlipBuffer::endFrame(uint32_t clocks) {
+  frameOffset += clocks * unitsPerClock;
+  available = uint32_t(frameOffset / sampleUnits);
+  assert(available + kernelWidth <= deltas.size());
+}
+
+void BlipBuffer::skipFrame(uint32_t clocks) {
+  integrator = std::accumulate(deltas.begin(), deltas.end(), integrator);
+  std::fill(deltas.begin(), deltas.end(), 0);
+  frameOffset = (frameOffset + clocks * unitsPerClock) % sampleUnits;
+  available = 0;
+}
+
+uint32_t BlipBuffer::readSamples(int16_t *out, uint32_t count) {
+  count = std::min(count, available);
+  int32_t sum = integrator;
+  uint32_t i = 0;
+#if defined(__SSE2__)
+  // Running sums eight samples at a time. Two shifted adds give the sums within a vector and the
+  // total so far is broadcast on top; packs saturates to int16 just like the scalar clamp.
+  __m128i total = _mm_set1_epi32(sum);
+  for (; i + 8 <= count; i += 8) {
+    __m128i lo = _mm_loadu_si128((const __m128i *)&deltas[i]);
+    __m128i hi = _mm_loadu_si128((const __m128i *)&deltas[i + 4]);
+    lo = _mm_add_epi32(lo, _mm_slli_si128(lo, 4));
+    hi = _mm_add_epi32(hi, _mm_slli_si128(hi, 4));
+    lo = _mm_add_epi32(lo, _mm_slli_si128(lo, 8));
+    hi = _mm_add_epi32(hi, _mm_slli_si128(hi, 8));
+    lo = _mm_add_epi32(lo, total);
+    total = _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 3, 3, 3));
+    hi = _mm_add_epi32(hi, total);
+    total = _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i samples = _mm_packs_epi32(_mm_srai_epi32(lo, deltaBits), _mm_srai_epi32(hi, deltaBits));
+    _mm_storeu_si128((__m128i *)(out + i), samples);
+  }
+  sum = _mm_cvtsi128_si32(total);
+#endif
+  for (; i < count; i++) {
+    sum += deltas[i];
+    int32_t sample = sum >> deltaBits;
+    out[i] = (int16_t)std::min(std::max(sample, -32768), 32767);
+  }
+  integrator = sum;
+
+  // Move the tails of steps that reach into later samples to the front.
+  std::copy(deltas.begin() + count, deltas.begin() + available + kernelWidth, deltas.begin());
+  std::fill(deltas.begin() + available + kernelWidth - count,
+            deltas.begin() + available + kernelWidth, 0);
+  available -= count;
+  frameOffset -= count * sampleUnits;
+  return count;
+}
+
+void BlipBuffer::clear() {
+  std::fill(deltas.begin(), deltas.end(), 0);
+  frameOffset = 0;
+  available = 0;
+  integrator = 0;
+}
+
+void BlipBuffer::setSampleRate(double sampleRate) {
+  unitsPerClock = (uint64_t)std::llround(std::ldexp(sampleRate, rateBits));
+
+  // Faster rates need more room for a frame, the buffer never shrinks.
+  uint64_t frameSamples = maxFrameClocks * unitsPerClock / sampleUnits + 1;
+  deltas.resize(std::max<size_t>(deltas.size(), frameSamples + kernelWidth + 1), 0);
+}
+
+void BlipBuffer::setFramePhase(uint64_t phase) {
+  frameOffset = frameOffset - frameOffset % sampleUnits + phase % sampleUnits;
+}
+
+BlipBuffer::BlipBuffer(uint32_t clockRate, uint32_t sampleRate, uint32_t maxFrameClocks)
+    : maxFrameClocks{maxFrameClocks}, sampleUnits{uint64_t(clockRate) << rateBits} {
+  setSampleRate(sampleRate);
+}
+
+}; // namespace Rnes
@@ -0,0 +1,84 @@
+//
+//  blipbuffer.h
+//  rnes
+//
+//
+
+#ifndef __BLIPBUFFER_H__
+#define __BLIPBUFFER_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace Rnes {
+
+// Band-limited synthesis of a signal that only changes in steps. Instead of being sampled every
+// clock, the signal is described by the clocks at which its level changes and by how much. Each
+// change adds a band-limited step to the output, which is resampled to the output rate on the way
+// in. Time is counted in clocks from the start of the current frame; ending a frame makes its
+// samples readable.
+class BlipBuffer {
+  uint32_t maxFrameClocks;
+
+  // Time is kept as an exact rational number of output samples, in units of one clock at a
+  // sample rate of 1 << rateBits Hz. sampleUnits is one output sample in those units and
+  // unitsPerClock is the output rate in 1 << rateBits Hz steps, so the position of a clock is
+  // clock * unitsPerClock / sampleUnits samples without any rounding.
+  uint64_t sampleUnits;
+  uint64_t unitsPerClock;
+  uint64_t frameOffset = 0;
+  uint32_t available = 0;
+  int32_t integrator = 0;
+
+  // Differences of the output, integrated when samples are read.
+  std::vector<int32_t> deltas;
+
+public:
+  // Each step is spread over this many output samples, at one of phaseCount sub-sample offsets.
+  static const uint32_t kernelWidth = 16;
+  static const uint32_t phaseBits = 6;
+  static const uint32_t phaseCount = 1 << phaseBits;
+
+  // Kernel taps of a phase add up to 1 << deltaBits.
+  static const uint32_t deltaBits = 15;
+
+  // Output rates are set in steps of 1 / (1 << rateBits) Hz.
+  static const uint32_t rateBits = 16;
+
+  // maxFrameClocks bounds the length of a frame, samples have to be read before the next frame.
+  BlipBuffer(uint32_t clockRate, uint32_t sampleRate, uint32_t maxFrameClocks);
+  BlipBuffer(const BlipBuffer &) = delete;
+
+  // Changes the output rate from the current frame on, e.g. to steer the fill level of whatever
+  // consumes the samples. The rate is rounded to a 1 / (1 << rateBits) Hz step.
+  void setSampleRate(double sampleRate);
+
+  // Where the current frame starts within its output sample, as a fraction of sampleUnits. Only
+  // meaningful once every complete sample was read; setting it moves the sample grid.
+  uint64_t getFramePhase() const { return frameOffset % sampleUnits; }
+  void setFramePhase(uint64_t phase);
+
+  // The output level changes by delta at clock, relative to the start of the frame.
+  void addDelta(uint32_t clock, int32_t delta);
+
+  // Output sample positions of a clock in the current frame, counted from the oldest unread
+  // sample: the first sample whose instant isn't before clock, and the number of samples that
+  // will be complete if the frame ends at clock.
+  uint32_t getSampleAt(uint32_t clock) const;
+  uint32_t getCompleteSamples(uint32_t clock) const;
+
+  // Ends the frame after clocks clocks, the next frame starts there.
+  void endFrame(uint32_t clocks);
+
+  // Like endFrame, but the frame's samples are dropped along with any still unread. Pending steps
+  // are settled at once, so the level carries on where it would have been.
+  void skipFrame(uint32_t clocks);
+
+  uint32_t samplesAvailable() const { return available; }
+  uint32_t readSamples(int16_t *out, uint32_t count);
+  void clear();
+};
+
+}; // namespace Rnes
+
+#endif
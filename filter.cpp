@@ -0,0 +1,408 @@
+//
+//  filter.cpp
+//  rnes
+//
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "filter.h"
+#include "framebuffer.h"
+
+namespace Rnes {
+
+// Darkens a pixel to 3/4 brightness, for the gaps between crt scanlines.
+static uint32_t darken(uint32_t argb) {
+  return 0xff000000 | (((argb >> 1) & 0x7f7f7f) + ((argb >> 2) & 0x3f3f3f));
+}
+
+// Pixel repetition by an integer factor.
+class NearestFilter : public VideoFilter {
+  uint32_t scale;
+
+  static void widen(const uint32_t *in, uint32_t *out, uint32_t scale);
+
+public:
+  uint32_t getWidth() const { return FrameBuffer::width * scale; }
+  uint32_t getHeight() const { return FrameBuffer::height * scale; }
+  void processBand(const FrameBuffer &frame, uint32_t firstLine, uint32_t lastLine, uint8_t *out,
+                   uint32_t pitch) const;
+
+  explicit NearestFilter(uint32_t factor) : scale{factor} {}
+};
+
+void NearestFilter::widen(const uint32_t *in, uint32_t *out, uint32_t scale) {
+#if defined(__SSE2__)
+  if (scale == 2) {
+    for (uint32_t x = 0; x < FrameBuffer::width; x += 4) {
+      __m128i pixels = _mm_loadu_si128((const __m128i *)&in[x]);
+      _mm_storeu_si128((__m128i *)&out[x * 2], _mm_unpacklo_epi32(pixels, pixels));
+      _mm_storeu_si128((__m128i *)&out[x * 2 + 4], _mm_unpackhi_epi32(pixels, pixels));
+    }
+    return;
+  }
+  if (scale == 4) {
+    for (uint32_t x = 0; x < FrameBuffer::width; x += 4) {
+      __m128i pixels = _mm_loadu_si128((const __m128i *)&in[x]);
+      _mm_storeu_si128((__m128i *)&out[x * 4], _mm_shuffle_epi32(pixels, 0x00));
+      _mm_storeu_si128((__m128i *)&out[x * 4 + 4], _mm_shuffle_epi32(pixels, 0x55));
+      _mm_storeu_si128((__m128i *)&out[x * 4 + 8], _mm_shuffle_epi32(pixels, 0xaa));
+      _mm_storeu_si128((__m128i *)&out[x * 4 + 12], _mm_shuffle_epi32(pixels, 0xff));
+    }
+    return;
+  }
+#endif
+  for (uint32_t x = 0; x < FrameBuffer::width; x++) {
+    std::fill(out + x * scale, out + (x + 1) * scale, in[x]);
+  }
+}
+
+void NearestFilter::processBand(const FrameBuffer &frame, uint32_t firstLine, uint32_t lastLine,
+                                uint8_t *out, uint32_t pitch) const {
+  alignas(16) uint32_t line[FrameBuffer::width];
+  for (uint32_t y = firstLine; y < lastLine; y++) {
+    frame.lineToArgb8888(y, line);
+    uint8_t *row = out + y * scale * pitch;
+    widen(line, (uint32_t *)row, scale);
+    for (uint32_t i = 1; i < scale; i++) {
+      memcpy(row + i * pitch, row, getWidth() * sizeof(uint32_t));
+    }
+  }
+}
+
+// The Scale2x (EPX) edge directed 2x scaler. Each pixel becomes a 2x2 block whose corners take a
+// neighbour's color where two neighbours agree on an edge running through that corner.
+class Scale2xFilter : public VideoFilter {
+  // Converted lines carry a pixel of padding on each side, kept 16 byte aligned.
+  static const uint32_t padding = 4;
+  static const uint32_t lineSize = FrameBuffer::width + 2 * padding;
+
+  static void loadLine(const FrameBuffer &frame, int32_t y, uint32_t *line);
+
+public:
+  uint32_t getWidth() const { return FrameBuffer::width * 2; }
+  uint32_t getHeight() const { return FrameBuffer::height * 2; }
+  void processBand(const FrameBuffer &frame, uint32_t firstLine, uint32_t lastLine, uint8_t *out,
+                   uint32_t pitch) const;
+};
+
+void Scale2xFilter::loadLine(const FrameBuffer &frame, int32_t y, uint32_t *line) {
+  y = std::min(std::max(y, 0), (int32_t)FrameBuffer::height - 1);
+  frame.lineToArgb8888(y, line + padding);
+  line[padding - 1] = line[padding];
+  line[padding + FrameBuffer::width] = line[padding + FrameBuffer::width - 1];
+}
+
+void Scale2xFilter::processBand(const FrameBuffer &frame, uint32_t firstLine, uint32_t lastLine,
+                                uint8_t *out, uint32_t pitch) const {
+  alignas(16) uint32_t lines[3][lineSize];
+  uint32_t *above = lines[0];
+  uint32_t *center = lines[1];
+  uint32_t *below = lines[2];
+  loadLine(frame, (int32_t)firstLine - 1, above);
+  loadLine(frame, firstLine, center);
+
+  for (uint32_t y = firstLine; y < lastLine; y++) {
+    loadLine(frame, y + 1, below);
+    const uint32_t *b = above + padding;
+    const uint32_t *e = center + padding;
+    const uint32_t *h = below + padding;
+    const uint32_t *d = center + padding - 1;
+    const uint32_t *f = center + padding + 1;
+    uint32_t *top = (uint32_t *)(out + y * 2 * pitch);
+    uint32_t *bottom = (uint32_t *)(out + (y * 2 + 1) * pitch);
+#if defined(__SSE2__)
+    for (uint32_t x = 0; x < FrameBuffer::width; x += 4) {
+      __m128i vb = _mm_load_si128((const __m128i *)&b[x]);
+      __m128i ve = _mm_load_si128((const __m128i *)&e[x]);
+      __m128i vh = _mm_load_si128((const __m128i *)&h[x]);
+      __m128i vd = _mm_loadu_si128((const __m128i *)&d[x]);
+      __m128i vf = _mm_loadu_si128((const __m128i *)&f[x]);
+      __m128i flat = _mm_or_si128(_mm_cmpeq_epi32(vb, vh), _mm_cmpeq_epi32(vd, vf));
+      __m128i m0 = _mm_andnot_si128(flat, _mm_cmpeq_epi32(vd, vb));
+      __m128i m1 = _mm_andnot_si128(flat, _mm_cmpeq_epi32(vb, vf));
+      __m128i m2 = _mm_andnot_si128(flat, _mm_cmpeq_epi32(vd, vh));
+      __m128i m3 = _mm_andnot_si128(flat, _mm_cmpeq_epi32(vh, vf));
+      __m128i e0 = _mm_or_si128(_mm_and_si128(m0, vd), _mm_andnot_si128(m0, ve));
+      __m128i e1 = _mm_or_si128(_mm_and_si128(m1, vf), _mm_andnot_si128(m1, ve));
+      __m128i e2 = _mm_or_si128(_mm_and_si128(m2, vd), _mm_andnot_si128(m2, ve));
+      __m128i e3 = _mm_or_si128(_mm_and_si128(m3, vf), _mm_andnot_si128(m3, ve));
+      _mm_storeu_si128((__m128i *)&top[x * 2], _mm_unpacklo_epi32(e0, e1));
+      _mm_storeu_si128((__m128i *)&top[x * 2 + 4], _mm_unpackhi_epi32(e0, e1));
+      _mm_storeu_si128((__m128i *)&bottom[x * 2], _mm_unpacklo_epi32(e2, e3));
+      _mm_storeu_si128((__m128i *)&bottom[x * 2 + 4], _mm_unpackhi_epi32(e2, e3));
+    }
+#else
+    for (uint32_t x = 0; x < FrameBuffer::width; x++) {
+      bool flat = b[x] == h[x] or d[x] == f[x];
+      top[x * 2] = (!flat and d[x] == b[x]) ? d[x] : e[x];
+      top[x * 2 + 1] = (!flat and b[x] == f[x]) ? f[x] : e[x];
+      bottom[x * 2] = (!flat and d[x] == h[x]) ? d[x] : e[x];
+      bottom[x * 2 + 1] = (!flat and h[x] == f[x]) ? f[x] : e[x];
+    }
+#endif
+    std::swap(above, center);
+    std::swap(center, below);
+  }
+}
+
+// Composite video. Every line is encoded into the square wave the ppu puts out, 8 samples per pixel
+// at 12 samples per color subcarrier cycle, then decoded back to YIQ by averaging one subcarrier
+// cycle around every half pixel. Color bleeding, fringes on sharp edges, dot crawl and color
+// emphasis all fall out of that. Output is two columns per pixel and two rows per line, the second
+// darkened like the gap between crt scanlines.
+class NtscFilter : public VideoFilter {
+  static const uint32_t samplesPerPixel = 8;
+  static const uint32_t phases = 12;
+  static const uint32_t samplesPerOutput = 4;
+  static const uint32_t outputWidth = FrameBuffer::width * samplesPerPixel / samplesPerOutput;
+
+  // A line is padded with black so the decode window never runs off either end.
+  static const uint32_t padding = 8;
+  static const uint32_t lineSamples = FrameBuffer::width * samplesPerPixel + 2 * padding;
+
+  // The eight samples of a pixel starting at any phase, already multiplied by the I and Q
+  // carriers, so a pixel's contribution is a contiguous slice: [pixel][phase + sample].
+  static const uint32_t tableSpan = phases + samplesPerPixel;
+  float levelY[FrameBuffer::pixelValues][tableSpan];
+  float levelI[FrameBuffer::pixelValues][tableSpan];
+  float levelQ[FrameBuffer::pixelValues][tableSpan];
+
+  // I and Q weights of red, green and blue, the fcc conversion matrix.
+  static constexpr float yiqToRgb[3][2] = {
+      {0.946882f, 0.623557f}, {-0.274788f, -0.635691f}, {-1.108545f, 1.709007f}};
+
+  // Subcarrier phase of the first sample of line 0. A line is 341 * 8 samples long, 4 phases
+  // short of a whole number of cycles, and the frame start moves back and forth the same amount.
+  uint32_t framePhase = 0;
+
+  static float getSignal(uint32_t pixel, uint32_t phase);
+
+public:
+  uint32_t getWidth() const { return outputWidth; }
+  uint32_t getHeight() const { return FrameBuffer::height * 2; }
+  void beginFrame() { framePhase ^= 4; }
+  void processBand(const FrameBuffer &frame, uint32_t firstLine, uint32_t lastLine, uint8_t *out,
+                   uint32_t pitch) const;
+
+  NtscFilter();
+};
+
+float NtscFilter::getSignal(uint32_t pixel, uint32_t phase) {
+  // Voltage levels of the four luma levels, low and high half of the wave.
+  static const float lowLevels[4] = {0.350f, 0.518f, 0.962f, 1.550f};
+  static const float highLevels[4] = {1.094f, 1.506f, 1.962f, 1.962f};
+  static const float black = 0.518f;
+  static const float white = 1.962f;
+  static const float attenuation = 0.746f;
+
+  uint32_t color = pixel & 0x0f;
+  uint32_t level = (pixel >> 4) & 0x3;
+  uint32_t emphasis = pixel >> FrameBuffer::emphasisShift;
+  if (color > 13) {
+    level = 1;
+  }
+  float low = lowLevels[level];
+  float high = highLevels[level];
+  if (color == 0) {
+    low = high;
+  } else if (color > 12) {
+    high = low;
+  }
+
+  auto inColorPhase = [phase](uint32_t hue) { return (hue + phase) % phases < 6; };
+  float signal = inColorPhase(color) ? high : low;
+  if (color < 0x0e and (((emphasis & 1) and inColorPhase(0)) or
+                        ((emphasis & 2) and inColorPhase(4)) or
+                        ((emphasis & 4) and inColorPhase(8)))) {
+    signal *= attenuation;
+  }
+  return (signal - black) / (white - black);
+}
+
+NtscFilter::NtscFilter() {
+  // The decoder sums 12 samples, the averaging is folded into the levels. Demodulating with a
+  // unit carrier halves the chroma amplitude, which the factor of 2 on I and Q restores.
+  static const float hueShift = 3.9f;
+  for (uint32_t pixel = 0; pixel < FrameBuffer::pixelValues; pixel++) {
+    for (uint32_t i = 0; i < tableSpan; i++) {
+      float signal = getSignal(pixel, i % phases) / phases;
+      float angle = float(M_PI) * (i + hueShift) / 6.0f;
+      levelY[pixel][i] = signal;
+      levelI[pixel][i] = 2.0f * signal * std::cos(angle);
+      levelQ[pixel][i] = 2.0f * signal * std::sin(angle);
+    }
+  }
+}
+
+void NtscFilter::processBand(const FrameBuffer &frame, uint32_t firstLine, uint32_t lastLine,
+                             uint8_t *out, uint32_t pitch) const {
+  // Running sums over the line, so every decode window is a single subtraction.
+  float sumY[lineSamples + 1];
+  float sumI[lineSamples + 1];
+  float sumQ[lineSamples + 1];
+  alignas(16) float y[outputWidth];
+  alignas(16) float i[outputWidth];
+  alignas(16) float q[outputWidth];
+  const FrameBuffer::Pixel blank = FrameBuffer::makePixel(FrameBuffer::blackIndex, 0);
+
+  for (uint32_t line = firstLine; line < lastLine; line++) {
+    const FrameBuffer::Pixel *in = frame.getLine(line);
+    uint32_t phase = (framePhase + line * 4) % phases;
+
+    // Encode. Padding and pixels are all 8 samples wide, so a block is one table slice.
+    sumY[0] = sumI[0] = sumQ[0] = 0.0f;
+    for (uint32_t block = 0; block < lineSamples / samplesPerPixel; block++) {
+      uint32_t pixel = blank;
+      if (block >= padding / samplesPerPixel and
+          block < padding / samplesPerPixel + FrameBuffer::width) {
+        pixel = in[block - padding / samplesPerPixel];
+      }
+      uint32_t start = (phase + block * samplesPerPixel) % phases;
+      uint32_t n = block * samplesPerPixel;
+      for (uint32_t s = 0; s < samplesPerPixel; s++, n++) {
+        sumY[n + 1] = sumY[n] + levelY[pixel][start + s];
+        sumI[n + 1] = sumI[n] + levelI[pixel][start + s];
+        sumQ[n + 1] = sumQ[n] + levelQ[pixel][start + s];
+      }
+    }
+
+    // Decode one subcarrier cycle centered on every output column.
+    for (uint32_t x = 0; x < outputWidth; x++) {
+      uint32_t center = padding + x * samplesPerOutput + samplesPerOutput / 2;
+      y[x] = sumY[center + phases / 2] - sumY[center - phases / 2];
+      i[x] = sumI[center + phases / 2] - sumI[center - phases / 2];
+      q[x] = sumQ[center + phases / 2] - sumQ[center - phases / 2];
+    }
+
+    // YIQ to RGB, 8 columns at a time, saturated to bytes.
+    uint32_t *row = (uint32_t *)(out + line * 2 * pitch);
+    uint32_t *gap = (uint32_t *)(out + (line * 2 + 1) * pitch);
+#if defined(__SSE2__)
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128i alpha = _mm_set1_epi8(-1);
+    for (uint32_t x = 0; x < outputWidth; x += 8) {
+      __m128i channels[3];
+      for (uint32_t c = 0; c < 3; c++) {
+        __m128i half[2];
+        for (uint32_t h = 0; h < 2; h++) {
+          __m128 vy = _mm_load_ps(&y[x + h * 4]);
+          __m128 vi = _mm_mul_ps(_mm_load_ps(&i[x + h * 4]), _mm_set1_ps(yiqToRgb[c][0]));
+          __m128 vq = _mm_mul_ps(_mm_load_ps(&q[x + h * 4]), _mm_set1_ps(yiqToRgb[c][1]));
+          half[h] = _mm_cvtps_epi32(_mm_mul_ps(_mm_add_ps(vy, _mm_add_ps(vi, vq)), scale));
+        }
+        __m128i words = _mm_packs_epi32(half[0], half[1]);
+        channels[c] = _mm_packus_epi16(words, words);
+      }
+      __m128i blueGreen = _mm_unpacklo_epi8(channels[2], channels[1]);
+      __m128i redAlpha = _mm_unpacklo_epi8(channels[0], alpha);
+      _mm_storeu_si128((__m128i *)&row[x], _mm_unpacklo_epi16(blueGreen, redAlpha));
+      _mm_storeu_si128((__m128i *)&row[x + 4], _mm_unpackhi_epi16(blueGreen, redAlpha));
+    }
+    for (uint32_t x = 0; x < outputWidth; x++) {
+      gap[x] = darken(row[x]);
+    }
+#else
+    for (uint32_t x = 0; x < outputWidth; x++) {
+      uint32_t argb = 0xff000000;
+      for (uint32_t c = 0; c < 3; c++) {
+        float level = y[x] + yiqToRgb[c][0] * i[x] + yiqToRgb[c][1] * q[x];
+        int32_t byte = std::min(std::max((int32_t)std::lrint(level * 255.0f), 0), 255);
+        argb |= byte << (16 - c * 8);
+      }
+      row[x] = argb;
+      gap[x] = darken(argb);
+    }
+#endif
+  }
+}
+
+std::unique_ptr<VideoFilter> VideoFilter::create(const std::string &name) {
+  if (name == "ntsc") {
+    return std::unique_ptr<VideoFilter>{new NtscFilter{}};
+  } else if (name == "scale2x") {
+    return std::unique_ptr<VideoFilter>{new Scale2xFilter{}};
+  } else if (name == "2x" or name == "3x" or name == "4x") {
+    return std::unique_ptr<VideoFilter>{new NearestFilter{uint32_t(name[0] - '0')}};
+  }
+  return nullptr;
+}
+
+void FilterWorkers::processBands() {
+  uint32_t done = 0;
+  for (uint32_t band = nextBand++; band < bandCount; band = nextBand++) {
+    uint32_t firstLine = band * bandHeight;
+    uint32_t lastLine = std::min(firstLine + bandHeight, FrameBuffer::height);
+    filter->processBand(*frame, firstLine, lastLine, out, pitch);
+    done++;
+  }
+  if (done) {
+    std::lock_guard<std::mutex> guard(lock);
+    bandsLeft -= done;
+    if (bandsLeft == 0) {
+      cond.notify_all();
+    }
+  }
+}
+
+void FilterWorkers::main() {
+  uint64_t seenJob = 0;
+  std::unique_lock<std::mutex> guard(lock);
+  while (true) {
+    cond.wait(guard, [&] { return quit or job != seenJob; });
+    if (quit) {
+      return;
+    }
+    seenJob = job;
+    guard.unlock();
+    processBands();
+    guard.lock();
+  }
+}
+
+void FilterWorkers::run(VideoFilter &videoFilter, const FrameBuffer &videoFrame, uint8_t *output,
+                        uint32_t outputPitch) {
+  videoFilter.beginFrame();
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    filter = &videoFilter;
+    frame = &videoFrame;
+    out = output;
+    pitch = outputPitch;
+    bandCount = (FrameBuffer::height + bandHeight - 1) / bandHeight;
+    bandsLeft = bandCount;
+    nextBand = 0;
+    job++;
+  }
+  cond.notify_all();
+  processBands();
+
+  std::unique_lock<std::mutex> guard(lock);
+  cond.wait(guard, [this] { return bandsLeft == 0; });
+}
+
+FilterWorkers::FilterWorkers() {
+  uint32_t cores = std::thread::hardware_concurrency();
+  for (uint32_t i = 1; i < cores; i++) {
+    threads.emplace_back(&FilterWorkers::main, this);
+  }
+}
+
+FilterWorkers::~FilterWorkers() {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    quit = true;
+  }
+  cond.notify_all();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+}
+
+}; // namespace Rnes
@@ -0,0 +1,78 @@
+//
+//  filter.h
+//  rnes
+//
+//
+
+#ifndef __FILTER_H__
+#define __FILTER_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Rnes {
+
+class FrameBuffer;
+
+// Post-processing from the indexed frame to the ARGB8888 picture the display shows, at the
+// filter's own output size. Frames are cut into horizontal bands of input lines that are filtered
+// concurrently, see FilterWorkers.
+class VideoFilter {
+public:
+  virtual ~VideoFilter() {}
+  virtual uint32_t getWidth() const = 0;
+  virtual uint32_t getHeight() const = 0;
+
+  // Called once per frame before any band, on the presenting thread.
+  virtual void beginFrame() {}
+
+  // Filters input lines [firstLine, lastLine) into the output rows they own. out is the top left
+  // of the whole output picture and pitch is in bytes. Bands of one frame run on different threads
+  // at the same time, so nothing but those rows may be written.
+  virtual void processBand(const FrameBuffer &frame, uint32_t firstLine, uint32_t lastLine,
+                           uint8_t *out, uint32_t pitch) const = 0;
+
+  // Filters by name: "ntsc", "scale2x", "2x", "3x" or "4x". Returns nullptr for anything else.
+  static std::unique_ptr<VideoFilter> create(const std::string &name);
+};
+
+// Threads that run a filter over a frame band by band. The calling thread works on bands too, so
+// a single core machine just filters inline.
+class FilterWorkers {
+  static const uint32_t bandHeight = 16;
+
+  std::vector<std::thread> threads;
+  std::mutex lock;
+  std::condition_variable cond;
+  uint64_t job = 0;
+  uint32_t bandsLeft = 0;
+  bool quit = false;
+
+  const VideoFilter *filter = nullptr;
+  const FrameBuffer *frame = nullptr;
+  uint8_t *out = nullptr;
+  uint32_t pitch = 0;
+  uint32_t bandCount = 0;
+  std::atomic<uint32_t> nextBand{0};
+
+  void main();
+  void processBands();
+
+public:
+  // Filters the whole frame into out and returns once every band is done.
+  void run(VideoFilter &filter, const FrameBuffer &frame, uint8_t *out, uint32_t pitch);
+
+  FilterWorkers();
+  FilterWorkers(const FilterWorkers &) = delete;
+  ~FilterWorkers();
+};
+
+}; // namespace Rnes
+
+#endif
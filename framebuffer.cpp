@@ -0,0 +1,134 @@
+//
+//  framebuffer.cpp
+//  rnes
+//
+//
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "framebuffer.h"
+
+namespace Rnes {
+
+static const uint32_t nesPaletteLut[64] = {
+    0x7C7C7C, 0x0000FC, 0x0000BC, 0x4428BC, 0x940084, 0xA80020, 0xA81000, 0x881400,
+    0x503000, 0x007800, 0x006800, 0x005800, 0x004058, 0x000000, 0x000000, 0x000000,
+    0xBCBCBC, 0x0078F8, 0x0058F8, 0x6844FC, 0xD800CC, 0xE40058, 0xF83800, 0xE45C10,
+    0xAC7C00, 0x00B800, 0x00A800, 0x00A844, 0x008888, 0x000000, 0x000000, 0x000000,
+    0xF8F8F8, 0x3CBCFC, 0x6888FC, 0x9878F8, 0xF878F8, 0xF85898, 0xF87858, 0xFCA044,
+    0xF8B800, 0xB8F818, 0x58D854, 0x58F898, 0x00E8D8, 0x787878, 0x000000, 0x000000,
+    0xFCFCFC, 0xA4E4FC, 0xB8B8F8, 0xD8B8F8, 0xF8B8F8, 0xF8A4C0, 0xF0D0B0, 0xFCE0A8,
+    0xF8D878, 0xD8F878, 0xB8F8B8, 0xB8F8D8, 0x00FCFC, 0xF8D8F8, 0x000000, 0x000000,
+};
+
+// Pixel value -> ARGB8888. Emphasis is carried through the frame but not yet emulated, so every
+// emphasis combination maps to the base palette color.
+struct ArgbLut {
+  uint32_t lut[FrameBuffer::pixelValues];
+  ArgbLut() {
+    for (uint32_t i = 0; i < FrameBuffer::pixelValues; i++) {
+      lut[i] = 0xff000000 | nesPaletteLut[i & FrameBuffer::paletteIndexMask];
+    }
+  }
+};
+
+static const ArgbLut argbLut;
+
+typedef void(ConvertLine)(const FrameBuffer::Pixel *in, uint32_t *out, const uint32_t *lut);
+
+static void convertLine(const FrameBuffer::Pixel *in, uint32_t *out, const uint32_t *lut) {
+  for (uint32_t i = 0; i < FrameBuffer::width; i += 4) {
+    out[i + 0] = lut[in[i + 0]];
+    out[i + 1] = lut[in[i + 1]];
+    out[i + 2] = lut[in[i + 2]];
+    out[i + 3] = lut[in[i + 3]];
+  }
+}
+
+#if defined(__x86_64__)
+__attribute__((target("avx2"))) static void convertLineAvx2(const FrameBuffer::Pixel *in,
+                                                            uint32_t *out, const uint32_t *lut) {
+  for (uint32_t i = 0; i < FrameBuffer::width; i += 8) {
+    __m128i pixels = _mm_loadu_si128((const __m128i *)&in[i]);
+    __m256i index = _mm256_cvtepu16_epi32(pixels);
+    __m256i argb = _mm256_i32gather_epi32((const int *)lut, index, 4);
+    _mm256_storeu_si256((__m256i *)&out[i], argb);
+  }
+}
+#endif
+
+static ConvertLine *selectConvertLine() {
+#if defined(__x86_64__)
+  if (__builtin_cpu_supports("avx2")) {
+    return convertLineAvx2;
+  }
+#endif
+  return convertLine;
+}
+
+static ConvertLine *const convertLineFn = selectConvertLine();
+
+void FrameBuffer::clear() {
+  std::fill(pixels, pixels + width * height, makePixel(blackIndex, 0));
+  for (uint32_t y = 0; y < height; y++) {
+    finishLine(y);
+  }
+}
+
+void FrameBuffer::finishLine(uint32_t y) {
+  // A multiply-rotate hash over the line 4 pixels at a time, cheap next to producing the line.
+  const Pixel *line = getLine(y);
+  uint64_t hash = 0;
+  for (uint32_t i = 0; i < width * sizeof(Pixel) / sizeof(uint64_t); i++) {
+    uint64_t word;
+    memcpy(&word, line + i * sizeof(uint64_t) / sizeof(Pixel), sizeof(word));
+    hash = ((hash << 5) | (hash >> 59)) ^ word;
+    hash *= 0x9e3779b97f4a7c15ull;
+  }
+  lineHashes[y] = hash;
+}
+
+void FrameBuffer::copyLine(uint32_t y, const FrameBuffer &from) {
+  const Pixel *in = from.getLine(y);
+  std::copy(in, in + width, getLine(y));
+  lineHashes[y] = from.lineHashes[y];
+}
+
+uint64_t FrameBuffer::getFrameHash() const {
+  uint64_t hash = 0;
+  for (uint32_t y = 0; y < height; y++) {
+    hash = ((hash << 5) | (hash >> 59)) ^ lineHashes[y];
+    hash *= 0x9e3779b97f4a7c15ull;
+  }
+  return hash;
+}
+
+void FrameBuffer::toArgb8888(uint32_t *out, uint32_t pitch) const {
+  for (uint32_t y = 0; y < height; y++) {
+    uint32_t *outLine = (uint32_t *)((uint8_t *)out + y * pitch);
+    convertLineFn(getLine(y), outLine, argbLut.lut);
+  }
+}
+
+void FrameBuffer::lineToArgb8888(uint32_t y, uint32_t *out) const {
+  convertLineFn(getLine(y), out, argbLut.lut);
+}
+
+bool DirtyLines::update(const FrameBuffer &frame) {
+  bool changed = false;
+  for (uint32_t y = 0; y < FrameBuffer::height; y++) {
+    uint64_t hash = frame.getLineHash(y);
+    dirty[y] = !valid or hash != hashes[y];
+    hashes[y] = hash;
+    changed |= dirty[y];
+  }
+  valid = true;
+  return changed;
+}
+
+}; // namespace Rnes
@@ -0,0 +1,76 @@
+//
+//  framebuffer.h
+//  rnes
+//
+//
+
+#ifndef __FRAMEBUFFER_H__
+#define __FRAMEBUFFER_H__
+
+#include <cstdint>
+
+namespace Rnes {
+
+// One frame of ppu output. Pixels are stored as nes palette indices (low 6 bits) with the three
+// color emphasis bits from the second control register above them. Conversion to a displayable
+// format happens once per frame at presentation time.
+class FrameBuffer {
+public:
+  static constexpr uint32_t width = 256;
+  static constexpr uint32_t height = 240;
+
+  typedef uint16_t Pixel;
+  static constexpr Pixel paletteIndexMask = 0x3f;
+  static constexpr uint32_t emphasisShift = 6;
+  static constexpr uint32_t pixelValues = 1 << 9;
+  static constexpr uint8_t blackIndex = 0x0f;
+
+  static Pixel makePixel(uint8_t paletteIndex, uint8_t emphasis) {
+    return (paletteIndex & paletteIndexMask) | ((Pixel)emphasis << emphasisShift);
+  }
+
+  Pixel *getLine(uint32_t y) { return &pixels[y * width]; }
+  const Pixel *getLine(uint32_t y) const { return &pixels[y * width]; }
+  const Pixel *getPixels() const { return pixels; }
+  void clear();
+
+  // Every line carries a hash of its pixels. Whoever writes a line calls finishLine() once it is
+  // complete, consumers compare hashes to find what changed, see DirtyLines.
+  void finishLine(uint32_t y);
+  void copyLine(uint32_t y, const FrameBuffer &from);
+  uint64_t getLineHash(uint32_t y) const { return lineHashes[y]; }
+  uint64_t getFrameHash() const;
+
+  // Convert the whole frame, or a single line, to ARGB8888. Pitch is in bytes.
+  void toArgb8888(uint32_t *out, uint32_t pitch) const;
+  void lineToArgb8888(uint32_t y, uint32_t *out) const;
+
+  FrameBuffer() { clear(); }
+  FrameBuffer(const FrameBuffer &) = delete;
+  ~FrameBuffer() {}
+
+private:
+  Pixel pixels[width * height];
+  uint64_t lineHashes[height];
+};
+
+// The lines of a frame that changed since the last frame a consumer looked at, going by the line
+// hashes. Each consumer (display, capture, streaming) keeps its own.
+class DirtyLines {
+public:
+  // Compares frame with the previous one and remembers its hashes. True if any line changed.
+  bool update(const FrameBuffer &frame);
+  bool isDirty(uint32_t y) const { return dirty[y]; }
+
+  // Makes the next update report every line, e.g. after the consumer lost its copy.
+  void invalidate() { valid = false; }
+
+private:
+  uint64_t hashes[FrameBuffer::height];
+  bool dirty[FrameBuffer::height];
+  bool valid = false;
+};
+
+}; // namespace Rnes
+
+#endif
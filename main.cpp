@@ -10,6 +10,8 @@
 #include <boost/iostreams/stream.hpp>
 #include <boost/program_options.hpp>
 #include <crypt.h>
+#include <ctype.h>
+#include <errno.h>
 #include <iostream>
 #include <memory>
 #include <pwd.h>
@@ -17,6 +19,8 @@
 #include <string>
 #include <sys/types.h>
 
+#include "audiosink.h"
+#include "filter.h"
 #include "nes.h"
 #include "save.pb.h"
 
@@ -24,14 +28,30 @@ using namespace Rnes;
 
 // TODO:
 // - mmcs: nrom, mmc5
-// - redo sprite/bg ordering. It's currently broken.
 // - sprite0 flag
-// - clipping flags
-// - apu dmc channel
 // - color emphasis
 
 std::string help = {"--rom [filename]\n"
-                    "-r [filename]\n"};
+                    "-r [filename]\n"
+                    "--frameskip [frames]     render one of every frames + 1 frames\n"
+                    "--render-thread          rasterize on a second thread\n"
+                    "--filter [name]          ntsc, scale2x, 2x, 3x or 4x output filter\n"
+                    "--audio-sync             pace by the audio device instead of rate control\n"
+                    "--audio-stats            print audio buffer stats once a second\n"
+                    "--no-audio               run unthrottled without generating audio\n"
+                    "--audio-capture [file]   write audio to file, wav if named .wav, else raw\n"};
+
+// Parses a plain decimal count. strtoul alone would take signs and wrap negative values around.
+bool parseCount(const char *arg, uint32_t &count) {
+  char *end;
+  errno = 0;
+  unsigned long value = strtoul(arg, &end, 10);
+  if (!isdigit((unsigned char)arg[0]) || *end != '\0' || errno || value > UINT32_MAX) {
+    return false;
+  }
+  count = (uint32_t)value;
+  return true;
+}
 
 void displayHelpAndQuit() {
   std::cerr << help;
@@ -157,17 +177,47 @@ int main(int argc, char *argv[]) {
   namespace fs = boost::filesystem;
   string romFile;
   bool romFileSpecified = false;
+  uint32_t frameskip = 0;
+  bool renderThread = false;
+  bool rateControl = true;
+  bool audioStats = false;
+  unique_ptr<AudioSink> audioSink;
+  unique_ptr<VideoFilter> filter;
 
   // Verify that the version of the library that we linked against is
   // compatible with the version of the headers we compiled against.
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
   // TODO: convert argument parsing to boost program options
-  for (int i = 0; i < argc; i++) {
-    if (argv[i] == string("--rom") || argv[i] == string("-r")) {
-      romFile = argv[i + 1];
+  for (int i = 1; i < argc; i++) {
+    if ((argv[i] == string("--rom") || argv[i] == string("-r")) && i + 1 < argc) {
+      romFile = argv[++i];
       romFileSpecified = true;
-      i += 2;
+    } else if (argv[i] == string("--frameskip") && i + 1 < argc) {
+      if (!parseCount(argv[++i], frameskip)) {
+        displayHelpAndQuit();
+      }
+    } else if (argv[i] == string("--render-thread")) {
+      renderThread = true;
+    } else if (argv[i] == string("--audio-sync")) {
+      rateControl = false;
+    } else if (argv[i] == string("--audio-stats")) {
+      audioStats = true;
+    } else if (argv[i] == string("--no-audio")) {
+      audioSink = AudioSink::createNull(AudioSink::defaultSampleRate);
+    } else if (argv[i] == string("--audio-capture") && i + 1 < argc) {
+      audioSink = AudioSink::createCapture(argv[++i], AudioSink::defaultSampleRate);
+      if (!audioSink) {
+        cerr << "can't create audio capture file: " << argv[i] << endl;
+        exit(1);
+      }
+    } else if (argv[i] == string("--filter") && i + 1 < argc) {
+      filter = VideoFilter::create(argv[++i]);
+      if (!filter) {
+        displayHelpAndQuit();
+      }
+    } else {
+      displayHelpAndQuit();
     }
   }
 
@@ -180,11 +230,23 @@ int main(int argc, char *argv[]) {
     verifyRomExists(romFile);
 
     auto nes = unique_ptr<Nes>{new Nes{}};
+    if (!nes->isDisplayOpen()) {
+      cerr << "Failed to open a window" << endl;
+      exit(1);
+    }
     int res = nes->loadRom(romFile);
     if (res) {
       cerr << "Failed to load rom: " << romFile << endl;
       exit(1);
     }
+    nes->setFrameskip(frameskip);
+    nes->setRenderThread(renderThread);
+    nes->setRateControl(rateControl);
+    nes->setAudioStatsDump(audioStats);
+    if (audioSink) {
+      nes->setAudioSink(std::move(audioSink));
+    }
+    nes->setVideoFilter(std::move(filter));
 
     // Setup the rnes directories.
     setupDirectories(md5OfFile(romFile));
@@ -118,6 +118,10 @@ Mmc1::~Mmc1() {}
 void Mmc1::updateMmcRegister(uint16_t addr, uint8_t shiftRegister) {
   switch ((addr >> 13) & 0x7) {
   case 4:
+    // Only the prg rom mode bits leave the ppu's view alone.
+    if ((controlReg ^ shiftRegister) & ~(0x3 << 2)) {
+      videoMapGeneration++;
+    }
     controlReg = shiftRegister;
     if (debug) {
       std::cerr << "mmc1 " << std::hex << addr << ": control reg: " << std::hex << (int)controlReg
@@ -125,6 +129,9 @@ void Mmc1::updateMmcRegister(uint16_t addr, uint8_t shiftRegister) {
     }
     break;
   case 5:
+    if (chr0Bank != shiftRegister) {
+      videoMapGeneration++;
+    }
     chr0Bank = shiftRegister;
     if (debug) {
       std::cerr << "mmc1 " << std::hex << addr << ": chr0Bank reg: " << std::hex << (int)chr0Bank
@@ -132,6 +139,9 @@ void Mmc1::updateMmcRegister(uint16_t addr, uint8_t shiftRegister) {
     }
     break;
   case 6:
+    if (chr1Bank != shiftRegister) {
+      videoMapGeneration++;
+    }
     chr1Bank = shiftRegister;
     if (debug) {
       std::cerr << "mmc1 " << std::hex << addr << ": chr1Bank reg: " << std::hex << (int)chr1Bank
@@ -321,6 +331,10 @@ Mmc3::~Mmc3() {}
 
 void Mmc3::updateBankRegister(uint8_t val) {
   uint8_t bankSelect = getBankSelect();
+  // Registers 0-5 bank chr, 6 and 7 prg.
+  if (bankSelect < 6 and bankRegister[bankSelect] != val) {
+    videoMapGeneration++;
+  }
   bankRegister[bankSelect] = val;
   if (debug) {
     std::cerr << "bank " << std::hex << (int)bankSelect << ": " << (int)val << std::endl;
@@ -351,12 +365,18 @@ void Mmc3::cpuMemWrite(uint16_t addr, uint8_t val) {
     if (addr & 0x1) {
       updateBankRegister(val);
     } else {
+      if ((bankSelectReg ^ val) & (1 << 7)) {
+        videoMapGeneration++;
+      }
       bankSelectReg = val;
     }
   } else if (addr >= 0xa000 and addr <= 0xbfff) {
     if (addr & 0x1) {
       prgRamReg = val;
     } else {
+      if ((mirrorReg ^ val) & 0x1) {
+        videoMapGeneration++;
+      }
       mirrorReg = val;
     }
   } else if (addr >= 0xc000 and addr <= 0xdfff) {
@@ -447,7 +467,7 @@ uint8_t Mmc3::vidMemRead(uint16_t addr) {
   return 0;
 }
 
-void Mmc3::notifyScanlineComplete() {
+void Mmc3::clockIrqCounter() {
   if (irqCounterReg == 0) {
     irqCounterReg = irqReloadReg;
   } else {
@@ -458,6 +478,12 @@ void Mmc3::notifyScanlineComplete() {
   }
 }
 
+// The scanline engine clocks the counter once per rendered line, the dot engine on the filtered
+// a12 edges the real chip sees.
+void Mmc3::notifyScanlineComplete() { clockIrqCounter(); }
+
+void Mmc3::notifyPpuA12Rise() { clockIrqCounter(); }
+
 bool Mmc3::isRequestingIrq() { return irqEnabled and irqPending; }
 
 void Mmc3::save(MmcState &pb) {
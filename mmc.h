@@ -35,6 +35,7 @@ public:
   virtual void vidMemWrite(uint16_t addr, uint8_t val) = 0;
   virtual uint8_t vidMemRead(uint16_t addr) = 0;
   virtual void notifyScanlineComplete() {}
+  virtual void notifyPpuA12Rise() {}
   virtual bool isRequestingIrq() { return false; }
   virtual bool isPrgSramEnabled() const = 0;
   virtual bool isPrgSramWriteable() const { return isPrgSramEnabled(); }
@@ -42,8 +43,13 @@ public:
   virtual void save(MmcState &pb) = 0;
   virtual void restore(MmcState &pb) = 0;
 
+  // Bumped whenever a register write changes what the ppu sees through the mapper, i.e. chr
+  // banking or nametable mirroring. Prg banking and irq writes leave it alone.
+  uint64_t getVideoMapGeneration() const { return videoMapGeneration; }
+
 protected:
   static const bool debug = false;
+  uint64_t videoMapGeneration = 0;
 };
 
 class MmcNone : public Mmc {
@@ -141,6 +147,7 @@ class Mmc3 : public Mmc {
   uint16_t vidAddrTranslate(uint16_t addr);
   void updateBankRegister(uint8_t val);
   uint8_t *getChrPointer(uint16_t addr);
+  void clockIrqCounter();
 
 public:
   Mmc3() = delete;
@@ -152,6 +159,7 @@ public:
   void vidMemWrite(uint16_t addr, uint8_t val);
   uint8_t vidMemRead(uint16_t addr);
   void notifyScanlineComplete();
+  void notifyPpuA12Rise();
   bool isRequestingIrq();
   void save(MmcState &pb);
   void restore(MmcState &pb);
@@ -12,6 +12,7 @@
 #include <unistd.h>
 
 #include "apu.h"
+#include "audiosink.h"
 #include "cpu.h"
 #include "memory.h"
 #include "mmc.h"
@@ -30,6 +31,9 @@ static const uint16_t spriteDmaAddr = 0x4014;
 
 static const uint16_t joypadAddr = 0x4016;
 
+// The savestate keys are looked at once every this many cpu cycles.
+static const uint32_t inputCycles = 1 << 16;
+
 static const uint16_t ppuRegBase = 0x2000;
 static const uint16_t ppuRegEnd = ppuRegBase + Ppu::REG_COUNT - 1;
 
@@ -51,7 +55,6 @@ void Controller::restore(const ControllerState &pb) {
 }
 
 void Controller::setShiftReg() {
-  sdl->parseInput();
   shiftReg = 0;
   shiftReg |= (sdl->getButtonState(Sdl::BUTTON_A) ? 1u : 0u) << 0;
   shiftReg |= (sdl->getButtonState(Sdl::BUTTON_B) ? 1u : 0u) << 1;
@@ -76,7 +79,6 @@ void Controller::write(uint8_t val) {
 
 uint8_t Controller::read() {
   if (control & 0x1) {
-    sdl->parseInput();
     return (sdl->getButtonState(Sdl::BUTTON_A) ? 1u : 0u) << 0;
   } else {
     uint8_t ret = 0;
@@ -147,13 +149,17 @@ void Nes::spriteDmaSetup(uint8_t val) {
 void Nes::cpuMemWrite(uint16_t addr, uint8_t val) {
   addr = translateCpuWindows(addr);
   if (addr >= ppuRegBase && addr <= ppuRegEnd) {
+    syncPpu();
     ppu->writeReg(addr - ppuRegBase, val);
+    schedulePpu();
   } else if (addr == spriteDmaAddr) {
     spriteDmaSetup(val);
   } else if (addr == joypadAddr) {
     pad->write(val);
   } else if (addr >= apuRegBase && addr <= apuRegEnd) {
+    syncApu();
     apu->writeReg(addr - apuRegBase, val);
+    scheduleApu();
   } else {
     cpuMemory->store(addr, val);
   }
@@ -162,11 +168,17 @@ void Nes::cpuMemWrite(uint16_t addr, uint8_t val) {
 uint8_t Nes::cpuMemRead(uint16_t addr) {
   addr = translateCpuWindows(addr);
   if (addr >= ppuRegBase && addr <= ppuRegEnd) {
-    return ppu->readReg(addr - ppuRegBase);
+    syncPpu();
+    uint8_t val = ppu->readReg(addr - ppuRegBase);
+    schedulePpu();
+    return val;
   } else if (addr == joypadAddr) {
     return pad->read();
   } else if (addr >= apuRegBase && addr <= apuRegEnd) {
-    return apu->readReg(addr - apuRegBase);
+    syncApu();
+    uint8_t val = apu->readReg(addr - apuRegBase);
+    scheduleApu();
+    return val;
   } else {
     return cpuMemory->load(addr);
   }
@@ -176,6 +188,7 @@ void Nes::vidMemWrite(uint16_t addr, uint8_t val) {
   addr = translatePpuWindows(addr);
   assert(addr < videoMemorySize);
   videoMemory->store(addr, val);
+  videoMemoryGeneration++;
 }
 
 uint8_t Nes::vidMemRead(uint16_t addr) {
@@ -186,44 +199,125 @@ uint8_t Nes::vidMemRead(uint16_t addr) {
 
 void Nes::notifyScanlineComplete() { mmc->notifyScanlineComplete(); }
 
+void Nes::notifyPpuA12Rise() { mmc->notifyPpuA12Rise(); }
+
+uint64_t Nes::getVideoMemoryGeneration() const {
+  return videoMemoryGeneration + mmc->getVideoMapGeneration();
+}
+
+const FrameBuffer &Nes::getFrameBuffer() const { return ppu->getFrameBuffer(); }
+
+bool Nes::isDisplayOpen() const { return sdl->isDisplayOpen(); }
+
+const ChannelLevels &Nes::getChannelLevels() const { return apu->getChannelLevels(); }
+
+AudioStats Nes::getAudioStats() const { return apu->getAudioStats(); }
+
+void Nes::clearAudioStats() { apu->clearAudioStats(); }
+
+void Nes::setAudioStatsDump(bool enabled) { apu->setAudioStatsDump(enabled); }
+
+void Nes::setAudioSink(std::unique_ptr<AudioSink> sink) {
+  apu->setAudioSink(sink.get());
+  unthrottled = sink->isDiscarding();
+  audioSink = std::move(sink);
+  updateFramePacing();
+}
+
+void Nes::setFrameskip(uint32_t frames) { ppu->setFrameskip(frames); }
+
+void Nes::setRenderThread(bool enabled) { ppu->setRenderThread(enabled); }
+
+void Nes::setRateControl(bool enabled) {
+  rateControl = enabled;
+  apu->setRateControl(enabled);
+  updateFramePacing();
+}
+
+void Nes::updateFramePacing() { ppu->setFramePacing(rateControl and !unthrottled); }
+
+void Nes::setVideoFilter(std::unique_ptr<VideoFilter> filter) {
+  sdl->setVideoFilter(std::move(filter));
+}
+
 bool Nes::isRequestingNmi() { return ppu->isRequestingNmi(); }
 
 bool Nes::isRequestingInt() { return apu->isRequestingIrq() || mmc->isRequestingIrq(); }
 
+void Nes::syncPpu() {
+  ppu->run(scheduler.getCycle() - ppuCycle);
+  ppuCycle = scheduler.getCycle();
+}
+
+void Nes::schedulePpu() { scheduler.schedule(Scheduler::PPU, ppuCycle + ppu->getCyclesToEvent()); }
+
+void Nes::syncApu() {
+  // Dmc sample fetches hold the cpu, the apu has already run those cycles.
+  scheduler.advance(apu->run(scheduler.getCycle() - apuCycle));
+  apuCycle = scheduler.getCycle();
+}
+
+void Nes::scheduleApu() { scheduler.schedule(Scheduler::APU, apuCycle + apu->getCyclesToEvent()); }
+
+void Nes::pollInput() {
+  void loadNesState(Nes * nes, std::string saveFile);
+  void saveNesState(Nes * nes, std::string saveFile);
+  std::string getGameSaveDir(const std::string & romFile);
+
+  if (sdl->getButtonState(Sdl::BUTTON_SAVE)) {
+    saveNesState(this, getGameSaveDir(romFile));
+  }
+  if (sdl->getButtonState(Sdl::BUTTON_RESTORE)) {
+    loadNesState(this, getGameSaveDir(romFile));
+  }
+  scheduler.schedule(Scheduler::INPUT, scheduler.getCycle() + inputCycles);
+}
+
+void Nes::runEvents() {
+  while (scheduler.isEventDue()) {
+    switch (scheduler.popEvent()) {
+    case Scheduler::APU:
+      syncApu();
+      scheduleApu();
+      break;
+    case Scheduler::PPU:
+      syncPpu();
+      schedulePpu();
+      break;
+    case Scheduler::INPUT:
+      pollInput();
+      break;
+    default:
+      assert(0);
+      break;
+    }
+  }
+}
+
 void Nes::run() {
-  uint32_t inputCycles = 1 << 16;
   cpu->reset();
-  while (1) {
-    uint32_t cpuCycles;
-    if (!spriteDmaMode) {
-      cpuCycles = cpu->runInst();
-    } else {
-      cpuCycles = spriteDmaExecute();
-    }
-    apu->run(cpuCycles);
-    ppu->run(cpuCycles);
-
-    cycles += cpuCycles;
-    if ((cycles % inputCycles) == 0) {
-      sdl->parseInput();
-
-      void loadNesState(Nes * nes, std::string saveFile);
-      void saveNesState(Nes * nes, std::string saveFile);
-      std::string getGameSaveDir(const std::string & romFile);
-
-      if (sdl->getButtonState(Sdl::BUTTON_SAVE)) {
-        saveNesState(this, getGameSaveDir(romFile));
-      }
-      if (sdl->getButtonState(Sdl::BUTTON_RESTORE)) {
-        loadNesState(this, getGameSaveDir(romFile));
-      }
+  scheduleApu();
+  schedulePpu();
+  scheduler.schedule(Scheduler::INPUT, scheduler.getCycle() + inputCycles);
+
+  // Returning unwinds everything, so sinks get to finish what they are writing.
+  while (!sdl->isQuitRequested()) {
+    // The cpu runs in a burst up to the next event. Register accesses catch a component up on the
+    // spot and may pull its event in, so the deadline is looked at again after every instruction.
+    while (!scheduler.isEventDue()) {
+      scheduler.advance(spriteDmaMode ? spriteDmaExecute() : cpu->runInst());
     }
+    runEvents();
   }
 }
 
 void Nes::save(SaveState &pb) {
   // date??
 
+  // Everything is saved as of the master clock.
+  syncApu();
+  syncPpu();
+
   // Dma state
   DmaState *dma = pb.mutable_dma();
   dma->set_spritedmamode(spriteDmaMode);
@@ -270,6 +364,13 @@ void Nes::restore(const SaveState &pb) {
   // SRAM state.
   cpuMemory->restore(pb.cpumem());
   videoMemory->restore(pb.vidmem());
+  videoMemoryGeneration++;
+
+  // The components carry on from the master clock, whatever their restored clocks say.
+  ppuCycle = scheduler.getCycle();
+  apuCycle = scheduler.getCycle();
+  schedulePpu();
+  scheduleApu();
 }
 
 struct NesHeader {
@@ -377,9 +478,17 @@ int Nes::loadRom(const std::string &filename) {
   return 0;
 }
 
+static std::unique_ptr<AudioSink> createDefaultAudioSink(Sdl *sdl) {
+  if (sdl->isAudioOpen()) {
+    return AudioSink::createSdl(sdl);
+  }
+  std::cerr << "no audio device, audio is dropped" << std::endl;
+  return AudioSink::createNull(AudioSink::defaultSampleRate);
+}
+
 Nes::Nes()
-    : sdl{new Sdl{}}, cpu{new Cpu{this}}, ppu{new Ppu{this, sdl.get()}}, apu{new Apu{this,
-                                                                                     sdl.get()}},
+    : sdl{new Sdl{}}, audioSink{createDefaultAudioSink(sdl.get())}, cpu{new Cpu{this}},
+      ppu{new Ppu{this, sdl.get()}}, apu{new Apu{this, audioSink.get()}},
       pad{new Controller{sdl.get()}}, cpuMemory{new CpuMemory{}}, videoMemory{new VideoMemory{}} {}
 
 Nes::~Nes() {
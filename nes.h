@@ -9,6 +9,8 @@
 #include <memory>
 #include <string>
 
+#include "scheduler.h"
+
 namespace Rnes {
 
 class Mmc;
@@ -20,6 +22,11 @@ class CpuMemory;
 class VideoMemory;
 class SaveState;
 class ControllerState;
+class FrameBuffer;
+struct ChannelLevels;
+struct AudioStats;
+class VideoFilter;
+class AudioSink;
 
 class Controller {
   Sdl *sdl;
@@ -51,9 +58,23 @@ class Nes {
   uint32_t spriteDmaCycle = 0;
   uint16_t spriteDmaSourceAddr = 0;
 
-  uint64_t cycles = 0;
+  // The master clock and the next event of each component. The ppu and apu keep their own clocks
+  // and are brought up to the master one only when their event is due or their registers are
+  // touched; ppuCycle and apuCycle are the master cycles they were last brought up to.
+  Scheduler scheduler;
+  uint64_t ppuCycle = 0;
+  uint64_t apuCycle = 0;
+
+  // Bumped on vram writes and restores. Mapper register writes that change the ppu's view are
+  // counted by the mapper, getVideoMemoryGeneration() adds both up.
+  uint64_t videoMemoryGeneration = 0;
+
+  bool rateControl = false;
+  bool unthrottled = false;
+  void updateFramePacing();
 
   std::unique_ptr<Sdl> sdl;
+  std::unique_ptr<AudioSink> audioSink;
   std::unique_ptr<Cpu> cpu;
   std::unique_ptr<Ppu> ppu;
   std::unique_ptr<Apu> apu;
@@ -65,6 +86,13 @@ class Nes {
   uint32_t spriteDmaExecute();
   void spriteDmaSetup(uint8_t val);
 
+  void syncPpu();
+  void schedulePpu();
+  void syncApu();
+  void scheduleApu();
+  void pollInput();
+  void runEvents();
+
 public:
   void cpuMemWrite(uint16_t addr, uint8_t val);
   uint8_t cpuMemRead(uint16_t addr);
@@ -72,10 +100,48 @@ public:
   uint8_t vidMemRead(uint16_t addr);
 
   void notifyScanlineComplete();
+  void notifyPpuA12Rise();
+
+  // Indexed video output for consumers that don't need rgb.
+  const FrameBuffer &getFrameBuffer() const;
+
+  // False when no window could be opened, there's then no way to see or control the game.
+  bool isDisplayOpen() const;
+
+  // Audio of the last audio frame as separate channel levels, for analysis.
+  const ChannelLevels &getChannelLevels() const;
+
+  // Ring fill, latency, producer waits, device underruns and rate steering since the last clear.
+  AudioStats getAudioStats() const;
+  void clearAudioStats();
+
+  // Print the audio stats to stderr and clear them after every second of output.
+  void setAudioStatsDump(bool enabled);
+
+  // Replace where audio goes, the sdl device by default or a null sink when there is none. Handing
+  // over a discarding sink also lifts the frame pacing, emulation then runs as fast as it can. The
+  // null sink used for lack of a device keeps real time.
+  void setAudioSink(std::unique_ptr<AudioSink> sink);
 
   bool isRequestingNmi();
   bool isRequestingInt();
 
+  // Only rasterize one of every frames + 1 frames.
+  void setFrameskip(uint32_t frames);
+
+  // Rasterize frames on a separate thread.
+  void setRenderThread(bool enabled);
+
+  // Pace emulation by a real time frame clock and steer the audio rate to keep the audio device
+  // fed. When off, emulation waits for the audio device instead.
+  void setRateControl(bool enabled);
+
+  // Post-process frames before they are displayed, nullptr for none.
+  void setVideoFilter(std::unique_ptr<VideoFilter> filter);
+
+  // Changes whenever the ppu's view of video memory may have changed.
+  uint64_t getVideoMemoryGeneration() const;
+
   int mapRom(const std::string &filename);
   int loadRom(const std::string &filename);
   void run();
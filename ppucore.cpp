@@ -0,0 +1,360 @@
+//
+//  ppucore.cpp
+//  rnes
+//
+//
+
+#include <assert.h>
+#include <math.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "framebuffer.h"
+#include "nes.h"
+#include "ppucore.h"
+#include "save.pb.h"
+#include "sdl.h"
+
+static const uint16_t backColorAddr = 0x3f00;
+
+static constexpr double frameTimeMs = 1000.0 / 60.09848604129652;
+
+// Pacing gives up on frames it is further behind than this and starts over from now.
+static constexpr double maxFrameLagMs = 100.0;
+
+static void sleepMs(double ms) {
+  struct timespec wait = {(time_t)(ms / 1000), (long)(fmod(ms, 1000.0) * 1000000)};
+  nanosleep(&wait, NULL);
+}
+
+static double timerGetMs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+namespace Rnes {
+
+uint8_t PpuCore::getBgColor() {
+  uint8_t memColor = load(backColorAddr);
+  if (isMonochromeMode()) {
+    memColor &= 0x30;
+  } else {
+    memColor &= 0x3f;
+  }
+  return memColor;
+}
+
+uint8_t PpuCore::getColor(uint32_t palette, uint32_t color, bool sprite) {
+  uint8_t memColor;
+  assert(color >= 0 && color <= 3);
+  if (color == 0) {
+    memColor = load(backColorAddr);
+  } else {
+    uint16_t paletteOffset = sprite ? 0x10 : 0;
+    memColor = load(backColorAddr + paletteOffset + 4 * palette + color);
+  }
+  if (isMonochromeMode()) {
+    memColor &= 0x30;
+  } else {
+    memColor &= 0x3f;
+  }
+  return memColor;
+}
+
+uint16_t PpuCore::coarseXInc(uint16_t vramCurrent) {
+  if ((vramCurrent & 0x1f) == 31) {
+    // coarse x = 0
+    vramCurrent &= ~0x001f;
+    // switch horizontal nametable
+    vramCurrent ^= 0x0400;
+  } else {
+    // increment coarse x
+    vramCurrent += 1;
+  }
+  return vramCurrent;
+}
+
+void PpuCore::vramCoarseXInc() { vramCurrentAddr = coarseXInc(vramCurrentAddr); }
+
+void PpuCore::vramYInc() {
+  if ((vramCurrentAddr & 0x7000) != 0x7000) {
+    vramCurrentAddr += 0x1000;
+  } else {
+    vramCurrentAddr &= ~0x7000;
+    int y = (vramCurrentAddr & 0x03e0) >> 5;
+    if (y == 29) {
+      y = 0;
+      vramCurrentAddr ^= 0x0800;
+    } else if (y == 31) {
+      y = 0;
+    } else {
+      y += 1;
+    }
+    vramCurrentAddr = (vramCurrentAddr & ~0x03e0) | (y << 5);
+  }
+}
+
+void PpuCore::vramXReset() {
+  vramCurrentAddr = (vramCurrentAddr & 0xfbe0) | (vramTempAddr & ~0xfbe0);
+}
+
+void PpuCore::vramYReset() {
+  vramCurrentAddr = (vramCurrentAddr & ~0xfbe0) | (vramTempAddr & 0xfbe0);
+}
+
+uint8_t *PpuCore::getSpriteRamByte(uint8_t offset) {
+  uint32_t sprite = offset / 4;
+  switch (offset % 4) {
+  case 0:
+    return &spriteRam.yCoordMinus1[sprite];
+  case 1:
+    return &spriteRam.tileIndex[sprite];
+  case 2:
+    return &spriteRam.attr[sprite];
+  default:
+    return &spriteRam.xCoord[sprite];
+  }
+}
+
+void PpuCore::save(PpuState &pb) {
+  pb.set_cycle(cycle);
+  pb.set_frame(frame);
+
+  for (int i = 0; i < REG_COUNT; i++) {
+    pb.add_regs(regs[i]);
+  }
+
+  for (int i = 0; i < spriteRamSize; i++) {
+    PpuState_SpriteState *sprite = pb.add_spriteram();
+    sprite->set_ycoordminus1(spriteRam.yCoordMinus1[i]);
+    sprite->set_tileindex(spriteRam.tileIndex[i]);
+    sprite->set_attr(spriteRam.attr[i]);
+    sprite->set_xcoord(spriteRam.xCoord[i]);
+  }
+
+  pb.set_vramtoggle(vramToggle);
+  pb.set_vramfinexscroll(vramFineXScroll);
+  pb.set_vramcurrentaddr(vramCurrentAddr);
+  pb.set_vramtempaddr(vramTempAddr);
+  pb.set_vrammachineaddr(vramMachineAddr);
+  pb.set_vramreadlatch(vramReadLatch);
+  pb.set_scrollingmachinestate(scrollingMachineState);
+  pb.set_xscrollorigin(xScrollOrigin);
+  pb.set_yscrollorigin(yScrollOrigin);
+}
+
+void PpuCore::restore(const PpuState &pb) {
+  cycle = pb.cycle();
+  targetCycle = cycle;
+  currentScanline = cycle / ticksPerScanline % totalScanlines;
+  lineClock = cycle % ticksPerScanline;
+  frame = pb.frame();
+
+  for (int i = 0; i < pb.regs_size(); i++) {
+    regs[i] = pb.regs(i);
+  }
+
+  for (int i = 0; i < pb.spriteram_size(); i++) {
+    const PpuState_SpriteState &sprite = pb.spriteram(i);
+    spriteRam.yCoordMinus1[i] = sprite.ycoordminus1();
+    spriteRam.tileIndex[i] = sprite.tileindex();
+    spriteRam.attr[i] = sprite.attr();
+    spriteRam.xCoord[i] = sprite.xcoord();
+  }
+  spriteGeneration++;
+
+  vramToggle = pb.vramtoggle();
+  vramFineXScroll = pb.vramfinexscroll();
+  vramCurrentAddr = pb.vramcurrentaddr();
+  vramTempAddr = pb.vramtempaddr();
+  vramMachineAddr = pb.vrammachineaddr();
+  vramReadLatch = pb.vramreadlatch();
+  scrollingMachineState = pb.scrollingmachinestate();
+  xScrollOrigin = pb.xscrollorigin();
+  yScrollOrigin = pb.yscrollorigin();
+}
+
+PpuCore::PpuCore(Nes *parent, Sdl *disp)
+    : nes{parent}, sdl{disp}, frameBuffer{disp->getFrame()} {}
+
+void PpuCore::setFramePacing(bool enabled) {
+  framePacing = enabled;
+  nextFrameTimeMs = timerGetMs();
+}
+
+PpuCore::~PpuCore() {}
+
+uint8_t PpuCore::load(uint16_t addr) { return nes->vidMemRead(addr); }
+
+void PpuCore::store(uint16_t addr, uint8_t val) { nes->vidMemWrite(addr, val); }
+
+bool PpuCore::isRequestingNmi() {
+  bool ret = nmiRequested;
+  nmiRequested = false;
+  return ret;
+}
+
+void PpuCore::writeReg(uint32_t reg, uint8_t val) {
+  // CONTROL1_REG            = 0,
+  // CONTROL2_REG            = 1,
+  // STATUS_REG              = 2,
+  // SPR_ADDR_REG            = 3,
+  // SPR_DATA_REG            = 4,
+  // VRAM_ADDR_REG1          = 5,
+  // VRAM_ADDR_REG2          = 6,
+  // VRAM_DATA_REG           = 7,
+  switch (reg) {
+  case CONTROL1_REG:
+    vramTempAddr = (vramTempAddr & 0xf3ff) | ((uint16_t)val & 0x3) << 10;
+    if ((regs[reg] ^ val) & CONTROL_SPRITE_SIZE) {
+      spriteGeneration++;
+    }
+  case CONTROL2_REG:
+    // Write only registers.
+    regs[reg] = val;
+    break;
+  case STATUS_REG:
+    // Read only register.
+    break;
+  case SPR_ADDR_REG:
+    regs[reg] = val;
+    break;
+  case SPR_DATA_REG:
+    *getSpriteRamByte(regs[SPR_ADDR_REG]) = val;
+    regs[SPR_ADDR_REG]++;
+    spriteGeneration++;
+    break;
+  case VRAM_ADDR_REG1:
+    if (vramToggle == 0) {
+      vramTempAddr = (0xffe0 & vramTempAddr) | (val >> 3);
+      vramFineXScroll = val & 0x7;
+    } else {
+      vramTempAddr =
+          (0xc1f & vramTempAddr) | (((uint16_t)val & 0x7) << 12) | (((uint16_t)val & 0xf8) << 2);
+    }
+    vramToggle = not vramToggle;
+    break;
+  case VRAM_ADDR_REG2:
+    if (vramToggle == 0) {
+      vramTempAddr = (((uint16_t)val & 0x3f) << 8) | (vramTempAddr & 0xff);
+    } else {
+      vramTempAddr = val | (vramTempAddr & 0xff00);
+      vramCurrentAddr = vramTempAddr;
+    }
+    vramToggle = not vramToggle;
+    break;
+  case VRAM_DATA_REG:
+    nes->vidMemWrite(vramCurrentAddr, val);
+    vramCurrentAddr += getVramAddrInc();
+    break;
+  default:
+    assert(0);
+    break;
+  }
+}
+
+uint8_t PpuCore::readReg(uint32_t reg) {
+  uint8_t ret;
+  switch (reg) {
+  case CONTROL1_REG:
+    assert(0);
+    // GUESS: Write only registers.
+    return regs[reg];
+    break;
+  case CONTROL2_REG:
+    assert(0);
+    // GUESS: Write only registers.
+    return regs[reg];
+    break;
+  case STATUS_REG:
+    ret = regs[reg];
+    // vblank status bit is clear on read
+    clearVblankFlag();
+    // reset the scroll/vram machine flip flops
+    vramToggle = 0;
+    // and return the reg value
+    return ret;
+    break;
+  case SPR_ADDR_REG:
+  case SPR_DATA_REG:
+    // Write only registers.
+    assert(0);
+    return 0;
+    break;
+  case VRAM_ADDR_REG1:
+    // assert(0);
+    // This is a guess, we aren't expecting reads here.
+    return vramCurrentAddr;
+    break;
+  case VRAM_ADDR_REG2:
+    assert(0);
+    // This is a guess, we aren't expecting reads here.
+    return vramTempAddr;
+    break;
+  case VRAM_DATA_REG:
+    ret = vramReadLatch;
+    vramReadLatch = nes->vidMemRead(vramCurrentAddr);
+    vramCurrentAddr += getVramAddrInc();
+    return ret;
+    break;
+  default:
+    assert(0);
+    break;
+  }
+  return 0;
+}
+
+void PpuCore::advanceClock(uint64_t newCycle) {
+  assert(newCycle >= cycle);
+  uint64_t dots = lineClock + (newCycle - cycle);
+  while (dots >= ticksPerScanline) {
+    dots -= ticksPerScanline;
+    currentScanline = (currentScanline + 1) % totalScanlines;
+  }
+  lineClock = dots;
+  cycle = newCycle;
+}
+
+void PpuCore::finishLine(uint32_t scanline) {
+  frameBuffer->finishLine(scanline);
+  linesDrawn[scanline] = true;
+}
+
+void PpuCore::presentFrame() {
+  for (uint32_t y = 0; y < renderHeight; y++) {
+    if (!linesDrawn[y] and lastFrame) {
+      frameBuffer->copyLine(y, *lastFrame);
+    }
+    linesDrawn[y] = false;
+  }
+  lastFrame = frameBuffer;
+  frameBuffer = sdl->presentFrame();
+}
+
+void PpuCore::endFrame() {
+  if (!isFrameSkipped()) {
+    presentFrame();
+  }
+  if (framePacing) {
+    // Deadlines advance by exactly one frame, so oversleeping one frame is made up by the next.
+    double now = timerGetMs();
+    nextFrameTimeMs += frameTimeMs;
+    if (nextFrameTimeMs > now) {
+      sleepMs(nextFrameTimeMs - now);
+    } else if (now - nextFrameTimeMs > maxFrameLagMs) {
+      nextFrameTimeMs = now;
+    }
+  }
+  frame += 1;
+}
+
+uint16_t PpuCore::getVramAddrInc() const {
+  if (regs[CONTROL1_REG] & CONTROL_VRAM_ADDR_INC) {
+    return 32;
+  } else {
+    return 1;
+  }
+}
+
+}; // namespace Rnes
@@ -0,0 +1,202 @@
+//
+//  ppucore.h
+//  rnes
+//
+//
+
+#ifndef __PPUCORE_H__
+#define __PPUCORE_H__
+
+#include <cstdint>
+#include <memory>
+
+namespace Rnes {
+
+class Nes;
+class Sdl;
+class PpuState;
+class FrameBuffer;
+
+// State and register behaviour shared by every ppu engine: the register file, oam, the vram
+// address machine, the lazy clock and the frame buffer. Engines derive from this and decide how
+// the picture gets produced, see ppu.h.
+class PpuCore {
+public:
+  static constexpr bool debug = false;
+  static constexpr uint32_t ticksPerScanline = 341;
+  static constexpr uint32_t totalScanlines = 262;
+  static constexpr uint32_t vblankScanline = 241;
+  static constexpr uint32_t preRenderScanline = 261;
+  static constexpr uint32_t renderHeight = 240;
+  static constexpr uint32_t renderWidth = 256;
+
+  // bits in control register
+  enum Control1Reg {
+    CONTROL_VRAM_ADDR_INC = 1 << 2,
+    CONTROL_PATTERN_TABLE_ADDR_SPR = 1 << 3,
+    CONTROL_PATTERN_TABLE_ADDR_SCR = 1 << 4,
+    CONTROL_SPRITE_SIZE = 1 << 5,
+    CONTROL_MASTER_SLAVE = 1 << 6,
+    CONTROL_NMI_ON_VBLANK = 1 << 7,
+  };
+
+  // bits in second control register
+  enum Control2Reg {
+    CONTROL2_EMPHASIS_MASK = 7 << 5,
+    CONTROL2_SPRITE_VISIBLE = 1 << 4,
+    CONTROL2_BKGD_VISIBLE = 1 << 3,
+    CONTROL2_SPRITE_CLIPPING = 1 << 2,
+    CONTROL2_BKGD_CLIPPING = 1 << 1,
+    CONTROL2_MONOCHROME_MODE = 1 << 0
+  };
+
+  // bits in status register
+  enum StatusReg {
+    STATUS_LOST_SPRITES = 1 << 5,
+    STATUS_SPRITE0_HIT = 1 << 6,
+    STATUS_VBLANK_HIT = 1 << 7
+  };
+
+  // ppu registers
+  enum {
+    CONTROL1_REG = 0,
+    CONTROL2_REG = 1,
+    STATUS_REG = 2,
+    SPR_ADDR_REG = 3,
+    SPR_DATA_REG = 4,
+    VRAM_ADDR_REG1 = 5,
+    VRAM_ADDR_REG2 = 6,
+    VRAM_DATA_REG = 7,
+    REG_COUNT = 8,
+  };
+
+  // Vram address decoding, shared with the renderers.
+  static uint16_t getTileAddr(uint16_t vramCurrent) { return 0x2000 | (vramCurrent & 0xfff); }
+  static uint32_t getFineY(uint16_t vramCurrent) { return (0x7000 & vramCurrent) >> 12; }
+  static uint16_t getAttrAddr(uint16_t vramCurrent) {
+    return 0x23c0 | (vramCurrent & 0xc00) | ((vramCurrent >> 4) & 0x38) |
+           ((vramCurrent >> 2) & 0x7);
+  }
+  static uint16_t coarseXInc(uint16_t vramCurrent);
+
+protected:
+  uint8_t getBgColor();
+  uint8_t getColor(uint32_t palette, uint32_t color, bool sprite);
+
+  uint16_t getSpritePatternTableAddr() const {
+    return (regs[CONTROL1_REG] & CONTROL_PATTERN_TABLE_ADDR_SPR) ? 0x1000 : 0x0;
+  }
+  uint16_t getBgPatternTableAddr() const {
+    return (regs[CONTROL1_REG] & CONTROL_PATTERN_TABLE_ADDR_SCR) ? 0x1000 : 0x0;
+  }
+  bool nmiOnVblank() const { return (regs[CONTROL1_REG] & CONTROL_NMI_ON_VBLANK) != 0; }
+  bool isSpriteSize8x8() const { return (regs[CONTROL1_REG] & CONTROL_SPRITE_SIZE) == 0; }
+  bool isMonochromeMode() const { return (regs[CONTROL2_REG] & CONTROL2_MONOCHROME_MODE) != 0; }
+  uint8_t getEmphasis() const { return (regs[CONTROL2_REG] & CONTROL2_EMPHASIS_MASK) >> 5; }
+  bool renderBackgroundEnabled() const { return (regs[CONTROL2_REG] & CONTROL2_BKGD_VISIBLE) != 0; }
+  bool renderSpritesEnabled() const { return (regs[CONTROL2_REG] & CONTROL2_SPRITE_VISIBLE) != 0; }
+  void setSprite0Hit() { regs[STATUS_REG] |= STATUS_SPRITE0_HIT; }
+  void clearSprite0Hit() { regs[STATUS_REG] &= ~STATUS_SPRITE0_HIT; }
+  void setLostSprites() { regs[STATUS_REG] |= STATUS_LOST_SPRITES; }
+  void clearLostSprites() { regs[STATUS_REG] &= ~STATUS_LOST_SPRITES; }
+  void setVblankFlag() { regs[STATUS_REG] |= STATUS_VBLANK_HIT; }
+  void clearVblankFlag() { regs[STATUS_REG] &= ~STATUS_VBLANK_HIT; }
+  void vramCoarseXInc();
+  void vramYInc();
+  void vramXReset();
+  void vramYReset();
+
+  uint8_t *getSpriteRamByte(uint8_t offset);
+  bool isFrameSkipped() const { return (frame % (frameskip + 1)) != 0; }
+  void advanceClock(uint64_t newCycle);
+  void endFrame();
+  void presentFrame();
+  void finishLine(uint32_t scanline);
+  uint16_t getVramAddrInc() const;
+  uint8_t load(uint16_t addr);
+  void store(uint16_t addr, uint8_t val);
+
+  // Register and savestate behaviour without any clocking. The engine is caught up by the caller.
+  void writeReg(uint32_t reg, uint8_t val);
+  uint8_t readReg(uint32_t reg);
+  void save(PpuState &pb);
+  void restore(const PpuState &pb);
+
+public:
+  bool isRequestingNmi();
+
+  // Render only one frame out of every frames + 1. Skipped frames still produce sprite 0 hits,
+  // lost sprites, vram address updates and scanline notifications, just no pixels.
+  void setFrameskip(uint32_t frames) { frameskip = frames; }
+
+  // Hold emulation to the ntsc frame rate in real time. Without it something else has to pace it,
+  // by default waiting for the audio device.
+  void setFramePacing(bool enabled);
+
+  // Indexed output of the frame being drawn. Lines it hasn't reached yet hold an older frame.
+  const FrameBuffer &getFrameBuffer() const { return *frameBuffer; }
+
+  PpuCore(Nes *parent, Sdl *disp);
+  PpuCore() = delete;
+  PpuCore(const PpuCore &) = delete;
+  ~PpuCore();
+
+protected:
+  bool nmiRequested = false;
+  Nes *nes;
+  Sdl *sdl;
+  uint64_t frame = 0;
+  uint32_t frameskip = 0;
+
+  // The ppu is emulated lazily. cycle is the dot the ppu has reached (currentScanline and lineClock
+  // track the same position), targetCycle is the dot the rest of the system has reached and
+  // nextEventCycle is the next dot the engine has to act on.
+  uint64_t cycle = 0;
+  uint64_t targetCycle = 0;
+  uint64_t nextEventCycle = 0;
+  uint32_t currentScanline = 0;
+  uint32_t lineClock = 0;
+  uint8_t regs[REG_COUNT] = {0};
+  enum SpriteAttr {
+    ATTR_VERT_FLIP = 1 << 7,
+    ATTR_HORIZ_FLI = 1 << 6,
+    ATTR_BG_PRIOR = 1 << 5,
+    ATTR_COLOR_MASK = 3 << 0,
+  };
+
+  // Oam is kept as one array per sprite field so a whole column can be scanned at once.
+  // spriteGeneration is bumped whenever oam or the sprite size changes.
+  static const int spriteRamSize = 64;
+  struct {
+    uint8_t yCoordMinus1[spriteRamSize];
+    uint8_t tileIndex[spriteRamSize];
+    uint8_t attr[spriteRamSize];
+    uint8_t xCoord[spriteRamSize];
+  } spriteRam = {{0}, {0}, {0}, {0}};
+  uint64_t spriteGeneration = 1;
+
+  uint32_t vramToggle = 0;
+  uint32_t vramFineXScroll = 0;
+  uint16_t vramCurrentAddr = 0;
+  uint16_t vramTempAddr = 0;
+
+  uint16_t vramMachineAddr = 0;
+  uint8_t vramReadLatch = 0;
+
+  uint32_t scrollingMachineState = 0;
+  uint8_t xScrollOrigin = 0;
+  uint8_t yScrollOrigin = 0;
+
+  bool framePacing = false;
+  double nextFrameTimeMs = 0.0;
+
+  // The frame being drawn, owned by sdl. Lines that weren't drawn by the end of the frame, e.g.
+  // with rendering off, are carried over from lastFrame, the frame presented before.
+  FrameBuffer *frameBuffer;
+  const FrameBuffer *lastFrame = nullptr;
+  bool linesDrawn[renderHeight] = {};
+};
+
+}; // namespace Rnes
+
+#endif
@@ -0,0 +1,429 @@
+//
+//  ppudot.cpp
+//  rnes
+//
+//
+
+#include <algorithm>
+#include <assert.h>
+#include <cstring>
+
+#include "framebuffer.h"
+#include "nes.h"
+#include "ppudot.h"
+#include "save.pb.h"
+
+// Dots within a scanline the pipeline acts on.
+static const uint32_t spriteFetchStartLineClock = 257;
+static const uint32_t spriteFetchEndLineClock = 320;
+static const uint32_t prefetchStartLineClock = 321;
+static const uint32_t prefetchEndLineClock = 336;
+static const uint32_t secondaryOamClearEndLineClock = 64;
+static const uint32_t spriteEvalStartLineClock = 65;
+static const uint32_t spriteEvalEndLineClock = 256;
+static const uint32_t vramYIncLineClock = 256;
+static const uint32_t vramXResetLineClock = 257;
+static const uint32_t vramYResetStartLineClock = 280;
+static const uint32_t vramYResetEndLineClock = 304;
+
+static uint8_t reverseBits(uint8_t b) {
+  b = (b & 0xf0) >> 4 | (b & 0x0f) << 4;
+  b = (b & 0xcc) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xaa) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+static void restoreBytes(const std::string &bytes, uint8_t *out, size_t size) {
+  memset(out, 0, size);
+  memcpy(out, bytes.data(), std::min(bytes.size(), size));
+}
+
+namespace Rnes {
+
+uint8_t DotEngine::fetch(uint16_t addr) {
+  bool a12 = (addr & 0x1000) != 0;
+  if (a12 and !a12High and cycle - a12LowCycle >= a12FilterDots) {
+    nes->notifyPpuA12Rise();
+  } else if (!a12 and a12High) {
+    a12LowCycle = cycle;
+  }
+  a12High = a12;
+  return load(addr);
+}
+
+void DotEngine::shiftBackground() {
+  bgPatternShiftLo <<= 1;
+  bgPatternShiftHi <<= 1;
+  bgAttrShiftLo <<= 1;
+  bgAttrShiftHi <<= 1;
+}
+
+void DotEngine::reloadBackground() {
+  bgPatternShiftLo = (bgPatternShiftLo & 0xff00) | patternLatchLo;
+  bgPatternShiftHi = (bgPatternShiftHi & 0xff00) | patternLatchHi;
+  bgAttrShiftLo = (bgAttrShiftLo & 0xff00) | ((attrLatch & 1) ? 0xff : 0);
+  bgAttrShiftHi = (bgAttrShiftHi & 0xff00) | ((attrLatch & 2) ? 0xff : 0);
+}
+
+void DotEngine::fetchBackground(uint32_t dot) {
+  // Each tile takes 8 dots: nametable, attribute, pattern low and pattern high, two dots apiece,
+  // then coarse x moves on to the next tile.
+  uint16_t patternAddr = getBgPatternTableAddr() + nameLatch * 16 + getFineY(vramCurrentAddr);
+  switch ((dot - 1) % 8) {
+  case 0:
+    nameLatch = fetch(getTileAddr(vramCurrentAddr));
+    break;
+  case 2:
+    attrLatch = fetch(getAttrAddr(vramCurrentAddr));
+    attrLatch >>= ((vramCurrentAddr >> 4) & 0x4) | (vramCurrentAddr & 0x2);
+    attrLatch &= 0x3;
+    break;
+  case 4:
+    patternLatchLo = fetch(patternAddr);
+    break;
+  case 6:
+    patternLatchHi = fetch(patternAddr + 8);
+    break;
+  case 7:
+    vramCoarseXInc();
+    break;
+  }
+}
+
+void DotEngine::clearSecondaryOam(uint32_t dot) {
+  // Odd dots read, even dots write 0xff.
+  if ((dot % 2) == 0) {
+    secondaryOam[dot / 2 - 1] = 0xff;
+  }
+}
+
+void DotEngine::nextEvaluatedSprite() {
+  evalSprite++;
+  if (evalSprite == spriteRamSize) {
+    evalSprite = 0;
+    evalDone = true;
+  }
+}
+
+void DotEngine::evaluateSprites(uint32_t scanline, uint32_t dot) {
+  if (dot == spriteEvalStartLineClock) {
+    evalSprite = 0;
+    evalByte = 0;
+    secondaryOamAddr = 0;
+    evalDone = false;
+    sprite0Next = false;
+  }
+
+  // Odd dots read oam, even dots write secondary oam.
+  if ((dot % 2) == 1) {
+    oamLatch = *getSpriteRamByte(evalSprite * 4 + evalByte);
+    return;
+  }
+  if (evalDone) {
+    return;
+  }
+
+  uint32_t spriteSize = isSpriteSize8x8() ? 8 : 16;
+  bool inRange = (scanline - oamLatch) < spriteSize;
+  if (secondaryOamAddr < secondaryOamSize) {
+    secondaryOam[secondaryOamAddr] = oamLatch;
+    if (evalByte == 0) {
+      if (inRange) {
+        sprite0Next = sprite0Next or evalSprite == 0;
+        secondaryOamAddr++;
+        evalByte = 1;
+      } else {
+        nextEvaluatedSprite();
+      }
+    } else {
+      secondaryOamAddr++;
+      evalByte = (evalByte + 1) % 4;
+      if (evalByte == 0) {
+        nextEvaluatedSprite();
+      }
+    }
+  } else if (inRange) {
+    setLostSprites();
+    evalDone = true;
+  } else {
+    // Once secondary oam is full the hardware increments the byte index along with the sprite
+    // index, so the overflow check looks at the wrong bytes.
+    evalByte = (evalByte + 1) % 4;
+    nextEvaluatedSprite();
+  }
+}
+
+uint16_t DotEngine::getSpritePatternAddr(uint32_t slot, uint32_t scanline) {
+  // Empty slots still fetch tile 0xff so a12 toggles the same way with or without sprites.
+  uint8_t tile = 0xff;
+  uint8_t attr = 0;
+  uint32_t row = 0;
+  if (slot < lineSpriteCount) {
+    row = scanline - secondaryOam[slot * 4];
+    tile = secondaryOam[slot * 4 + 1];
+    attr = secondaryOam[slot * 4 + 2];
+  }
+
+  if (isSpriteSize8x8()) {
+    if (attr & ATTR_VERT_FLIP) {
+      row = 7 - row;
+    }
+    return getSpritePatternTableAddr() + tile * 16 + (row & 0x7);
+  }
+  if (attr & ATTR_VERT_FLIP) {
+    row = 15 - row;
+  }
+  uint16_t patternTable = (tile & 1) ? 0x1000 : 0x0;
+  tile &= 0xfe;
+  if (row & 0x8) {
+    tile++;
+  }
+  return patternTable + tile * 16 + (row & 0x7);
+}
+
+void DotEngine::fetchSprites(uint32_t scanline, uint32_t dot) {
+  uint32_t slot = (dot - spriteFetchStartLineClock) / 8;
+  uint32_t phase = (dot - spriteFetchStartLineClock) % 8;
+  regs[SPR_ADDR_REG] = 0;
+
+  if (dot == spriteFetchStartLineClock) {
+    // The pre-render scanline doesn't evaluate, so nothing is shown on the first line.
+    bool preRender = scanline == preRenderScanline;
+    lineSpriteCount = preRender ? 0 : secondaryOamAddr / 4;
+    lineHasSprite0 = !preRender and sprite0Next;
+  }
+
+  bool used = slot < lineSpriteCount;
+  bool horizontalFlip = used and (secondaryOam[slot * 4 + 2] & ATTR_HORIZ_FLI) != 0;
+  uint8_t pattern;
+  switch (phase) {
+  case 0:
+  case 2:
+    // Garbage nametable fetches.
+    fetch(getTileAddr(vramCurrentAddr));
+    break;
+  case 4:
+    pattern = fetch(getSpritePatternAddr(slot, scanline));
+    spritePatternLo[slot] = !used ? 0 : horizontalFlip ? reverseBits(pattern) : pattern;
+    spriteAttr[slot] = used ? secondaryOam[slot * 4 + 2] : 0;
+    spriteX[slot] = used ? secondaryOam[slot * 4 + 3] : 0xff;
+    break;
+  case 6:
+    pattern = fetch(getSpritePatternAddr(slot, scanline) + 8);
+    spritePatternHi[slot] = !used ? 0 : horizontalFlip ? reverseBits(pattern) : pattern;
+    break;
+  }
+}
+
+void DotEngine::renderDot(uint32_t scanline, uint32_t dot) {
+  bool visible = scanline < renderHeight;
+  bool fetchDot = (dot >= 1 and dot <= renderWidth) or
+                  (dot >= prefetchStartLineClock and dot <= prefetchEndLineClock);
+  bool shiftDot = (dot >= 2 and dot <= renderWidth + 1) or
+                  (dot >= prefetchStartLineClock + 1 and dot <= prefetchEndLineClock + 1);
+
+  // The shifters move first, every 8th dot the freshly fetched tile drops into the low byte.
+  if (shiftDot) {
+    shiftBackground();
+    if (((dot - 1) % 8) == 0) {
+      reloadBackground();
+    }
+  }
+  if (fetchDot) {
+    fetchBackground(dot);
+  }
+  if (dot == prefetchEndLineClock + 1 or dot == prefetchEndLineClock + 3) {
+    // Unused nametable fetches at the end of the line.
+    nameLatch = fetch(getTileAddr(vramCurrentAddr));
+  }
+
+  if (dot == vramYIncLineClock) {
+    vramYInc();
+  } else if (dot == vramXResetLineClock) {
+    vramXReset();
+  } else if (scanline == preRenderScanline and dot >= vramYResetStartLineClock and
+             dot <= vramYResetEndLineClock) {
+    vramYReset();
+  }
+
+  if (visible and dot >= 1 and dot <= secondaryOamClearEndLineClock) {
+    clearSecondaryOam(dot);
+  } else if (visible and dot >= spriteEvalStartLineClock and dot <= spriteEvalEndLineClock) {
+    evaluateSprites(scanline, dot);
+  } else if (dot >= spriteFetchStartLineClock and dot <= spriteFetchEndLineClock) {
+    fetchSprites(scanline, dot);
+  }
+}
+
+void DotEngine::outputPixel(uint32_t scanline, uint32_t x) {
+  uint32_t bgColor = 0;
+  uint32_t bgPalette = 0;
+  if (renderBackgroundEnabled() and (x >= 8 or (regs[CONTROL2_REG] & CONTROL2_BKGD_CLIPPING))) {
+    uint32_t bit = 15 - vramFineXScroll;
+    bgColor = ((bgPatternShiftHi >> bit) & 1) << 1 | ((bgPatternShiftLo >> bit) & 1);
+    bgPalette = ((bgAttrShiftHi >> bit) & 1) << 1 | ((bgAttrShiftLo >> bit) & 1);
+  }
+
+  // The lowest numbered opaque sprite wins, then its priority bit decides against the background.
+  uint32_t spriteColor = 0;
+  uint32_t sprite = 0;
+  if (renderSpritesEnabled() and (x >= 8 or (regs[CONTROL2_REG] & CONTROL2_SPRITE_CLIPPING))) {
+    for (; sprite < lineSpriteCount; sprite++) {
+      uint32_t offset = x - spriteX[sprite];
+      if (offset < 8) {
+        uint32_t bit = 7 - offset;
+        spriteColor = ((spritePatternHi[sprite] >> bit) & 1) << 1 |
+                      ((spritePatternLo[sprite] >> bit) & 1);
+        if (spriteColor != 0) {
+          break;
+        }
+      }
+    }
+  }
+
+  if (spriteColor != 0 and bgColor != 0 and sprite == 0 and lineHasSprite0 and
+      x < renderWidth - 1) {
+    setSprite0Hit();
+  }
+
+  uint8_t pixel;
+  if (spriteColor != 0 and (bgColor == 0 or (spriteAttr[sprite] & ATTR_BG_PRIOR) == 0)) {
+    pixel = getColor(spriteAttr[sprite] & ATTR_COLOR_MASK, spriteColor, true);
+  } else {
+    pixel = getColor(bgPalette, bgColor, false);
+  }
+  if (!isFrameSkipped()) {
+    frameBuffer->getLine(scanline)[x] = FrameBuffer::makePixel(pixel, getEmphasis());
+    if (x == renderWidth - 1) {
+      finishLine(scanline);
+    }
+  }
+}
+
+void DotEngine::tick() {
+  uint32_t scanline = currentScanline;
+  uint32_t dot = lineClock;
+  bool visible = scanline < renderHeight;
+
+  if ((visible or scanline == preRenderScanline) and
+      (renderBackgroundEnabled() or renderSpritesEnabled())) {
+    renderDot(scanline, dot);
+  }
+  if (visible and dot >= 1 and dot <= renderWidth) {
+    outputPixel(scanline, dot - 1);
+  }
+
+  // set and unset vblank register
+  if (scanline == vblankScanline and dot == 1) {
+    setVblankFlag();
+    if (nmiOnVblank()) {
+      nmiRequested = true;
+    }
+  } else if (scanline == preRenderScanline and dot == 1) {
+    clearVblankFlag();
+    clearSprite0Hit();
+    clearLostSprites();
+  } else if (scanline == preRenderScanline and dot == (ticksPerScanline - 1)) {
+    endFrame();
+  }
+}
+
+// Every dot of the visible and pre-render scanlines is an event, vblank only has the flag.
+static uint32_t getNextEventLineClock(uint32_t scanline, uint32_t lineClock) {
+  if (scanline < PpuCore::renderHeight or scanline == PpuCore::preRenderScanline) {
+    return lineClock;
+  }
+  if (scanline == PpuCore::vblankScanline and lineClock <= 1) {
+    return 1;
+  }
+  return PpuCore::ticksPerScanline;
+}
+
+void DotEngine::scheduleNextEvent() {
+  uint64_t lineStart = cycle - lineClock;
+  uint32_t scanline = currentScanline;
+  uint32_t nextLineClock = getNextEventLineClock(scanline, lineClock);
+  while (nextLineClock == ticksPerScanline) {
+    lineStart += ticksPerScanline;
+    scanline = (scanline + 1) % totalScanlines;
+    nextLineClock = getNextEventLineClock(scanline, 0);
+  }
+  nextEventCycle = lineStart + nextLineClock;
+}
+
+void DotEngine::catchUp() {
+  while (nextEventCycle < targetCycle) {
+    advanceClock(nextEventCycle);
+    tick();
+    advanceClock(cycle + 1);
+    scheduleNextEvent();
+  }
+  advanceClock(targetCycle);
+}
+
+void DotEngine::save(PpuState &pb) {
+  PpuCore::save(pb);
+  PpuState_DotState *dot = pb.mutable_dot();
+  dot->set_bgpatternshiftlo(bgPatternShiftLo);
+  dot->set_bgpatternshifthi(bgPatternShiftHi);
+  dot->set_bgattrshiftlo(bgAttrShiftLo);
+  dot->set_bgattrshifthi(bgAttrShiftHi);
+  dot->set_namelatch(nameLatch);
+  dot->set_attrlatch(attrLatch);
+  dot->set_patternlatchlo(patternLatchLo);
+  dot->set_patternlatchhi(patternLatchHi);
+
+  dot->set_secondaryoam(secondaryOam, secondaryOamSize);
+  dot->set_oamlatch(oamLatch);
+  dot->set_evalsprite(evalSprite);
+  dot->set_evalbyte(evalByte);
+  dot->set_secondaryoamaddr(secondaryOamAddr);
+  dot->set_evaldone(evalDone);
+  dot->set_sprite0next(sprite0Next);
+
+  dot->set_linespritecount(lineSpriteCount);
+  dot->set_linehassprite0(lineHasSprite0);
+  dot->set_spritepatternlo(spritePatternLo, spritesPerLine);
+  dot->set_spritepatternhi(spritePatternHi, spritesPerLine);
+  dot->set_spriteattr(spriteAttr, spritesPerLine);
+  dot->set_spritex(spriteX, spritesPerLine);
+
+  dot->set_a12high(a12High);
+  dot->set_a12lowcycle(a12LowCycle);
+}
+
+void DotEngine::restore(const PpuState &pb) {
+  PpuCore::restore(pb);
+  const PpuState_DotState &dot = pb.dot();
+  bgPatternShiftLo = dot.bgpatternshiftlo();
+  bgPatternShiftHi = dot.bgpatternshifthi();
+  bgAttrShiftLo = dot.bgattrshiftlo();
+  bgAttrShiftHi = dot.bgattrshifthi();
+  nameLatch = dot.namelatch();
+  attrLatch = dot.attrlatch();
+  patternLatchLo = dot.patternlatchlo();
+  patternLatchHi = dot.patternlatchhi();
+
+  restoreBytes(dot.secondaryoam(), secondaryOam, secondaryOamSize);
+  oamLatch = dot.oamlatch();
+  evalSprite = dot.evalsprite();
+  evalByte = dot.evalbyte();
+  secondaryOamAddr = dot.secondaryoamaddr();
+  evalDone = dot.evaldone();
+  sprite0Next = dot.sprite0next();
+
+  lineSpriteCount = dot.linespritecount();
+  lineHasSprite0 = dot.linehassprite0();
+  restoreBytes(dot.spritepatternlo(), spritePatternLo, spritesPerLine);
+  restoreBytes(dot.spritepatternhi(), spritePatternHi, spritesPerLine);
+  restoreBytes(dot.spriteattr(), spriteAttr, spritesPerLine);
+  restoreBytes(dot.spritex(), spriteX, spritesPerLine);
+
+  a12High = dot.a12high();
+  a12LowCycle = dot.a12lowcycle();
+  scheduleNextEvent();
+}
+
+DotEngine::DotEngine(Nes *parent, Sdl *disp) : PpuCore{parent, disp} { scheduleNextEvent(); }
+
+}; // namespace Rnes
@@ -0,0 +1,86 @@
+//
+//  ppudot.h
+//  rnes
+//
+//
+
+#ifndef __PPUDOT_H__
+#define __PPUDOT_H__
+
+#include "ppucore.h"
+
+namespace Rnes {
+
+// The accurate engine. Every dot of the visible and pre-render scanlines is stepped through the
+// real fetch pipeline: background shift registers fed by nametable, attribute and pattern fetches,
+// sprite evaluation into secondary oam over dots 65-256 and sprite pattern fetches over dots
+// 257-320. Pattern fetches drive ppu address line 12, whose rising edges clock the mmc3 counter.
+class DotEngine : public PpuCore {
+  static const uint32_t secondaryOamSize = 32;
+  static const uint32_t spritesPerLine = 8;
+
+  // A rising edge of a12 only counts after it was low for this many dots, roughly the three cpu
+  // cycles the mmc3 filters on.
+  static const uint32_t a12FilterDots = 9;
+
+  uint8_t fetch(uint16_t addr);
+  void shiftBackground();
+  void reloadBackground();
+  void fetchBackground(uint32_t dot);
+  void clearSecondaryOam(uint32_t dot);
+  void evaluateSprites(uint32_t scanline, uint32_t dot);
+  void nextEvaluatedSprite();
+  uint16_t getSpritePatternAddr(uint32_t slot, uint32_t scanline);
+  void fetchSprites(uint32_t scanline, uint32_t dot);
+  void renderDot(uint32_t scanline, uint32_t dot);
+  void outputPixel(uint32_t scanline, uint32_t x);
+  void tick();
+
+protected:
+  void scheduleNextEvent();
+  void catchUp();
+  void save(PpuState &pb);
+  void restore(const PpuState &pb);
+
+  DotEngine(Nes *parent, Sdl *disp);
+
+public:
+  // Pixels come out of the fetch pipeline dot by dot, there is nothing to hand to a thread.
+  void setRenderThread(bool enabled) {}
+
+private:
+  // Background pipeline. The pattern and attribute shifters hold two tiles, the latches hold the
+  // tile being fetched.
+  uint16_t bgPatternShiftLo = 0;
+  uint16_t bgPatternShiftHi = 0;
+  uint16_t bgAttrShiftLo = 0;
+  uint16_t bgAttrShiftHi = 0;
+  uint8_t nameLatch = 0;
+  uint8_t attrLatch = 0;
+  uint8_t patternLatchLo = 0;
+  uint8_t patternLatchHi = 0;
+
+  // Sprite evaluation for the next scanline.
+  uint8_t secondaryOam[secondaryOamSize] = {0};
+  uint8_t oamLatch = 0;
+  uint32_t evalSprite = 0;
+  uint32_t evalByte = 0;
+  uint32_t secondaryOamAddr = 0;
+  bool evalDone = false;
+  bool sprite0Next = false;
+
+  // Sprite output units for the current scanline, patterns are stored already flipped.
+  uint32_t lineSpriteCount = 0;
+  bool lineHasSprite0 = false;
+  uint8_t spritePatternLo[spritesPerLine] = {0};
+  uint8_t spritePatternHi[spritesPerLine] = {0};
+  uint8_t spriteAttr[spritesPerLine] = {0};
+  uint8_t spriteX[spritesPerLine] = {0};
+
+  bool a12High = false;
+  uint64_t a12LowCycle = 0;
+};
+
+}; // namespace Rnes
+
+#endif
@@ -0,0 +1,354 @@
+//
+//  ppurender.cpp
+//  rnes
+//
+//
+
+#include <algorithm>
+#include <assert.h>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "nes.h"
+#include "ppucore.h"
+#include "ppurender.h"
+
+static const uint16_t paletteAddr = 0x3f00;
+static const uint32_t paletteSize = 0x20;
+static const uint32_t patternTableSize = 0x1000;
+
+namespace Rnes {
+
+uint8_t LiveVideoMemory::load(uint16_t addr) const { return nes->vidMemRead(addr); }
+
+void VideoMemorySnapshot::capture(Nes *nes) {
+  for (uint32_t i = 0; i < vramSize; i++) {
+    vram[i] = nes->vidMemRead(i);
+  }
+  for (uint32_t i = 0; i < paletteSize; i++) {
+    palette[i] = nes->vidMemRead(paletteAddr + i);
+  }
+}
+
+template <class Memory>
+uint16_t ScanlineRenderer<Memory>::loadPatternTile(const Memory &memory, uint16_t addr) {
+  uint16_t ret = 0;
+  uint16_t a = memory.load(addr);
+  uint16_t b = memory.load(addr + 8);
+  for (uint32_t i = 0; i < 8; i++) {
+    ret |= ((1u << i) & a) << i;
+    ret |= ((1u << i) & b) << (i + 1);
+  }
+  return ret;
+}
+
+template <class Memory>
+template <bool is8x16>
+uint16_t ScanlineRenderer<Memory>::loadSpriteTile(const Memory &memory, uint8_t control1,
+                                                  const ScanlineSnapshot::Sprite &sprite,
+                                                  uint32_t scanline) {
+  const uint32_t spriteSize = is8x16 ? 16 : 8;
+  bool spriteVerticalFlip = (sprite.attr & (1u << 7)) != 0;
+  bool spriteHorizontalFlip = (sprite.attr & (1u << 6)) != 0;
+
+  uint32_t spriteLine = scanline - (sprite.yCoordMinus1 + 1);
+  assert(spriteLine < spriteSize);
+  if (spriteVerticalFlip) {
+    spriteLine = spriteSize - 1 - spriteLine;
+  }
+
+  // 8x16 sprites take their pattern table from bit 0 of the tile index and stack two tiles.
+  uint16_t patternTable;
+  uint32_t tile = sprite.tileIndex;
+  if (!is8x16) {
+    patternTable = (control1 & PpuCore::CONTROL_PATTERN_TABLE_ADDR_SPR) ? 0x1000 : 0x0;
+  } else {
+    patternTable = (tile & 1) ? 0x1000 : 0x0;
+    tile = (tile & ~1u) + (spriteLine >> 3);
+    spriteLine &= 7;
+  }
+  uint16_t pattern = loadPatternTile(memory, patternTable + 16 * tile + spriteLine);
+
+  // Mirror the row by reversing the order of the 2 bit pixels.
+  if (spriteHorizontalFlip) {
+    pattern = (pattern >> 8) | (pattern << 8);
+    pattern = ((pattern & 0xf0f0) >> 4) | ((pattern & 0x0f0f) << 4);
+    pattern = ((pattern & 0xcccc) >> 2) | ((pattern & 0x3333) << 2);
+  }
+  return pattern;
+}
+
+template <class Memory>
+uint16_t ScanlineRenderer<Memory>::loadSpriteTile(const Memory &memory, uint8_t control1,
+                                                  const ScanlineSnapshot::Sprite &sprite,
+                                                  uint32_t scanline) {
+  if (control1 & PpuCore::CONTROL_SPRITE_SIZE) {
+    return loadSpriteTile<true>(memory, control1, sprite, scanline);
+  }
+  return loadSpriteTile<false>(memory, control1, sprite, scanline);
+}
+
+template <class Memory>
+void ScanlineRenderer<Memory>::decodeBackground(const Memory &memory,
+                                                const ScanlineSnapshot &line) {
+  uint32_t patternTableAddr =
+      (line.control1 & PpuCore::CONTROL_PATTERN_TABLE_ADDR_SCR) ? 0x1000 : 0x0;
+  uint16_t vramAddr = line.vramAddr;
+
+  // Whole tiles are decoded, a fine x scroll pulls in part of a 33rd one.
+  uint32_t tileCount = line.fineX ? 33 : 32;
+  for (uint32_t tile = 0; tile < tileCount; tile++) {
+    // Get next tile and attribute addresses
+    uint16_t nameAddr = PpuCore::getTileAddr(vramAddr);
+    uint16_t attrAddr = PpuCore::getAttrAddr(vramAddr);
+
+    // Load attribute and pattern
+    uint16_t patternAddr =
+        memory.load(nameAddr) * 16 + patternTableAddr + PpuCore::getFineY(vramAddr);
+    assert(patternAddr >= patternTableAddr and
+           patternAddr < (patternTableAddr + patternTableSize));
+    uint16_t pattern = loadPatternTile(memory, patternAddr);
+    uint8_t attr = memory.load(attrAddr);
+    uint32_t tileOffsetY = ((nameAddr & 0x3ff) >> 5 >> 1) % 2;
+    uint32_t tileOffsetX = (((nameAddr & 0x3ff) & 0x1f) >> 1) % 2;
+    uint32_t subNibble = tileOffsetX + tileOffsetY * 2;
+    uint8_t palette = ((attr >> (2 * subNibble)) & 0x3) << 2;
+
+    // Transparent pixels all show the backdrop at palette index 0.
+    uint8_t *out = bgTiles + tile * 8;
+    for (uint32_t i = 0; i < 8; i++) {
+      uint8_t color = (pattern >> ((7 - i) * 2)) & 0x3;
+      out[i] = color ? (palette | color) : 0;
+    }
+    vramAddr = PpuCore::coarseXInc(vramAddr);
+  }
+  bgLine = bgTiles + line.fineX;
+}
+
+template <class Memory>
+template <bool is8x16>
+void ScanlineRenderer<Memory>::decodeSprites(const Memory &memory, const ScanlineSnapshot &line,
+                                             uint32_t scanline) {
+  // Sprites come front to back, so a pixel keeps the first opaque sprite that lands on it no
+  // matter what its priority bit says. That sprite alone is then merged with the background.
+  memset(spriteLine, 0, sizeof(spriteLine));
+  for (uint32_t i = 0; i < line.spriteCount; i++) {
+    const ScanlineSnapshot::Sprite &sprite = line.sprites[i];
+    uint16_t pattern = loadSpriteTile<is8x16>(memory, line.control1, sprite, scanline);
+    uint8_t flags = 0x10 | ((sprite.attr & 0x3) << 2);
+    flags |= (sprite.attr & (1u << 5)) ? spriteBehindFlag : 0;
+    flags |= (sprite.index == 0) ? sprite0Flag : 0;
+    uint32_t pixels = std::min(8u, FrameBuffer::width - sprite.xCoord);
+    uint8_t *out = spriteLine + sprite.xCoord;
+    for (uint32_t j = 0; j < pixels; j++) {
+      uint8_t color = (pattern >> ((7 - j) * 2)) & 0x3;
+      if (color and !out[j]) {
+        out[j] = flags | color;
+      }
+    }
+  }
+}
+
+template <class Memory> template <uint32_t mode> bool ScanlineRenderer<Memory>::merge() {
+  // Picks the palette index of every pixel and looks for sprite 0 hits in one pass. A sprite pixel
+  // shows unless it is transparent or sits behind an opaque background pixel. Either layer can be
+  // clipped from the leftmost 8 pixels, and sprite 0 never hits on the last pixel.
+  const uint32_t renderWidth = FrameBuffer::width;
+  constexpr bool sprites = (mode & MODE_SPRITES) != 0;
+  constexpr bool clipBg = (mode & MODE_BACKGROUND_LEFT) == 0;
+  constexpr bool clipSprites = (mode & MODE_SPRITES_LEFT) == 0;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i indexMask = _mm_set1_epi8(0x1f);
+  const __m128i behindMask = _mm_set1_epi8(spriteBehindFlag);
+  const __m128i sprite0Mask = _mm_set1_epi8(sprite0Flag);
+  const __m128i left = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0);
+  uint32_t hits = 0;
+  for (uint32_t x = 0; x < renderWidth; x += 16) {
+    __m128i bg = _mm_loadu_si128((const __m128i *)(bgLine + x));
+    if (clipBg and x == 0) {
+      bg = _mm_andnot_si128(left, bg);
+    }
+    if (!sprites) {
+      _mm_store_si128((__m128i *)(mergedLine + x), bg);
+      continue;
+    }
+    __m128i sprite = _mm_load_si128((const __m128i *)(spriteLine + x));
+    if (clipSprites and x == 0) {
+      sprite = _mm_andnot_si128(left, sprite);
+    }
+    __m128i bgClear = _mm_cmpeq_epi8(bg, zero);
+    __m128i spriteIndex = _mm_and_si128(sprite, indexMask);
+    __m128i behind = _mm_cmpeq_epi8(_mm_and_si128(sprite, behindMask), behindMask);
+    __m128i hidden =
+        _mm_or_si128(_mm_cmpeq_epi8(spriteIndex, zero), _mm_andnot_si128(bgClear, behind));
+    __m128i merged = _mm_or_si128(_mm_and_si128(hidden, bg), _mm_andnot_si128(hidden, spriteIndex));
+    _mm_store_si128((__m128i *)(mergedLine + x), merged);
+
+    __m128i sprite0 = _mm_cmpeq_epi8(_mm_and_si128(sprite, sprite0Mask), sprite0Mask);
+    uint32_t lineHits = _mm_movemask_epi8(_mm_andnot_si128(bgClear, sprite0));
+    if (x + 16 == renderWidth) {
+      lineHits &= 0x7fff;
+    }
+    hits |= lineHits;
+  }
+  return hits != 0;
+#else
+  bool sprite0Hit = false;
+  for (uint32_t x = 0; x < renderWidth; x++) {
+    uint8_t bg = (x >= 8 or !clipBg) ? bgLine[x] : 0;
+    if (!sprites) {
+      mergedLine[x] = bg;
+      continue;
+    }
+    uint8_t sprite = (x >= 8 or !clipSprites) ? spriteLine[x] : 0;
+    uint8_t spriteIndex = sprite & 0x1f;
+    bool hidden = spriteIndex == 0 or (bg != 0 and (sprite & spriteBehindFlag));
+    mergedLine[x] = hidden ? bg : spriteIndex;
+    if ((sprite & sprite0Flag) and bg != 0 and x < renderWidth - 1) {
+      sprite0Hit = true;
+    }
+  }
+  return sprite0Hit;
+#endif
+}
+
+template <class Memory>
+template <uint32_t mode>
+bool ScanlineRenderer<Memory>::renderMode(const Memory &memory, const ScanlineSnapshot &line,
+                                          uint32_t scanline, FrameBuffer::Pixel *out) {
+  const uint32_t renderWidth = FrameBuffer::width;
+  constexpr bool background = (mode & MODE_BACKGROUND) != 0;
+
+  if (background) {
+    decodeBackground(memory, line);
+  } else {
+    memset(bgTiles, 0, sizeof(bgTiles));
+    bgLine = bgTiles;
+  }
+  if (mode & MODE_SPRITES) {
+    decodeSprites<(mode & MODE_SPRITES_8X16) != 0>(memory, line, scanline);
+  }
+  bool sprite0Hit = merge<mode>();
+
+  // Palette, emphasis and monochrome mode are constant for the whole line, so the 32 palette
+  // entries are resolved to pixels once and the merged line is just looked up.
+  uint8_t emphasis = (line.control2 & PpuCore::CONTROL2_EMPHASIS_MASK) >> 5;
+  constexpr uint8_t colorMask = (mode & MODE_MONOCHROME) ? 0x30 : 0x3f;
+  FrameBuffer::Pixel colors[paletteSize];
+  for (uint32_t i = 0; i < paletteSize; i++) {
+    colors[i] = FrameBuffer::makePixel(memory.load(paletteAddr + i) & colorMask, emphasis);
+  }
+  if (!background) {
+    colors[0] = FrameBuffer::makePixel(FrameBuffer::blackIndex, emphasis);
+  }
+  for (uint32_t x = 0; x < renderWidth; x++) {
+    out[x] = colors[mergedLine[x]];
+  }
+  return sprite0Hit;
+}
+
+template <class Memory>
+template <size_t... modes>
+constexpr std::array<typename ScanlineRenderer<Memory>::RenderFn,
+                     ScanlineRenderer<Memory>::MODE_COUNT>
+ScanlineRenderer<Memory>::makeRenderers(std::index_sequence<modes...>) {
+  return {{&ScanlineRenderer::renderMode<modes>...}};
+}
+
+template <class Memory>
+const std::array<typename ScanlineRenderer<Memory>::RenderFn, ScanlineRenderer<Memory>::MODE_COUNT>
+    ScanlineRenderer<Memory>::renderers = makeRenderers(std::make_index_sequence<MODE_COUNT>{});
+
+template <class Memory>
+bool ScanlineRenderer<Memory>::render(const Memory &memory, const ScanlineSnapshot &line,
+                                      uint32_t scanline, FrameBuffer::Pixel *out) {
+  uint32_t mode = 0;
+  mode |= (line.control2 & PpuCore::CONTROL2_BKGD_VISIBLE) ? MODE_BACKGROUND : 0;
+  mode |= (line.control2 & PpuCore::CONTROL2_SPRITE_VISIBLE) ? MODE_SPRITES : 0;
+  mode |= (line.control1 & PpuCore::CONTROL_SPRITE_SIZE) ? MODE_SPRITES_8X16 : 0;
+  mode |= (line.control2 & PpuCore::CONTROL2_MONOCHROME_MODE) ? MODE_MONOCHROME : 0;
+  mode |= (line.control2 & PpuCore::CONTROL2_BKGD_CLIPPING) ? MODE_BACKGROUND_LEFT : 0;
+  mode |= (line.control2 & PpuCore::CONTROL2_SPRITE_CLIPPING) ? MODE_SPRITES_LEFT : 0;
+  return (this->*renderers[mode])(memory, line, scanline, out);
+}
+
+template class ScanlineRenderer<LiveVideoMemory>;
+template class ScanlineRenderer<VideoMemorySnapshot>;
+
+VideoMemorySnapshot &RenderFrame::addMemory() {
+  if (memoryCount == memories.size()) {
+    memories.emplace_back(new VideoMemorySnapshot{});
+  }
+  return *memories[memoryCount++];
+}
+
+void RenderFrame::clear() {
+  std::fill(rendered, rendered + FrameBuffer::height, false);
+  memoryCount = 0;
+}
+
+void RenderThread::main() {
+  std::unique_lock<std::mutex> guard(lock);
+  while (true) {
+    cond.wait(guard, [this] { return busy or quit; });
+    if (quit) {
+      return;
+    }
+    guard.unlock();
+
+    for (uint32_t y = 0; y < FrameBuffer::height; y++) {
+      if (workFrame->rendered[y]) {
+        const VideoMemorySnapshot &memory = *workFrame->memories[workFrame->lineMemory[y]];
+        renderer.render(memory, workFrame->lines[y], y, target->getLine(y));
+        target->finishLine(y);
+      }
+    }
+
+    guard.lock();
+    busy = false;
+    cond.notify_all();
+  }
+}
+
+void RenderThread::finish() {
+  std::unique_lock<std::mutex> guard(lock);
+  cond.wait(guard, [this] { return !busy; });
+}
+
+void RenderThread::start(FrameBuffer *frame) {
+  std::lock_guard<std::mutex> guard(lock);
+  assert(!busy);
+  target = frame;
+  std::swap(recordFrame, workFrame);
+  recordFrame->clear();
+  busy = true;
+  cond.notify_all();
+}
+
+void RenderThread::reset() {
+  std::unique_lock<std::mutex> guard(lock);
+  cond.wait(guard, [this] { return !busy; });
+  recordFrame->clear();
+}
+
+RenderThread::RenderThread()
+    : recordFrame{new RenderFrame{}}, workFrame{new RenderFrame{}} {
+  recordFrame->clear();
+  workFrame->clear();
+  thread = std::thread(&RenderThread::main, this);
+}
+
+RenderThread::~RenderThread() {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    quit = true;
+    cond.notify_all();
+  }
+  thread.join();
+}
+
+}; // namespace Rnes
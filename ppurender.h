@@ -0,0 +1,168 @@
+//
+//  ppurender.h
+//  rnes
+//
+//
+
+#ifndef __PPURENDER_H__
+#define __PPURENDER_H__
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "framebuffer.h"
+
+namespace Rnes {
+
+class Nes;
+
+// The registers and sprites one scanline is rasterized from.
+struct ScanlineSnapshot {
+  static const uint32_t spriteCapacity = 8;
+  struct Sprite {
+    uint8_t index;
+    uint8_t yCoordMinus1;
+    uint8_t tileIndex;
+    uint8_t attr;
+    uint8_t xCoord;
+  };
+
+  uint16_t vramAddr;
+  uint8_t fineX;
+  uint8_t control1;
+  uint8_t control2;
+  // Sprites hitting the line in oam order, front to back.
+  uint8_t spriteCount;
+  Sprite sprites[spriteCapacity];
+};
+
+// Video memory read through the mapper, for rendering on the emulation thread.
+class LiveVideoMemory {
+  Nes *nes;
+
+public:
+  uint8_t load(uint16_t addr) const;
+  explicit LiveVideoMemory(Nes *parent) : nes{parent} {}
+};
+
+// A copy of everything the renderer reads: pattern tables and nametables as the mapper presents
+// them, plus the palette.
+class VideoMemorySnapshot {
+  static const uint32_t vramSize = 0x3000;
+  static const uint32_t paletteSize = 0x20;
+  uint8_t vram[vramSize];
+  uint8_t palette[paletteSize];
+
+public:
+  void capture(Nes *nes);
+  uint8_t load(uint16_t addr) const { return addr < vramSize ? vram[addr] : palette[addr & 0x1f]; }
+};
+
+template <class Memory> class ScanlineRenderer {
+  // Sprite line buffer entries: the palette index in the low 5 bits, 0 where no sprite is opaque.
+  static const uint8_t spriteBehindFlag = 1 << 5;
+  static const uint8_t sprite0Flag = 1 << 6;
+
+  // Everything in the control registers that changes what the inner loops do. Each combination
+  // gets its own specialized renderer, picked once per line.
+  enum RenderMode : uint32_t {
+    MODE_BACKGROUND = 1 << 0,
+    MODE_SPRITES = 1 << 1,
+    MODE_SPRITES_8X16 = 1 << 2,
+    MODE_MONOCHROME = 1 << 3,
+    MODE_BACKGROUND_LEFT = 1 << 4,
+    MODE_SPRITES_LEFT = 1 << 5,
+    MODE_COUNT = 1 << 6,
+  };
+  typedef bool (ScanlineRenderer::*RenderFn)(const Memory &memory, const ScanlineSnapshot &line,
+                                             uint32_t scanline, FrameBuffer::Pixel *out);
+  template <size_t... modes>
+  static constexpr std::array<RenderFn, MODE_COUNT> makeRenderers(std::index_sequence<modes...>);
+  static const std::array<RenderFn, MODE_COUNT> renderers;
+
+  template <bool is8x16>
+  static uint16_t loadSpriteTile(const Memory &memory, uint8_t control1,
+                                 const ScanlineSnapshot::Sprite &sprite, uint32_t scanline);
+  void decodeBackground(const Memory &memory, const ScanlineSnapshot &line);
+  template <bool is8x16>
+  void decodeSprites(const Memory &memory, const ScanlineSnapshot &line, uint32_t scanline);
+  template <uint32_t mode> bool merge();
+  template <uint32_t mode>
+  bool renderMode(const Memory &memory, const ScanlineSnapshot &line, uint32_t scanline,
+                  FrameBuffer::Pixel *out);
+
+  // Palette indices for the line. The background line holds one extra tile so a fine x scroll can
+  // start mid tile, line pixels begin at bgTiles[fineX].
+  alignas(16) uint8_t bgTiles[FrameBuffer::width + 8];
+  alignas(16) uint8_t spriteLine[FrameBuffer::width];
+  alignas(16) uint8_t mergedLine[FrameBuffer::width];
+  const uint8_t *bgLine = bgTiles;
+
+public:
+  // Pattern helpers, also used on the emulation thread for sprite 0 hits of lines that aren't
+  // rasterized there. Both return the 8 pixels of a row as 2 bit colors, leftmost in the top bits.
+  static uint16_t loadPatternTile(const Memory &memory, uint16_t addr);
+  static uint16_t loadSpriteTile(const Memory &memory, uint8_t control1,
+                                 const ScanlineSnapshot::Sprite &sprite, uint32_t scanline);
+
+  // Rasterizes one scanline into out. Returns true if sprite 0 hit the background.
+  bool render(const Memory &memory, const ScanlineSnapshot &line, uint32_t scanline,
+              FrameBuffer::Pixel *out);
+};
+
+// One frame worth of scanline snapshots. Each rendered line points at the video memory copy that
+// was current when it was recorded; copies are only taken when video memory changed.
+struct RenderFrame {
+  ScanlineSnapshot lines[FrameBuffer::height];
+  bool rendered[FrameBuffer::height];
+  uint32_t lineMemory[FrameBuffer::height];
+  std::vector<std::unique_ptr<VideoMemorySnapshot>> memories;
+  uint32_t memoryCount = 0;
+
+  VideoMemorySnapshot &addMemory();
+  void clear();
+};
+
+// Rasterizes recorded frames on a worker thread while the emulation thread runs the next one.
+class RenderThread {
+  std::thread thread;
+  std::mutex lock;
+  std::condition_variable cond;
+  bool busy = false;
+  bool quit = false;
+
+  std::unique_ptr<RenderFrame> recordFrame;
+  std::unique_ptr<RenderFrame> workFrame;
+  FrameBuffer *target = nullptr;
+  ScanlineRenderer<VideoMemorySnapshot> renderer;
+
+  void main();
+
+public:
+  RenderFrame &getRecordFrame() { return *recordFrame; }
+
+  // Waits for the frame in flight. Only its recorded lines were drawn, the others still hold
+  // whatever was there.
+  void finish();
+  bool isLineRendered(uint32_t y) const { return workFrame->rendered[y]; }
+
+  // Starts drawing the recorded frame into frame, which nothing else may touch until finish().
+  void start(FrameBuffer *frame);
+
+  // Waits for the frame in flight and drops the recorded one.
+  void reset();
+
+  RenderThread();
+  RenderThread(const RenderThread &) = delete;
+  ~RenderThread();
+};
+
+}; // namespace Rnes
+
+#endif
@@ -0,0 +1,306 @@
+//
+//  ppuscanline.cpp
+//  rnes
+//
+//
+
+#include <algorithm>
+#include <assert.h>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "framebuffer.h"
+#include "nes.h"
+#include "ppurender.h"
+#include "ppuscanline.h"
+#include "save.pb.h"
+
+// Dots within a scanline that tick() acts on.
+static const uint32_t renderLineClock = 255;
+static const uint32_t vramYIncLineClock = 256;
+static const uint32_t vramXResetLineClock = 257;
+static const uint32_t vramYResetStartLineClock = 280;
+static const uint32_t vramYResetEndLineClock = 304;
+
+namespace Rnes {
+
+uint64_t ScanlineEngine::getSpritesOnScanline(uint32_t scanline, uint32_t spriteSize) const {
+  // Bit n is set when sprite n covers the scanline, i.e. 0 <= scanline - (y + 1) < spriteSize.
+  uint64_t mask = 0;
+#if defined(__SSE2__)
+  // Compare in 16 bit lanes so y + 1 can't wrap around.
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i line = _mm_set1_epi16(scanline - 1);
+  const __m128i size = _mm_set1_epi16(spriteSize);
+  const __m128i negOne = _mm_set1_epi16(-1);
+  for (uint32_t i = 0; i < spriteRamSize; i += 16) {
+    __m128i y = _mm_loadu_si128((const __m128i *)&spriteRam.yCoordMinus1[i]);
+    __m128i diffLo = _mm_sub_epi16(line, _mm_unpacklo_epi8(y, zero));
+    __m128i diffHi = _mm_sub_epi16(line, _mm_unpackhi_epi8(y, zero));
+    __m128i hitLo = _mm_and_si128(_mm_cmpgt_epi16(diffLo, negOne), _mm_cmplt_epi16(diffLo, size));
+    __m128i hitHi = _mm_and_si128(_mm_cmpgt_epi16(diffHi, negOne), _mm_cmplt_epi16(diffHi, size));
+    uint64_t hits = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(hitLo, hitHi));
+    mask |= hits << i;
+  }
+#else
+  for (uint32_t i = 0; i < spriteRamSize; i++) {
+    if ((scanline >= (spriteRam.yCoordMinus1[i] + 1u)) and
+        (scanline <= (spriteRam.yCoordMinus1[i] + 1u + spriteSize - 1u))) {
+      mask |= 1ull << i;
+    }
+  }
+#endif
+  return mask;
+}
+
+const ScanlineEngine::SpriteLine &ScanlineEngine::getSpriteLine(uint32_t scanline) {
+  assert(scanline < spriteLineCount);
+  SpriteLine &line = spriteLines[scanline];
+  if (line.generation == spriteGeneration) {
+    return line;
+  }
+
+  // Like the hardware, the first eight sprites in oam order make it onto the line.
+  uint64_t mask = getSpritesOnScanline(scanline, isSpriteSize8x8() ? 8 : 16);
+  line.count = 0;
+  while (mask and line.count < spriteLineCapacity) {
+    uint32_t sprite = __builtin_ctzll(mask);
+    line.sprites[line.count++] = sprite;
+    mask &= mask - 1;
+  }
+  line.lostSprites = mask != 0;
+  line.generation = spriteGeneration;
+  return line;
+}
+
+ScanlineSnapshot::Sprite ScanlineEngine::getSprite(uint32_t sprite) const {
+  return {(uint8_t)sprite, spriteRam.yCoordMinus1[sprite], spriteRam.tileIndex[sprite],
+          spriteRam.attr[sprite], spriteRam.xCoord[sprite]};
+}
+
+void ScanlineEngine::snapshotLine(uint32_t scanline, ScanlineSnapshot &line) {
+  line.vramAddr = vramCurrentAddr;
+  line.fineX = vramFineXScroll;
+  line.control1 = regs[CONTROL1_REG];
+  line.control2 = regs[CONTROL2_REG];
+  line.spriteCount = 0;
+  if (renderSpritesEnabled()) {
+    const SpriteLine &sprites = getSpriteLine(scanline);
+    for (uint32_t i = 0; i < sprites.count; i++) {
+      line.sprites[line.spriteCount++] = getSprite(sprites.sprites[i]);
+    }
+  }
+}
+
+void ScanlineEngine::render(uint32_t scanline) {
+  ScanlineSnapshot line;
+  snapshotLine(scanline, line);
+  LiveVideoMemory memory{nes};
+  if (lineRenderer.render(memory, line, scanline, frameBuffer->getLine(scanline))) {
+    setSprite0Hit();
+  }
+  finishLine(scanline);
+  if (renderSpritesEnabled() and getSpriteLine(scanline).lostSprites) {
+    setLostSprites();
+  }
+
+  // The background walked coarse x across 32 tiles, or 33 when fine x splits the first one.
+  uint32_t tiles = vramFineXScroll ? 33 : 32;
+  for (uint32_t i = 0; i < tiles; i++) {
+    vramCoarseXInc();
+  }
+}
+
+void ScanlineEngine::recordLine(uint32_t scanline) {
+  // Video memory is copied for the render thread only when it changed since the last copy.
+  RenderFrame &recording = renderThread->getRecordFrame();
+  uint64_t generation = nes->getVideoMemoryGeneration();
+  if (recording.memoryCount == 0 or generation != recordedGeneration) {
+    recording.addMemory().capture(nes);
+    recordedGeneration = generation;
+  }
+  snapshotLine(scanline, recording.lines[scanline]);
+  recording.lineMemory[scanline] = recording.memoryCount - 1;
+  recording.rendered[scanline] = true;
+}
+
+void ScanlineEngine::skipRender(uint32_t scanline) {
+  // Only the state a game can observe is computed: lost sprites, sprite 0 hit and the vram address
+  // walk. The background is only fetched underneath sprite 0.
+  LiveVideoMemory memory{nes};
+  bool sprite0OnLine = false;
+  uint16_t sprite0Pattern = 0;
+  if (renderSpritesEnabled()) {
+    const SpriteLine &line = getSpriteLine(scanline);
+    if (line.count and line.sprites[0] == 0) {
+      sprite0OnLine = true;
+      sprite0Pattern = ScanlineRenderer<LiveVideoMemory>::loadSpriteTile(
+          memory, regs[CONTROL1_REG], getSprite(0), scanline);
+    }
+    if (line.lostSprites) {
+      setLostSprites();
+    }
+  }
+
+  if (!renderBackgroundEnabled()) {
+    return;
+  }
+  // With either layer clipped there are no hits in the leftmost 8 pixels.
+  uint32_t firstHitX = 0;
+  if ((regs[CONTROL2_REG] & (CONTROL2_BKGD_CLIPPING | CONTROL2_SPRITE_CLIPPING)) !=
+      (CONTROL2_BKGD_CLIPPING | CONTROL2_SPRITE_CLIPPING)) {
+    firstHitX = 8;
+  }
+  uint32_t patternTableAddr = getBgPatternTableAddr();
+  uint32_t sprite0X = spriteRam.xCoord[0];
+  uint32_t tempFineXScroll = vramFineXScroll;
+  for (uint32_t xBgOffset = 0; xBgOffset < renderWidth;) {
+    uint32_t tilePixels = std::min(8 - tempFineXScroll, renderWidth - xBgOffset);
+    if (sprite0OnLine and xBgOffset < sprite0X + 8 and sprite0X < xBgOffset + tilePixels) {
+      uint16_t nameAddr = getTileAddr(vramCurrentAddr);
+      uint16_t patternAddr = load(nameAddr) * 16 + patternTableAddr + getFineY(vramCurrentAddr);
+      uint16_t pattern = ScanlineRenderer<LiveVideoMemory>::loadPatternTile(memory, patternAddr);
+      for (uint32_t i = 0; i < tilePixels; i++) {
+        uint32_t x = xBgOffset + i;
+        uint32_t color = (pattern >> ((7 - (tempFineXScroll + i)) * 2)) & 0x3;
+        if (x < sprite0X or x >= sprite0X + 8 or x < firstHitX or x >= renderWidth - 1) {
+          continue;
+        }
+        uint32_t sprite0Color = (sprite0Pattern >> ((7 - (x - sprite0X)) * 2)) & 0x3;
+        if (color != 0 and sprite0Color != 0) {
+          setSprite0Hit();
+        }
+      }
+    }
+    xBgOffset += tilePixels;
+    tempFineXScroll = 0;
+    vramCoarseXInc();
+  }
+}
+
+// Returns the first dot at or after lineClock that tick() has work to do on, or ticksPerScanline if
+// the rest of the scanline is idle.
+static uint32_t getNextEventLineClock(uint32_t scanline, uint32_t lineClock) {
+  bool preRender = scanline == PpuCore::preRenderScanline;
+  if ((scanline == PpuCore::vblankScanline or preRender) and lineClock == 0) {
+    return 0;
+  }
+  if (scanline < PpuCore::renderHeight and lineClock <= vramXResetLineClock) {
+    return std::max(lineClock, renderLineClock);
+  }
+  if (preRender) {
+    if (lineClock <= vramXResetLineClock) {
+      return std::max(lineClock, vramYIncLineClock);
+    } else if (lineClock <= vramYResetEndLineClock) {
+      return std::max(lineClock, vramYResetStartLineClock);
+    }
+    return PpuCore::ticksPerScanline - 1;
+  }
+  return PpuCore::ticksPerScanline;
+}
+
+void ScanlineEngine::scheduleNextEvent() {
+  uint64_t lineStart = cycle - lineClock;
+  uint32_t scanline = currentScanline;
+  uint32_t nextLineClock = getNextEventLineClock(scanline, lineClock);
+  while (nextLineClock == ticksPerScanline) {
+    lineStart += ticksPerScanline;
+    scanline = (scanline + 1) % totalScanlines;
+    nextLineClock = getNextEventLineClock(scanline, 0);
+  }
+  nextEventCycle = lineStart + nextLineClock;
+}
+
+void ScanlineEngine::catchUp() {
+  while (nextEventCycle < targetCycle) {
+    advanceClock(nextEventCycle);
+    tick();
+    advanceClock(cycle + 1);
+    scheduleNextEvent();
+  }
+  advanceClock(targetCycle);
+}
+
+void ScanlineEngine::tick() {
+  uint32_t scanline = currentScanline;
+  bool isVblank = scanline >= 240 and scanline <= 260;
+
+  // Update vram registers
+  if (!isVblank and renderBackgroundEnabled()) {
+    if (lineClock == 255 and scanline < 240) {
+      if (isFrameSkipped()) {
+        skipRender(scanline);
+      } else if (renderThread) {
+        recordLine(scanline);
+        skipRender(scanline);
+      } else {
+        render(scanline);
+      }
+      nes->notifyScanlineComplete();
+    }
+    if (lineClock == 256) {
+      vramYInc();
+    }
+    if (lineClock == 257) {
+      vramXReset();
+    }
+    if (scanline == 261 and lineClock >= 280 and lineClock <= 304) {
+      vramYReset();
+    }
+  }
+
+  // set and unset vblank register
+  if (scanline == vblankScanline and lineClock == 0) {
+    setVblankFlag();
+    if (nmiOnVblank()) {
+      nmiRequested = true;
+    }
+  } else if (scanline == preRenderScanline and lineClock == 0) {
+    clearVblankFlag();
+    clearSprite0Hit();
+    clearLostSprites();
+  } else if (scanline == preRenderScanline and lineClock == (ticksPerScanline - 1)) {
+    // With the render thread, frameBuffer holds the frame recorded before this one, which is
+    // presented now. The frame just recorded is drawn into the next frame buffer meanwhile.
+    bool threaded = renderThread and !isFrameSkipped();
+    if (threaded) {
+      renderThread->finish();
+      for (uint32_t y = 0; y < renderHeight; y++) {
+        linesDrawn[y] = renderThread->isLineRendered(y);
+      }
+    }
+    endFrame();
+    if (threaded) {
+      renderThread->start(frameBuffer);
+    }
+  }
+}
+
+void ScanlineEngine::save(PpuState &pb) { PpuCore::save(pb); }
+
+void ScanlineEngine::restore(const PpuState &pb) {
+  PpuCore::restore(pb);
+  if (renderThread) {
+    renderThread->reset();
+  }
+  scheduleNextEvent();
+}
+
+void ScanlineEngine::setRenderThread(bool enabled) {
+  if (enabled and !renderThread) {
+    renderThread.reset(new RenderThread{});
+  } else if (!enabled) {
+    renderThread.reset();
+  }
+}
+
+ScanlineEngine::ScanlineEngine(Nes *parent, Sdl *disp) : PpuCore{parent, disp} {
+  scheduleNextEvent();
+}
+
+ScanlineEngine::~ScanlineEngine() {}
+
+}; // namespace Rnes
@@ -0,0 +1,62 @@
+//
+//  ppuscanline.h
+//  rnes
+//
+//
+
+#ifndef __PPUSCANLINE_H__
+#define __PPUSCANLINE_H__
+
+#include "ppucore.h"
+#include "ppurender.h"
+
+namespace Rnes {
+
+// The fast engine. Whole scanlines are rendered at dot 255 and the ppu only wakes up for the
+// handful of dots per line where something observable happens.
+class ScanlineEngine : public PpuCore {
+  // Sprites hitting a scanline in oam order, which is also front to back. A line holds the 8 the
+  // hardware draws and flags lost sprites when more would hit it. Lines are rebuilt lazily when
+  // their generation falls behind spriteGeneration.
+  static const uint32_t spriteLineCapacity = 8;
+  static const uint32_t spriteLineCount = 240;
+  struct SpriteLine {
+    uint64_t generation;
+    uint8_t count;
+    bool lostSprites;
+    uint8_t sprites[spriteLineCapacity];
+  };
+
+  uint64_t getSpritesOnScanline(uint32_t scanline, uint32_t spriteSize) const;
+  const SpriteLine &getSpriteLine(uint32_t scanline);
+  ScanlineSnapshot::Sprite getSprite(uint32_t sprite) const;
+  void snapshotLine(uint32_t scanline, ScanlineSnapshot &line);
+  void render(uint32_t scanline);
+  void recordLine(uint32_t scanline);
+  void skipRender(uint32_t scanline);
+  void tick();
+
+protected:
+  void scheduleNextEvent();
+  void catchUp();
+  void save(PpuState &pb);
+  void restore(const PpuState &pb);
+
+  ScanlineEngine(Nes *parent, Sdl *disp);
+  ~ScanlineEngine();
+
+public:
+  // Rasterize on a worker thread. The emulation thread only records per scanline snapshots and
+  // works out sprite 0 hits itself; frames reach the screen one frame later.
+  void setRenderThread(bool enabled);
+
+private:
+  SpriteLine spriteLines[spriteLineCount] = {};
+  ScanlineRenderer<LiveVideoMemory> lineRenderer;
+  std::unique_ptr<RenderThread> renderThread;
+  uint64_t recordedGeneration = 0;
+};
+
+}; // namespace Rnes
+
+#endif
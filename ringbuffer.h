@@ -7,58 +7,101 @@
 #ifndef __RINGBUFFER_H__
 #define __RINGBUFFER_H__
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
-#include <condition_variable>
+#include <chrono>
 #include <cstdint>
-#include <iostream>
-#include <mutex>
+#include <cstring>
+#include <thread>
 #include <vector>
 
 namespace Rnes {
 
 static bool isPow2(uint32_t i) { return ((i - 1) & i) == 0; }
 
+// Ring of plain values between exactly one producer thread and one consumer thread. Neither side
+// ever takes a lock: each owns one index and publishes it with release stores, the other side reads
+// it with acquire loads. Items are moved with at most two memcpys, one on each side of the wrap.
 template <typename T> class RingBuffer {
   std::vector<T> buffer;
   uint32_t size;
-  volatile uint64_t get, put;
-  std::mutex mutex;
-  std::condition_variable consumeCv;
-  std::condition_variable produceCv;
-  bool hasData(uint32_t count) const { return (get + count) <= put; }
-  bool hasEmptySpace(uint32_t count) const { return (put + count - get) <= size; }
 
-public:
-  RingBuffer(uint32_t sz)
-      : buffer(sz, 0), size{sz}, get{0}, put{0}, mutex{}, consumeCv{}, produceCv{} {
-    assert(isPow2(sz));
+  // Free running counts of items put and taken, on separate cache lines.
+  alignas(64) std::atomic<uint64_t> put{0};
+  alignas(64) std::atomic<uint64_t> get{0};
+
+  // Consumer side only.
+  T lastItem = T();
+
+  void copyIn(uint64_t at, const T *in, uint32_t count) {
+    uint32_t offset = at & (size - 1);
+    uint32_t first = std::min(count, size - offset);
+    memcpy(&buffer[offset], in, first * sizeof(T));
+    memcpy(&buffer[0], in + first, (count - first) * sizeof(T));
   }
+  void copyOut(uint64_t at, T *out, uint32_t count) const {
+    uint32_t offset = at & (size - 1);
+    uint32_t first = std::min(count, size - offset);
+    memcpy(out, &buffer[offset], first * sizeof(T));
+    memcpy(out + first, &buffer[0], (count - first) * sizeof(T));
+  }
+
+public:
+  // What the producer does when the ring can't take everything.
+  enum Overflow {
+    // Sleep until the consumer made room. Paces the producer to the consumer.
+    OVERFLOW_WAIT,
+    // Keep what fits and drop the rest. Never waits.
+    OVERFLOW_DROP,
+  };
+
+  RingBuffer(uint32_t sz) : buffer(sz, T()), size{sz} { assert(isPow2(sz)); }
+  RingBuffer(const RingBuffer &) = delete;
   ~RingBuffer() {}
-  void putData(const T *in, uint32_t count) {
-    {
-      std::unique_lock<std::mutex> lock(mutex);
-      if (!hasEmptySpace(count)) {
-        produceCv.wait(lock, [&] { return this->hasEmptySpace(count); });
-      }
-      for (uint32_t i = 0; i < count; i++) {
-        buffer[put & (size - 1)] = in[i];
-        put += 1;
+
+  uint32_t getSize() const { return size; }
+
+  // Items waiting for the consumer. Exact on either side, a snapshot anywhere else.
+  uint32_t getFill() const {
+    return uint32_t(put.load(std::memory_order_acquire) - get.load(std::memory_order_acquire));
+  }
+
+  // Producer side. Returns how many items were stored, count unless items were dropped.
+  uint32_t putData(const T *in, uint32_t count, Overflow policy) {
+    uint64_t putPos = put.load(std::memory_order_relaxed);
+    uint32_t stored = 0;
+    while (true) {
+      uint32_t space = size - uint32_t(putPos - get.load(std::memory_order_acquire));
+      uint32_t chunk = std::min(space, count - stored);
+      copyIn(putPos, in + stored, chunk);
+      putPos += chunk;
+      stored += chunk;
+      put.store(putPos, std::memory_order_release);
+      if (stored == count or policy == OVERFLOW_DROP) {
+        return stored;
       }
+
+      // The consumer drains in device buffer sized bursts, a millisecond is well below that.
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
-    consumeCv.notify_one();
   }
-  void getData(T *out, uint32_t count) {
-    {
-      std::unique_lock<std::mutex> lock(mutex);
-      if (!hasData(count)) {
-        consumeCv.wait(lock, [&] { return this->hasData(count); });
-      }
-      for (uint32_t i = 0; i < count; i++) {
-        out[i] = buffer[get & (size - 1)];
-        get += 1;
-      }
+
+  // Consumer side, never waits. Whatever the producer hasn't supplied yet is filled by repeating
+  // the last item, which keeps an underrunning audio stream from clicking. Returns how many items
+  // came from the producer.
+  uint32_t getData(T *out, uint32_t count) {
+    uint64_t getPos = get.load(std::memory_order_relaxed);
+    uint32_t available = uint32_t(put.load(std::memory_order_acquire) - getPos);
+    uint32_t taken = std::min(available, count);
+    copyOut(getPos, out, taken);
+    get.store(getPos + taken, std::memory_order_release);
+
+    if (taken) {
+      lastItem = out[taken - 1];
     }
-    produceCv.notify_one();
+    std::fill(out + taken, out + count, lastItem);
+    return taken;
   }
 };
 
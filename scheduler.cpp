@@ -0,0 +1,89 @@
+//
+//  scheduler.cpp
+//  rnes
+//
+//
+
+#include <cassert>
+
+#include "scheduler.h"
+
+namespace Rnes {
+
+void Scheduler::reschedule(Event event, uint64_t at) {
+  when[event] = at;
+  if (position[event] < 0) {
+    place(size, event);
+    size++;
+    siftUp(size - 1);
+  } else {
+    siftUp(position[event]);
+    siftDown(position[event]);
+  }
+  nextEventCycle = when[heap[0]];
+}
+
+void Scheduler::cancel(Event event) {
+  int32_t index = position[event];
+  if (index < 0) {
+    return;
+  }
+  position[event] = -1;
+  size--;
+  if ((uint32_t)index < size) {
+    // The last event fills the hole and moves to wherever it belongs from there.
+    Event moved = heap[size];
+    place(index, moved);
+    siftUp(index);
+    siftDown(position[moved]);
+  }
+  nextEventCycle = size ? when[heap[0]] : never;
+}
+
+Scheduler::Event Scheduler::popEvent() {
+  assert(isEventDue());
+  Event event = heap[0];
+  cancel(event);
+  return event;
+}
+
+void Scheduler::siftUp(uint32_t index) {
+  Event event = heap[index];
+  while (index > 0) {
+    uint32_t parent = (index - 1) / 2;
+    if (!isEarlier(event, heap[parent])) {
+      break;
+    }
+    place(index, heap[parent]);
+    index = parent;
+  }
+  place(index, event);
+}
+
+void Scheduler::siftDown(uint32_t index) {
+  Event event = heap[index];
+  while (true) {
+    uint32_t child = 2 * index + 1;
+    if (child >= size) {
+      break;
+    }
+    if (child + 1 < size and isEarlier(heap[child + 1], heap[child])) {
+      child++;
+    }
+    if (!isEarlier(heap[child], event)) {
+      break;
+    }
+    place(index, heap[child]);
+    index = child;
+  }
+  place(index, event);
+}
+
+Scheduler::Scheduler() {
+  for (uint32_t i = 0; i < EVENT_COUNT; i++) {
+    when[i] = never;
+    position[i] = -1;
+  }
+}
+
+}; // namespace Rnes
@@ -0,0 +1,78 @@
+//
+//  scheduler.h
+//  rnes
+//
+//
+
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+#include <cstdint>
+
+namespace Rnes {
+
+// The master clock in cpu cycles and the timed events of the components driven off it. Each
+// component has at most one event pending, the cycle at which it next has to be caught up, and
+// reschedules it whenever that moves. The cpu runs until the earliest one is due. Events due on
+// the same cycle come out in Event order.
+class Scheduler {
+public:
+  enum Event {
+    // Frame sequencer steps, the frame irq, dmc fetches and the end of audio frames.
+    APU,
+    // Scanline rendering, vblank and nmi, and with them the mapper's scanline irq.
+    PPU,
+    // Checking the savestate keys.
+    INPUT,
+    EVENT_COUNT,
+  };
+
+  static const uint64_t never = UINT64_MAX;
+
+  uint64_t getCycle() const { return cycle; }
+  void advance(uint32_t cycles) { cycle += cycles; }
+
+  // Sets when event is next due, replacing whatever was scheduled for it. Components reschedule
+  // on every register access, mostly to the same cycle, which costs nothing.
+  void schedule(Event event, uint64_t at) {
+    if (when[event] != at or position[event] < 0) {
+      reschedule(event, at);
+    }
+  }
+  void cancel(Event event);
+
+  uint64_t getNextEventCycle() const { return nextEventCycle; }
+  bool isEventDue() const { return nextEventCycle <= cycle; }
+
+  // Removes the earliest event, which has to be due, and returns it.
+  Event popEvent();
+
+  Scheduler();
+  Scheduler(const Scheduler &) = delete;
+
+private:
+  uint64_t cycle = 0;
+  uint64_t nextEventCycle = never;
+
+  // Binary min-heap of the pending events, with the position of each event in it so it can be
+  // moved when rescheduled. There are only ever a handful of them.
+  uint64_t when[EVENT_COUNT];
+  Event heap[EVENT_COUNT];
+  int32_t position[EVENT_COUNT];
+  uint32_t size = 0;
+
+  bool isEarlier(Event a, Event b) const {
+    return when[a] < when[b] or (when[a] == when[b] and a < b);
+  }
+  void place(uint32_t index, Event event) {
+    heap[index] = event;
+    position[event] = index;
+  }
+  void reschedule(Event event, uint64_t at);
+  void siftUp(uint32_t index);
+  void siftDown(uint32_t index);
+};
+
+}; // namespace Rnes
+
+#endif
@@ -5,11 +5,17 @@
 //
 
 #include <SDL2/SDL.h>
+#include <chrono>
 
+#include "filter.h"
+#include "framebuffer.h"
 #include "sdl.h"
 
 namespace Rnes {
 
+// The presenter looks at the event queue at least this often, frame or not.
+static const std::chrono::milliseconds eventPollInterval{4};
+
 void callback(void *userData, Uint8 *stream, int len) {
   Sdl *sdl = (Sdl *)userData;
   sdl->callbackWrapper(stream, len);
@@ -38,35 +44,207 @@ uint32_t Sdl::getSampleRate() { return audioFreq; }
 uint32_t Sdl::getChunkSize() { return audioBufferSize; }
 
 int Sdl::initDisplay() {
+  // Waits for the presenter to bring video up, so nothing else initializes SDL meanwhile.
+  presenter = std::thread(&Sdl::presenterMain, this);
+  std::unique_lock<std::mutex> guard(presentLock);
+  presentCond.wait(guard, [this] { return presenterStarted; });
+  if (!displayOpen) {
+    guard.unlock();
+    presenter.join();
+    return -1;
+  }
+
+  return 0;
+}
+
+bool Sdl::openWindow() {
+  if (SDL_InitSubSystem(SDL_INIT_VIDEO) < 0) {
+    fprintf(stderr, "can't initialize video: %s\n", SDL_GetError());
+    return false;
+  }
   window = SDL_CreateWindow("rnes", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, displayWidth,
                             displayHeight, 0);
+  if (!window) {
+    fprintf(stderr, "can't create window: %s\n", SDL_GetError());
+    return false;
+  }
   renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_ACCELERATED);
+  if (!renderer) {
+    fprintf(stderr, "can't create renderer: %s\n", SDL_GetError());
+    SDL_DestroyWindow(window);
+    return false;
+  }
+  return true;
+}
+
+void Sdl::createTexture() {
+  // A filter's output is shown pixel for pixel and the window takes its size. Plain frames are
+  // scaled up to the default window size by the renderer.
+  int width = filter ? filter->getWidth() : renderWidth;
+  int height = filter ? filter->getHeight() : renderHeight;
+  if (texture) {
+    SDL_DestroyTexture(texture);
+  }
   texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
-                              renderWidth, renderHeight);
-  SDL_RenderSetLogicalSize(renderer, renderWidth, renderHeight);
+                              width, height);
+  if (filter) {
+    SDL_RenderSetLogicalSize(renderer, 0, 0);
+    SDL_SetWindowSize(window, width, height);
+  } else {
+    SDL_RenderSetLogicalSize(renderer, renderWidth, renderHeight);
+    SDL_SetWindowSize(window, displayWidth, displayHeight);
+  }
+  SDL_SetWindowPosition(window, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED);
+  dirtyLines.invalidate();
+}
+
+void Sdl::present() {
+  SDL_RenderClear(renderer);
+  if (filter) {
+    // Centered and unscaled, in case the window manager didn't grant the size asked for.
+    int outputWidth, outputHeight;
+    SDL_GetRendererOutputSize(renderer, &outputWidth, &outputHeight);
+    int width = filter->getWidth();
+    int height = filter->getHeight();
+    SDL_Rect rect = {(outputWidth - width) / 2, (outputHeight - height) / 2, width, height};
+    SDL_RenderCopy(renderer, texture, NULL, &rect);
+  } else {
+    SDL_RenderCopy(renderer, texture, NULL, NULL);
+  }
+  SDL_RenderPresent(renderer);
+}
+
+void Sdl::uploadLines(const FrameBuffer &frame) {
+  for (int y = 0; y < renderHeight;) {
+    if (!dirtyLines.isDirty(y)) {
+      y++;
+      continue;
+    }
+    int firstLine = y;
+    while (y < renderHeight and dirtyLines.isDirty(y)) {
+      y++;
+    }
+
+    // Lines are converted straight into the locked texture memory. Locked pixels are write
+    // only, so every line of the rect gets written.
+    SDL_Rect rect = {0, firstLine, renderWidth, y - firstLine};
+    void *pixels;
+    int pitch;
+    if (SDL_LockTexture(texture, &rect, &pixels, &pitch) < 0) {
+      continue;
+    }
+    for (int line = firstLine; line < y; line++) {
+      uint8_t *out = (uint8_t *)pixels + (line - firstLine) * pitch;
+      frame.lineToArgb8888(line, (uint32_t *)out);
+    }
+    SDL_UnlockTexture(texture);
+  }
+}
+
+void Sdl::uploadFiltered(const FrameBuffer &frame) {
+  // Filters read neighbouring lines and carry state between frames, so they always run over the
+  // whole frame.
+  void *pixels;
+  int pitch;
+  if (SDL_LockTexture(texture, NULL, &pixels, &pitch) < 0) {
+    return;
+  }
+  filterWorkers->run(*filter, frame, (uint8_t *)pixels, pitch);
+  SDL_UnlockTexture(texture);
+}
+
+void Sdl::presenterMain() {
+  bool opened = openWindow();
+  {
+    std::lock_guard<std::mutex> guard(presentLock);
+    displayOpen = opened;
+    presenterStarted = true;
+  }
+  presentCond.notify_all();
+  if (!opened) {
+    return;
+  }
   SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
-  image = new uint32_t[renderWidth * renderHeight];
+  createTexture();
 
-  return 0;
+  std::unique_lock<std::mutex> guard(presentLock);
+  while (true) {
+    presentCond.wait_for(guard, eventPollInterval,
+                         [this] { return presenterQuit or frames.hasFresh() or filterPending; });
+    if (presenterQuit) {
+      break;
+    }
+    if (filterPending) {
+      filter = std::move(pendingFilter);
+      filterPending = false;
+      if (filter and !filterWorkers) {
+        filterWorkers.reset(new FilterWorkers{});
+      }
+      createTexture();
+    }
+    guard.unlock();
+
+    // Only changed frames are uploaded, and an unchanged frame isn't presented at all unless the
+    // window needs repainting. Emulation speed doesn't depend on presenting, the frame pacer or
+    // the audio ring buffer throttles it.
+    bool exposed = pumpEvents();
+    bool changed = frames.consume() and dirtyLines.update(frames.getFront());
+    if (changed and filter) {
+      uploadFiltered(frames.getFront());
+    } else if (changed) {
+      uploadLines(frames.getFront());
+    }
+    if (changed or exposed) {
+      present();
+    }
+
+    guard.lock();
+  }
+
+  filterWorkers.reset();
+  SDL_DestroyTexture(texture);
+  SDL_DestroyRenderer(renderer);
+  SDL_DestroyWindow(window);
+}
+
+void Sdl::setVideoFilter(std::unique_ptr<VideoFilter> videoFilter) {
+  {
+    std::lock_guard<std::mutex> guard(presentLock);
+    pendingFilter = std::move(videoFilter);
+    filterPending = true;
+  }
+  presentCond.notify_one();
+}
+
+void Sdl::wakePresenter() {
+  // Taking the lock orders this wakeup against the presenter checking for work. It is only ever
+  // held for that check, never across a present.
+  { std::lock_guard<std::mutex> guard(presentLock); }
+  presentCond.notify_one();
 }
 
 int Sdl::initAudio() {
   SDL_AudioSpec desired, obtained;
 
+  if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
+    return -1;
+  }
+
   desired.freq = 44100;
   desired.format = AUDIO_S16SYS;
   desired.channels = 1;
-  desired.samples = 2048;
+  desired.samples = 512;
   desired.callback = callback;
   desired.userdata = this;
 
   if (SDL_OpenAudio(&desired, &obtained) < 0) {
     printf("Fail\n");
-    return 1;
+    return -1;
   }
 
   audioFreq = obtained.freq;
   audioBufferSize = obtained.samples;
+  audioOpen = true;
 
   return 0;
 }
@@ -74,7 +252,9 @@ int Sdl::initAudio() {
 Sdl::Sdl() {
   int ret;
 
-  ret = SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO);
+  // Video is brought up by the presenter thread, audio only once it's done. Audio is optional,
+  // without a sound device the emulator runs on a null audio sink.
+  ret = SDL_Init(0);
   if (ret < 0) {
     return;
   }
@@ -89,28 +269,29 @@ Sdl::Sdl() {
 }
 
 Sdl::~Sdl() {
+  if (presenter.joinable()) {
+    {
+      std::lock_guard<std::mutex> guard(presentLock);
+      presenterQuit = true;
+    }
+    presentCond.notify_one();
+    presenter.join();
+  }
   SDL_FreeSurface(display);
   SDL_CloseAudio();
 }
 
-void Sdl::setPixel(int x, int y, uint8_t r, uint8_t g, uint8_t b) {
-  uint32_t pixel = 0;
-  pixel |= 255 << 24;
-  pixel |= (uint32_t)r << 16;
-  pixel |= (uint32_t)g << 8;
-  pixel |= (uint32_t)b << 0;
-  image[x + y * renderWidth] = pixel;
+FrameBuffer *Sdl::presentFrame() {
+  frames.publish();
+  wakePresenter();
+  return &frames.getBack();
 }
 
-void Sdl::renderSync() {
-  SDL_UpdateTexture(texture, NULL, image, renderWidth * sizeof(uint32_t));
-  SDL_RenderCopy(renderer, texture, NULL, NULL);
-  SDL_RenderPresent(renderer);
-}
-
-void Sdl::parseInput() {
+bool Sdl::pumpEvents() {
+  // Returns whether the window has to be repainted.
   SDL_Event event;
   int button;
+  bool exposed = false;
 
   while (SDL_PollEvent(&event)) {
     switch (event.type) {
@@ -158,21 +339,25 @@ void Sdl::parseInput() {
       default:
         continue;
       }
-      if (event.type == SDL_KEYDOWN) {
-        buttonState[button] = true;
-      } else {
-        buttonState[button] = false;
+      buttonState[button].store(event.type == SDL_KEYDOWN, std::memory_order_relaxed);
+      break;
+    case SDL_WINDOWEVENT:
+      if (event.window.event == SDL_WINDOWEVENT_EXPOSED) {
+        exposed = true;
       }
       break;
     case SDL_QUIT:
-      exit(1);
+      quitRequested.store(true, std::memory_order_relaxed);
       break;
     default:
       break;
     }
   }
+  return exposed;
 }
 
-bool Sdl::getButtonState(int button) { return buttonState[button]; }
+bool Sdl::getButtonState(int button) {
+  return buttonState[button].load(std::memory_order_relaxed);
+}
 
 }; // namespace Rnes
@@ -5,7 +5,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "filter.h"
+#include "framebuffer.h"
+#include "triplebuffer.h"
 
 class SDL_Surface;
 class SDL_Window;
@@ -33,21 +42,51 @@ public:
 private:
   SDL_Surface *display = nullptr;
   SDL_Window *window;
-  SDL_Renderer *renderer;
-  SDL_Texture *texture;
-  uint32_t *image;
+  SDL_Renderer *renderer = nullptr;
+  SDL_Texture *texture = nullptr;
   static constexpr int dispMultiple = 4;
   static constexpr int renderWidth = 256;
   static constexpr int renderHeight = 240;
   static constexpr int displayHeight = dispMultiple * renderHeight;
   static constexpr int displayWidth = dispMultiple * renderWidth;
   //static constexpr int bitsPerPixel;
-  bool buttonState[BUTTON_COUNT] = {false};
+
+  // Frames reach the presenter thread through a triple buffer, so the emulation thread never waits
+  // on vsync. SDL wants a window, its events and its renderer on one thread, so the presenter owns
+  // all of video: it creates the window, pumps events and publishes what they mean through the
+  // atomics below. The lock only guards its wakeups.
+  TripleBuffer<FrameBuffer> frames;
+  std::thread presenter;
+  std::mutex presentLock;
+  std::condition_variable presentCond;
+  bool presenterQuit = false;
+  bool presenterStarted = false;
+  bool displayOpen = false;
+  DirtyLines dirtyLines;
+  void presenterMain();
+  bool openWindow();
+  void wakePresenter();
+  bool pumpEvents();
+
+  // Optional post-processing, run by the presenter. A new filter is handed over under the lock
+  // and picked up before the next frame.
+  std::unique_ptr<VideoFilter> filter;
+  std::unique_ptr<VideoFilter> pendingFilter;
+  bool filterPending = false;
+  std::unique_ptr<FilterWorkers> filterWorkers;
+  void createTexture();
+  void present();
+  void uploadLines(const FrameBuffer &frame);
+  void uploadFiltered(const FrameBuffer &frame);
+
+  std::atomic<bool> buttonState[BUTTON_COUNT] = {};
+  std::atomic<bool> quitRequested{false};
   typedef void(Callback)(void *data, uint8_t *stream, int len);
   Callback *audioCallback;
   void *callbackData;
-  uint32_t audioFreq;
-  uint32_t audioBufferSize;
+  uint32_t audioFreq = 0;
+  uint32_t audioBufferSize = 0;
+  bool audioOpen = false;
 
 public:
   Sdl();
@@ -55,18 +94,31 @@ public:
   int initDisplay();
   ~Sdl();
 
-  // Video functions
-  void setPixel(int x, int y, uint8_t r, uint8_t g, uint8_t b);
-  void renderSync();
-  void parseInput();
+  // Video functions. The ppu draws straight into the frame from getFrame(). presentFrame() hands
+  // that frame to the presenter as is and returns the one to draw next, without ever waiting. The
+  // next frame still holds whatever an older frame left in it.
+  FrameBuffer *getFrame() { return &frames.getBack(); }
+  FrameBuffer *presentFrame();
+  void setVideoFilter(std::unique_ptr<VideoFilter> videoFilter);
+
+  // Input as of the presenter's last look at the event queue, a few milliseconds ago at most.
   bool getButtonState(int button);
 
+  // Set once the window was closed, the emulation loop returns then.
+  bool isQuitRequested() const { return quitRequested.load(std::memory_order_relaxed); }
+
   // Audio functions
   void callbackWrapper(uint8_t *stream, int len);
   void registerAudioCallback(Callback *audioCallback, void *data);
   void unregisterAudioCallback();
   uint32_t getSampleRate();
   uint32_t getChunkSize();
+
+  // False when there's no sound device, the callback would never run.
+  bool isAudioOpen() const { return audioOpen; }
+
+  // False when the window couldn't be opened, there's no display and no input.
+  bool isDisplayOpen() const { return displayOpen; }
 };
 
 }; // namespace Rnes
@@ -0,0 +1,53 @@
+//
+//  triplebuffer.h
+//  rnes
+//
+//
+
+#ifndef __TRIPLEBUFFER_H__
+#define __TRIPLEBUFFER_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace Rnes {
+
+// Hands the newest value from one producer thread to one consumer thread without either of them
+// ever waiting. The producer fills its back slot and publishes it, the consumer takes whatever was
+// published last; values published in between are dropped. The slots are exchanged through a
+// single atomic holding the index of the middle slot plus a fresh flag.
+template <typename T> class TripleBuffer {
+  static const uint32_t freshFlag = 4;
+  static const uint32_t indexMask = 3;
+
+  std::unique_ptr<T> slots[3];
+  std::atomic<uint32_t> middle{1};
+  uint32_t back = 0;
+  uint32_t front = 2;
+
+public:
+  // Producer side.
+  T &getBack() { return *slots[back]; }
+  void publish() {
+    back = middle.exchange(back | freshFlag, std::memory_order_acq_rel) & indexMask;
+  }
+
+  // Consumer side. Returns false if nothing was published since the last call, front stays as is.
+  bool consume() {
+    if (!(middle.load(std::memory_order_relaxed) & freshFlag)) {
+      return false;
+    }
+    front = middle.exchange(front, std::memory_order_acq_rel) & indexMask;
+    return true;
+  }
+  bool hasFresh() const { return (middle.load(std::memory_order_acquire) & freshFlag) != 0; }
+  const T &getFront() const { return *slots[front]; }
+
+  TripleBuffer() : slots{std::make_unique<T>(), std::make_unique<T>(), std::make_unique<T>()} {}
+  TripleBuffer(const TripleBuffer &) = delete;
+};
+
+}; // namespace Rnes
+
+#endif